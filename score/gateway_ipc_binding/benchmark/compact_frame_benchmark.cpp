@@ -0,0 +1,83 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include <cassert>
+#include <cstddef>
+#include <string>
+
+#include "../impl/compact_frame.hpp"
+
+namespace score::gateway_ipc_binding {
+namespace {
+
+/// \brief Connect of a client using services service instances, with realistic string lengths
+Connect create_connect(std::size_t services) {
+    Connect msg{};
+    msg.find_service_elements.size = services;
+    msg.shared_memory_configs.size = services;
+    for (std::size_t i = 0U; i < services; ++i) {
+        auto const name = "vehicle/body/Service" + std::to_string(i);
+        auto service_id = fixed_string_from_string<Service_id>(name);
+        auto instance_id = fixed_string_from_string<Instance_id>(std::to_string(i));
+        auto path = fixed_string_from_string<Shared_memory_path>("/gateway_" + name);
+        assert(service_id && instance_id && path);
+
+        auto& element = msg.find_service_elements.data[i];
+        element.service = Service{*service_id, {1U, 0U}};
+        element.instance_id = *instance_id;
+
+        auto& config = msg.shared_memory_configs.data[i];
+        config.service = element.service;
+        config.instance_id = element.instance_id;
+        config.metadata.path = *path;
+        config.metadata.slot_size = 4096U;
+        config.metadata.slot_count = 16U;
+    }
+    auto identifier = fixed_string_from_string<Client_identifier>("someip_gateway");
+    assert(identifier);
+    msg.identifier = *identifier;
+    return msg;
+}
+
+/// Size and cost of the Connect sent at every (re)connect of a client
+void benchmark_encode_connect(benchmark::State& state) {
+    auto const msg = create_connect(static_cast<std::size_t>(state.range(0)));
+    std::size_t frame_size{0U};
+
+    for (auto _ : state) {
+        auto frame = encode_compact_frame(msg);
+        frame_size = frame.size();
+        benchmark::DoNotOptimize(frame.data());
+    }
+
+    state.counters["frame_bytes"] = static_cast<double>(frame_size);
+    state.counters["fixed_frame_bytes"] = static_cast<double>(sizeof(Message_frame<Connect>));
+}
+
+void benchmark_decode_connect(benchmark::State& state) {
+    auto const services = static_cast<std::size_t>(state.range(0));
+    auto const frame = encode_compact_frame(create_connect(services));
+
+    for (auto _ : state) {
+        auto msg = decode_compact_frame<Connect>({frame.data(), frame.size()});
+        benchmark::DoNotOptimize(msg);
+    }
+}
+
+BENCHMARK(benchmark_encode_connect)->Arg(1)->Arg(4)->Arg(kMax_connect_page_size);
+BENCHMARK(benchmark_decode_connect)->Arg(1)->Arg(4)->Arg(kMax_connect_page_size);
+
+}  // namespace
+}  // namespace score::gateway_ipc_binding
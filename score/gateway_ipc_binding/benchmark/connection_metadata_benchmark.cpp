@@ -0,0 +1,101 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+
+#include "../impl/connection_metadata.hpp"
+
+namespace score::gateway_ipc_binding {
+namespace {
+
+constexpr Client_id kClient_count = 4U;
+
+/// \brief Handles of the peer are offset, so local and remote handles differ like in practice
+constexpr Remote_handle kRemote_handle_offset = 100000U;
+
+/// \brief Mapping with services connected service instances for each of kClient_count clients
+Connection_metadata create_mapping(std::size_t services) {
+    Connection_metadata mapping;
+    for (Client_id client_id = 0U; client_id < kClient_count; ++client_id) {
+        for (std::size_t service = 0U; service < services; ++service) {
+            Connection_metadata::Ids ids{};
+            ids.key = service;
+            ids.local_handle = client_id * services + service + 1U;
+            ids.remote_handle = ids.local_handle + kRemote_handle_offset;
+            mapping.add_mapping(client_id, ids);
+        }
+    }
+    return mapping;
+}
+
+/// Lookup of every inbound Event_update and Payload_consumed, for the last connected service
+void benchmark_get_by_remote_handle(benchmark::State& state) {
+    auto const services = static_cast<std::size_t>(state.range(0));
+    auto const mapping = create_mapping(services);
+    Client_id const client_id = kClient_count - 1U;
+    Remote_handle const remote_handle = client_id * services + services + kRemote_handle_offset;
+
+    for (auto _ : state) {
+        auto ids = mapping.get_by_remote_handle(client_id, remote_handle);
+        benchmark::DoNotOptimize(ids);
+    }
+}
+
+/// Lookup of every inbound Subscribe_event and Call_method, for the last connected service
+void benchmark_get_by_local_handle(benchmark::State& state) {
+    auto const services = static_cast<std::size_t>(state.range(0));
+    auto const mapping = create_mapping(services);
+    Client_id const client_id = kClient_count - 1U;
+    Remote_handle const local_handle = client_id * services + services;
+
+    for (auto _ : state) {
+        auto ids = mapping.get_by_local_handle(client_id, local_handle);
+        benchmark::DoNotOptimize(ids);
+    }
+}
+
+/// Recipients of every outbound event update
+void benchmark_for_each_client(benchmark::State& state) {
+    auto const services = static_cast<std::size_t>(state.range(0));
+    auto const mapping = create_mapping(services);
+
+    for (auto _ : state) {
+        std::size_t recipients{0U};
+        mapping.for_each_client(services - 1U,
+                                [&recipients](auto, auto const&) { ++recipients; });
+        benchmark::DoNotOptimize(recipients);
+    }
+}
+
+/// A peer releasing and re-establishing one service connection
+void benchmark_remove_and_add_mapping(benchmark::State& state) {
+    auto const services = static_cast<std::size_t>(state.range(0));
+    auto mapping = create_mapping(services);
+    Client_id const client_id = 0U;
+    auto const ids = mapping.get_by_local_handle(client_id, 1U)->get();
+
+    for (auto _ : state) {
+        mapping.remove_mapping_for_client_and_key(client_id, ids.key);
+        mapping.add_mapping(client_id, ids);
+    }
+}
+
+BENCHMARK(benchmark_get_by_remote_handle)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK(benchmark_get_by_local_handle)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK(benchmark_for_each_client)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK(benchmark_remove_and_add_mapping)->Arg(10)->Arg(100)->Arg(1000);
+
+}  // namespace
+}  // namespace score::gateway_ipc_binding
@@ -0,0 +1,286 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+
+#include "event_transmission_benchmark_context.hpp"
+
+namespace score::gateway_ipc_binding {
+namespace {
+
+/// \brief Gateway pair whose producer floods one event while another event is subscribed
+///
+/// The sink releases each flooded update right away, so the Payload_consumed messages of the flood
+/// travel in the same direction as the measured Subscribe_event. Both gateways hand received data
+/// messages to dispatcher workers, where a Subscribe_event received through the socket queues up
+/// behind the Payload_consumed messages of its service.
+class Control_latency_benchmark_context final {
+   public:
+    explicit Control_latency_benchmark_context(bool use_data_ring)
+        : runtime_server_{score::socom::create_runtime()},
+          runtime_client_{score::socom::create_runtime()},
+          service_name_{make_unique_name("gw_ipc_control_bench")},
+          protocol_config_{service_name_, k_max_message_size, k_max_message_size,
+                           k_max_message_size},
+          server_shm_metadata_{
+              make_metadata(make_unique_name("/gw_server_ctl_bench"), k_slot_size, k_slot_count)},
+          client_shm_metadata_{
+              make_metadata(make_unique_name("/gw_client_ctl_bench"), k_slot_size, k_slot_count)} {
+        assert(runtime_server_);
+        assert(runtime_client_);
+
+        Data_ring_config data_ring;
+        if (use_data_ring) {
+            data_ring.path = make_unique_name("/gw_ring_ctl_bench");
+        }
+        create_gateway_pair(data_ring);
+        wait_for_gateway_connection();
+        create_connectors();
+        wait_for(service_available_);
+
+        auto const subscribe_result =
+            sink_connector_->subscribe_event(k_flooded_event, score::socom::Event_mode::update);
+        (void)subscribe_result;  // Avoid unused variable warning in non-debug builds
+        assert(subscribe_result);
+        wait_for(flooded_event_subscribed_);
+
+        flood_thread_ = std::thread{[this]() { flood(); }};
+    }
+
+    ~Control_latency_benchmark_context() {
+        stop_flood_ = true;
+        flood_thread_.join();
+        // Disconnect callback sources before mutex/condition_variable members are destroyed.
+        sink_connector_.reset();
+        source_connector_.reset();
+        gateway_client_.reset();
+        gateway_server_.reset();
+    }
+
+    /// \brief Time from subscribing the measured event until the producer sees the subscription
+    [[nodiscard]] std::chrono::nanoseconds subscribe_and_measure_once() {
+        {
+            std::lock_guard<std::mutex> lock{state_mutex_};
+            measured_event_state_.reset();
+        }
+        auto const start = std::chrono::steady_clock::now();
+        auto const subscribe_result =
+            sink_connector_->subscribe_event(k_measured_event, score::socom::Event_mode::update);
+        (void)subscribe_result;  // Avoid unused variable warning in non-debug builds
+        assert(subscribe_result);
+        auto const subscribed_time = wait_for_measured_event(score::socom::Event_state::subscribed);
+
+        // Not measured, brings the event back into its initial state for the next iteration
+        auto const unsubscribe_result = sink_connector_->unsubscribe_event(k_measured_event);
+        (void)unsubscribe_result;  // Avoid unused variable warning in non-debug builds
+        assert(unsubscribe_result);
+        (void)wait_for_measured_event(score::socom::Event_state::unsubscribed);
+
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(subscribed_time - start);
+    }
+
+   private:
+    static constexpr std::size_t k_max_message_size = 32768U;
+    static constexpr std::size_t k_slot_size = 64U;
+    static constexpr std::uint32_t k_slot_count = 256U;
+    static constexpr std::size_t k_worker_count = 2U;
+    static constexpr Event_id k_flooded_event{0};
+    static constexpr Event_id k_measured_event{1};
+
+    struct Measured_event_state {
+        score::socom::Event_state state;
+        std::chrono::steady_clock::time_point time;
+    };
+
+    score::socom::Runtime::Uptr runtime_server_;
+    score::socom::Runtime::Uptr runtime_client_;
+
+    std::string service_name_;
+
+    score::message_passing::ServiceProtocolConfig protocol_config_;
+    score::message_passing::IServerFactory::ServerConfig const server_config_{10, 10, 10};
+    score::message_passing::IClientFactory::ClientConfig const client_config_{10, 10, false, false,
+                                                                              false};
+
+    score::socom::Service_interface_identifier const interface_{
+        "com.test.gateway.control_benchmark", score::socom::Literal_tag{}, {1, 0}};
+    score::socom::Service_instance const instance_{"instance1", score::socom::Literal_tag{}};
+    score::socom::Server_service_interface_definition const server_interface_definition_{
+        interface_, score::socom::to_num_of_methods(1), score::socom::to_num_of_events(2)};
+
+    Shared_memory_metadata server_shm_metadata_;
+    Shared_memory_metadata client_shm_metadata_;
+
+    std::unique_ptr<Gateway_ipc_binding_server> gateway_server_;
+    std::unique_ptr<Gateway_ipc_binding_client> gateway_client_;
+
+    score::socom::Enabled_server_connector::Uptr source_connector_;
+    score::socom::Client_connector::Uptr sink_connector_;
+
+    std::mutex state_mutex_;
+    std::condition_variable state_cv_;
+    bool service_available_{false};
+    bool flooded_event_subscribed_{false};
+    std::optional<Measured_event_state> measured_event_state_;
+
+    std::atomic<bool> stop_flood_{false};
+    std::thread flood_thread_;
+
+    void create_gateway_pair(Data_ring_config const& data_ring) {
+        Shared_memory_manager_factory::Shared_memory_configuration const server_shm_config{
+            {interface_, {{instance_, server_shm_metadata_}}}};
+        Shared_memory_manager_factory::Shared_memory_configuration const client_shm_config{
+            {interface_, {{instance_, client_shm_metadata_}}}};
+
+        score::message_passing::ServerFactory server_factory;
+        auto ipc_server = server_factory.Create(protocol_config_, server_config_);
+        assert(ipc_server);
+        gateway_server_ = Gateway_ipc_binding_server::create(
+            *runtime_server_, std::move(ipc_server), Shared_memory_manager_factory::create({}),
+            [](auto, auto const&, auto) {}, {}, Message_dispatch{k_worker_count});
+        assert(gateway_server_);
+
+        score::message_passing::ClientFactory client_factory;
+        auto connection = client_factory.Create(protocol_config_, client_config_);
+        gateway_client_ = Gateway_ipc_binding_client::create(
+            *runtime_client_, std::move(connection),
+            Shared_memory_manager_factory::create(client_shm_config), {},
+            make_shared_memory_configs(server_shm_config), {}, {}, data_ring,
+            Message_dispatch{k_worker_count});
+        assert(gateway_client_);
+
+        auto start_result = gateway_server_->start();
+        (void)start_result;  // Avoid unused variable warning in non-debug builds
+        assert(start_result);
+    }
+
+    void wait_for_gateway_connection() {
+        while (!gateway_client_->is_connected()) {
+            std::this_thread::sleep_for(1ms);
+        }
+    }
+
+    void create_connectors() {
+        // The payload is released when the callback returns, which sends Payload_consumed
+        auto on_event_update = [](score::socom::Client_connector const&, Event_id,
+                                  score::socom::Payload) {};
+
+        score::socom::Client_connector::Callbacks client_callbacks{
+            [this](score::socom::Client_connector const&, score::socom::Service_state state,
+                   score::socom::Server_service_interface_definition const&) {
+                if (state == score::socom::Service_state::available) {
+                    {
+                        std::lock_guard<std::mutex> lock{state_mutex_};
+                        service_available_ = true;
+                    }
+                    state_cv_.notify_all();
+                }
+            },
+            on_event_update, on_event_update,
+            [](score::socom::Client_connector const&, Event_id) {
+                return MakeUnexpected(score::socom::Error::runtime_error_request_rejected);
+            }};
+
+        auto sink_connector_result = runtime_server_->make_client_connector(
+            server_interface_definition_, instance_, std::move(client_callbacks));
+        assert(sink_connector_result);
+        sink_connector_ = std::move(sink_connector_result).value();
+        assert(sink_connector_);
+
+        score::socom::Disabled_server_connector::Callbacks server_callbacks{
+            [](score::socom::Enabled_server_connector&, Method_id, score::socom::Payload,
+               score::socom::Method_call_reply_data_opt, score::socom::Posix_credentials const&) {
+                return score::socom::Method_invocation::Uptr{};
+            },
+            [this](score::socom::Enabled_server_connector&, Event_id event_id,
+                   score::socom::Event_state state) {
+                auto const now = std::chrono::steady_clock::now();
+                {
+                    std::lock_guard<std::mutex> lock{state_mutex_};
+                    if (event_id == k_measured_event) {
+                        measured_event_state_ = Measured_event_state{state, now};
+                    } else if (state == score::socom::Event_state::subscribed) {
+                        flooded_event_subscribed_ = true;
+                    }
+                }
+                state_cv_.notify_all();
+            },
+            [](score::socom::Enabled_server_connector&, Event_id) {},
+            [](score::socom::Enabled_server_connector&, Method_id) {
+                return MakeUnexpected(score::socom::Error::runtime_error_request_rejected);
+            }};
+
+        auto disabled_connector_result = runtime_client_->make_server_connector(
+            server_interface_definition_, instance_, std::move(server_callbacks));
+        assert(disabled_connector_result);
+
+        source_connector_ = score::socom::Disabled_server_connector::enable(
+            std::move(disabled_connector_result).value());
+        assert(source_connector_);
+    }
+
+    void wait_for(bool const& flag) {
+        std::unique_lock<std::mutex> lock{state_mutex_};
+        auto const done = state_cv_.wait_for(lock, 10s, [&flag]() noexcept { return flag; });
+        (void)done;  // Avoid unused variable warning in non-debug builds
+        assert(done);
+    }
+
+    std::chrono::steady_clock::time_point wait_for_measured_event(score::socom::Event_state state) {
+        std::unique_lock<std::mutex> lock{state_mutex_};
+        state_cv_.wait(lock, [this, state]() noexcept {
+            return measured_event_state_ && measured_event_state_->state == state;
+        });
+        return measured_event_state_->time;
+    }
+
+    /// \brief Sends updates as fast as slots are released by the sink
+    void flood() {
+        while (!stop_flood_) {
+            auto payload = source_connector_->allocate_event_payload(k_flooded_event);
+            if (!payload) {
+                std::this_thread::yield();
+                continue;
+            }
+            (void)source_connector_->update_event(k_flooded_event, std::move(*payload));
+        }
+    }
+};
+
+/// state.range(0) selects the transport: 0 sends everything through the socket, where control
+/// messages queue up behind the flood, 1 uses a data ring with its control lane.
+void benchmark_control_latency_under_load(benchmark::State& state) {
+    Control_latency_benchmark_context context{state.range(0) != 0};
+
+    for (auto _ : state) {
+        auto const latency = context.subscribe_and_measure_once();
+        state.SetIterationTime(std::chrono::duration<double>(latency).count());
+    }
+}
+
+BENCHMARK(benchmark_control_latency_under_load)->Arg(0)->Arg(1)->UseManualTime();
+
+}  // namespace
+}  // namespace score::gateway_ipc_binding
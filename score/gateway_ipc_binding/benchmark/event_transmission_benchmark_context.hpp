@@ -14,6 +14,7 @@
 #include <benchmark/benchmark.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <atomic>
 #include <cassert>
 #include <chrono>
@@ -89,7 +90,10 @@ class Event_transmission_benchmark_context final {
         gateway_server_.reset();
     }
 
-    [[nodiscard]] Result<std::chrono::nanoseconds> send_and_measure_once() {
+    /// \brief Sends one event update and waits until it is received
+    /// \param written_bytes Bytes of the payload to write, at least the sequence number is written
+    [[nodiscard]] Result<std::chrono::nanoseconds> send_and_measure_once(
+        std::size_t written_bytes = 0U) {
         auto const seq = ++sequence_;
         Result<socom::Writable_payload> payload_result = MakeUnexpected(
             socom::Server_connector_error::runtime_error_no_client_subscribed_for_event);
@@ -108,6 +112,10 @@ class Event_transmission_benchmark_context final {
                                       runtime_error_shared_memory_allocation_failed);
         }
 
+        if (written_bytes > sizeof(seq)) {
+            std::memset(writable.data() + sizeof(seq), 0,
+                        std::min(written_bytes, writable.size()) - sizeof(seq));
+        }
         std::memcpy(writable.data(), &seq, sizeof(seq));
 
         auto const start = std::chrono::steady_clock::now();
@@ -0,0 +1,126 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "event_transmission_benchmark_context.hpp"
+#include "score/gateway_ipc_binding/message_trace.hpp"
+
+using namespace std::chrono_literals;
+using score::gateway_ipc_binding::Message_direction;
+using score::gateway_ipc_binding::Message_trace_record;
+using score::gateway_ipc_binding::Message_trace_records;
+using score::gateway_ipc_binding::Message_type;
+
+namespace {
+
+void print_usage(char const* name) {
+    std::cerr << "Usage: " << name << " <trace file> [--max-speed] [--sent]\n"
+              << "  Replays the event updates of a message trace through a binding pair.\n"
+              << "  --max-speed  Sends each update as soon as the previous one is received,\n"
+              << "               instead of at its recorded time\n"
+              << "  --sent       Replays the sent instead of the received event updates\n";
+}
+
+std::chrono::nanoseconds percentile(std::vector<std::chrono::nanoseconds> const& sorted,
+                                    double fraction) {
+    auto const index = static_cast<std::size_t>(fraction * static_cast<double>(sorted.size() - 1U));
+    return sorted[index];
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+    bool max_speed = false;
+    auto direction = Message_direction::received;
+    for (int i = 2; i < argc; ++i) {
+        std::string const option{argv[i]};
+        if (option == "--max-speed") {
+            max_speed = true;
+        } else if (option == "--sent") {
+            direction = Message_direction::sent;
+        } else {
+            print_usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    std::ifstream file{argv[1], std::ios::binary};
+    auto const trace = score::gateway_ipc_binding::read_message_trace(file);
+    if (!trace) {
+        std::cerr << "Reading " << argv[1] << " failed: " << trace.error() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    Message_trace_records updates;
+    std::copy_if(trace->begin(), trace->end(), std::back_inserter(updates),
+                 [direction](Message_trace_record const& record) {
+                     return (record.type == Message_type::Event_update ||
+                             record.type == Message_type::Traced_event_update) &&
+                            record.direction == direction;
+                 });
+    if (updates.empty()) {
+        std::cerr << "The trace holds no event updates to replay" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // All updates share one event, whose slots fit the largest recorded payload
+    std::size_t slot_size = sizeof(std::uint64_t);
+    for (auto const& update : updates) {
+        slot_size = std::max<std::size_t>(slot_size, update.payload_bytes);
+    }
+    score::gateway_ipc_binding::Event_transmission_benchmark_context context(slot_size);
+
+    std::vector<std::chrono::nanoseconds> latencies;
+    latencies.reserve(updates.size());
+    auto const first_timestamp = std::chrono::nanoseconds{updates.front().timestamp_ns};
+    auto const start = std::chrono::steady_clock::now();
+    for (auto const& update : updates) {
+        if (!max_speed) {
+            std::this_thread::sleep_until(
+                start + (std::chrono::nanoseconds{update.timestamp_ns} - first_timestamp));
+        }
+        auto const latency = context.send_and_measure_once(update.payload_bytes);
+        if (!latency) {
+            std::cerr << "Replay failed at update " << latencies.size() << ": "
+                      << latency.error() << std::endl;
+            return EXIT_FAILURE;
+        }
+        latencies.push_back(latency.value());
+    }
+    auto const duration = std::chrono::steady_clock::now() - start;
+
+    std::sort(latencies.begin(), latencies.end());
+    auto const seconds = std::chrono::duration<double>(duration).count();
+    std::cout << "Replayed " << updates.size() << " event updates in "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(duration).count()
+              << " ms (" << static_cast<double>(updates.size()) / seconds << " updates/s)\n"
+              << "Latency p50: " << percentile(latencies, 0.5).count()
+              << " ns, p99: " << percentile(latencies, 0.99).count()
+              << " ns, max: " << latencies.back().count() << " ns" << std::endl;
+    return EXIT_SUCCESS;
+}
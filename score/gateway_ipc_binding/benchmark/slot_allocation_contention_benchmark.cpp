@@ -0,0 +1,103 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include <benchmark/benchmark.h>
+#include <unistd.h>
+
+#include <cassert>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "score/gateway_ipc_binding/shared_memory_slot_manager.hpp"
+
+namespace score::gateway_ipc_binding {
+namespace {
+
+constexpr std::size_t kSlot_count = 1024U;
+constexpr std::size_t kSlot_size = 64U;
+
+socom::Service_interface_identifier const interface{"com.benchmark.slot_contention",
+                                                    socom::Literal_tag{}, {1, 0}};
+socom::Service_instance const instance{"instance", socom::Literal_tag{}};
+
+Shared_memory_slot_manager::Uptr create_manager(Slot_allocation_strategy strategy) {
+    std::string const path = "/gateway_ipc_binding_slot_contention_" + std::to_string(getpid()) +
+                             "_" + std::to_string(static_cast<int>(strategy));
+    auto path_result = fixed_string_from_string<Shared_memory_path>(path);
+    assert(path_result && "Path should fit into fixed-size metadata path");
+    Shared_memory_metadata metadata{};
+    metadata.path = *path_result;
+    metadata.slot_size = kSlot_size;
+    metadata.slot_count = kSlot_count;
+
+    auto factory = Shared_memory_manager_factory::create(
+        {{interface, {{instance, metadata}}}}, strategy);
+    auto manager = factory->create(interface, instance);
+    assert(manager && "Slot manager creation failed");
+    return std::move(*manager);
+}
+
+Shared_memory_slot_manager& get_manager(Slot_allocation_strategy strategy) {
+    static auto const linear_scan = create_manager(Slot_allocation_strategy::linear_scan);
+    static auto const lock_free_free_list =
+        create_manager(Slot_allocation_strategy::lock_free_free_list);
+    return strategy == Slot_allocation_strategy::linear_scan ? *linear_scan
+                                                             : *lock_free_free_list;
+}
+
+/// Each iteration mirrors the event path: allocate a slot, add a consumer for a second recipient
+/// and release both references. state.range(0) slots are held for the whole run to emulate
+/// payloads still in flight, which lengthens the scan of the linear strategy.
+void benchmark_slot_allocation_contention(benchmark::State& state,
+                                          Slot_allocation_strategy strategy) {
+    auto& manager = get_manager(strategy);
+
+    std::vector<Shared_memory_slot_guard> in_flight;
+    if (state.thread_index() == 0) {
+        for (auto i = 0; i < state.range(0); ++i) {
+            auto guard = manager.allocate_slot();
+            assert(guard && "Prefilling the slot manager failed");
+            in_flight.push_back(std::move(*guard));
+        }
+    }
+
+    for (auto _ : state) {
+        auto guard = manager.allocate_slot();
+        if (!guard) {
+            state.SkipWithError("No slot available");
+            break;
+        }
+        auto shared = guard->share();
+        benchmark::DoNotOptimize(shared.get_memory().data());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_CAPTURE(benchmark_slot_allocation_contention, linear_scan,
+                  Slot_allocation_strategy::linear_scan)
+    ->Arg(0)
+    ->Arg(kSlot_count - 64U)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
+
+BENCHMARK_CAPTURE(benchmark_slot_allocation_contention, lock_free_free_list,
+                  Slot_allocation_strategy::lock_free_free_list)
+    ->Arg(0)
+    ->Arg(kSlot_count - 64U)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
+
+}  // namespace
+}  // namespace score::gateway_ipc_binding
@@ -39,6 +39,10 @@ enum class Shared_memory_manager_error : score::result::ErrorCode {
     logic_error_no_configuration_for_interface,
     /// No configuration found for the specified instance
     logic_error_no_configuration_for_instance,
+    /// Requested size exceeds the slot size of all slot classes
+    logic_error_requested_size_too_large,
+    /// Shared memory does not hold per-slot consumer counts
+    logic_error_no_consumer_counts,
 };
 
 score::result::Error MakeError(Shared_memory_manager_error code,
@@ -67,7 +71,11 @@ score::result::Error MakeError(Bidirectional_channel_error code,
 
 enum class Gateway_ipc_binding_error : score::result::ErrorCode {
     /// Data to be copied into container is larger than the container's maximum size
-    fixed_size_container_too_small
+    fixed_size_container_too_small,
+    /// Reading or writing a message trace failed
+    runtime_error_message_trace_io_failed,
+    /// Data read is no message trace of a supported version
+    runtime_error_invalid_message_trace,
 };
 
 score::result::Error MakeError(Gateway_ipc_binding_error code,
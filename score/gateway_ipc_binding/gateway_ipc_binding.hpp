@@ -14,12 +14,16 @@
 #ifndef SCORE_GATEWAY_IPC_BINDING_INCLUDE_SCORE_GATEWAY_IPC_BINDING_GATEWAY_IPC_BINDING
 #define SCORE_GATEWAY_IPC_BINDING_INCLUDE_SCORE_GATEWAY_IPC_BINDING_GATEWAY_IPC_BINDING
 
+#include <chrono>
 #include <climits>
 #include <cstddef>
 #include <cstdint>
+#include <optional>
 #include <score/span.hpp>
+#include <string>
 #include <string_view>
 #include <type_traits>
+#include <vector>
 
 #include "score/gateway_ipc_binding/fixed_size_container.hpp"
 #include "score/socom/event.hpp"
@@ -28,8 +32,9 @@
 
 namespace score::gateway_ipc_binding {
 
-/// \brief Maximum find service elements
-inline constexpr std::size_t kMax_find_service_elements = 16U;
+/// \brief Maximum find service elements and shared memory configs per Connect or
+///        Connect_continuation message
+inline constexpr std::size_t kMax_connect_page_size = 16U;
 
 /// \brief Maximum bytes for serialized service id
 inline constexpr std::size_t kMax_service_id_size = 64U;
@@ -40,6 +45,18 @@ inline constexpr std::size_t kMax_instance_id_size = 64U;
 inline constexpr std::size_t kMax_client_identifier_size = 64U;
 /// \brief Maximum shared memory path length (including null terminator)
 inline constexpr std::size_t kMax_shared_memory_path_size = NAME_MAX;
+/// \brief Maximum number of additional slot size classes per shared memory
+inline constexpr std::size_t kMax_slot_classes = 8U;
+/// \brief Maximum number of events with an individually configured slot size
+inline constexpr std::size_t kMax_event_slot_sizes = 64U;
+/// \brief Maximum number of events which can be configured as conflated
+inline constexpr std::size_t kMax_conflated_events = 64U;
+/// \brief Maximum number of event updates carried by one Event_update_batch
+inline constexpr std::size_t kMax_event_update_batch_size = 64U;
+/// \brief Maximum number of acknowledgements carried by one Payload_consumed_batch
+inline constexpr std::size_t kMax_payload_consumed_batch_size = 64U;
+/// \brief Default number of bytes per direction of a Data_ring_config
+inline constexpr std::size_t kDefault_data_ring_capacity = 64U * 1024U;
 
 /// \brief Message type identifiers for IPC framing
 enum class Message_type : std::uint8_t {
@@ -58,6 +75,14 @@ enum class Message_type : std::uint8_t {
     Event_update = 13,
     Event_update_request = 14,
     Payload_consumed = 15,
+    Event_update_batch = 16,
+    Payload_consumed_batch = 17,
+    Data_ring_doorbell = 18,
+    Connect_continuation = 19,
+    Declare_service = 20,
+    Service_snapshot = 21,
+    Traced_event_update = 22,
+    Traced_event_update_batch = 23,
 };
 
 /// \brief Service id in fixed-size form
@@ -96,6 +121,12 @@ Instance_id make_instance_id(score::socom::Service_instance const& instance) noe
 /// that handle has been closed.
 using Remote_handle = std::uint64_t;
 
+/// \brief Numeric key of a service instance, assigned by the sending side
+///
+/// Declared once per connection with Declare_service, all further messages about the service
+/// instance refer to it by this key instead of its service and instance id strings.
+using Service_key = std::uint32_t;
+
 /// \brief Method identifier
 using Method_id = socom::Method_id;
 
@@ -113,6 +144,9 @@ struct Shared_memory_handle {
 
 bool operator==(Shared_memory_handle const& lhs, Shared_memory_handle const& rhs) noexcept;
 
+/// \brief Slot index of a Shared_memory_handle that refers to an empty payload
+inline constexpr std::size_t kNo_payload_slot = socom::kNoSlotHandle;
+
 /// \brief Path to shared memory, in fixed-size form
 using Shared_memory_path = Fixed_string<kMax_shared_memory_path_size>;
 
@@ -133,15 +167,88 @@ Result<Shared_memory_path> make_shared_memory_path(std::string_view service_type
 Result<Shared_memory_path> make_counterpart_shared_memory_path(std::string_view service_type_name,
                                                                std::uint16_t service_id) noexcept;
 
+/// \brief Group of equally sized slots within one shared memory
+struct Slot_class {
+    std::size_t slot_size;
+    std::size_t slot_count;
+};
+
+bool operator==(Slot_class const& lhs, Slot_class const& rhs) noexcept;
+
+/// \brief Additional slot size classes of a shared memory, in layout order
+using Slot_classes = Fixed_size_container<Slot_class, kMax_slot_classes>;
+
+/// \brief Largest payload in bytes per event, indexed by Event_id. 0 means not configured.
+using Event_slot_sizes = Fixed_size_container<std::uint32_t, kMax_event_slot_sizes>;
+
+/// \brief Events of which peers only get the latest update, indexed by Event_id
+using Conflated_events = Fixed_size_container<bool, kMax_conflated_events>;
+
+/// \brief How consumers of peer shared memory hand slots back to the producer
+enum class Consumer_release : std::uint8_t {
+    /// \brief Each consumer sends Payload_consumed once it has processed a slot
+    payload_consumed_message,
+    /// \brief Each consumer decrements a per-slot consumer count stored in the shared memory
+    ///
+    /// Consumers map the shared memory writable. The producer reclaims slots whose consumer count
+    /// dropped to zero, so no Payload_consumed messages are exchanged.
+    shared_memory_consumer_count,
+};
+
 /// \brief Metadata needed to map and interpret peer shared memory
+///
+/// The shared memory starts with slot_count slots of slot_size bytes (the default class, handles
+/// 0 to slot_count-1). The slot_classes follow in the given order, each starting at an offset
+/// aligned to kSlot_class_alignment, with handles continuing where the previous class ended.
+/// With Consumer_release::shared_memory_consumer_count, one std::atomic<std::uint32_t> consumer
+/// count per slot handle follows the last class at an offset aligned to kSlot_class_alignment.
 struct Shared_memory_metadata {
     Shared_memory_path path;
     std::size_t slot_size;
     std::size_t slot_count;
+    /// \brief Additional classes of differently sized slots placed behind the default class
+    Slot_classes slot_classes;
+    /// \brief Largest payload of each event, used by the writer to pick the size class
+    Event_slot_sizes event_slot_sizes;
+    /// \brief How consumers release slots of this shared memory
+    Consumer_release consumer_release;
+    /// \brief Events of which a peer only gets the latest update, e.g. status and field events
+    ///
+    /// While a peer has not consumed an update of such an event yet, newer updates are held back
+    /// by the writer, each one replacing the one held back before. The peer gets the newest one
+    /// once it consumed the previous update. Only applies with
+    /// Consumer_release::payload_consumed_message.
+    Conflated_events conflated_events;
 };
 
+/// \brief Alignment of the first slot of every additional slot class
+inline constexpr std::size_t kSlot_class_alignment = 64U;
+
 bool operator==(Shared_memory_metadata const& lhs, Shared_memory_metadata const& rhs) noexcept;
 
+/// \brief Smallest slot size of the slot classes built by make_event_slot_layout
+inline constexpr std::size_t kMin_slot_class_size = 64U;
+
+/// \brief Lays out the slots of a shared memory holding events of different payload sizes
+///
+/// The layout keeps the sample_count slots of a single class sized for the largest event, but
+/// sizes each slot for the events allocating from it. Events smaller than the largest one are
+/// grouped into power of two slot classes, the others allocate from the default class. Every
+/// class gets one slot plus its share of the remaining slots by the number of events mapping to
+/// it, the default class also gets what is left after rounding. As smaller events fall back to
+/// larger classes once theirs is exhausted, the layout never needs more bytes than sample_count
+/// slots of the largest event. If there are more classes than kMax_slot_classes or than slots,
+/// the smallest classes are merged into the next larger one.
+///
+/// \param path Path of the shared memory
+/// \param event_slot_sizes Largest payload in bytes of each event, indexed by Event_id. With
+///        more events than Event_slot_sizes holds, all slots are sized for the largest event.
+/// \param sample_count Number of slots of the shared memory
+/// \return Metadata with path, slot sizes and counts set, all other members value-initialized
+Shared_memory_metadata make_event_slot_layout(Shared_memory_path const& path,
+                                              std::vector<std::size_t> const& event_slot_sizes,
+                                              std::size_t sample_count);
+
 struct Service_instance {
     Service service;
     Instance_id instance_id;
@@ -149,7 +256,11 @@ struct Service_instance {
 
 bool operator==(Service_instance const& lhs, Service_instance const& rhs) noexcept;
 
-using Find_service_elements = Fixed_size_container<Service_instance, kMax_find_service_elements>;
+/// \brief Service instances a client is interested in
+using Find_service_elements = std::vector<Service_instance>;
+
+/// \brief Part of the find service elements carried by one Connect or Connect_continuation
+using Find_service_page = Fixed_size_container<Service_instance, kMax_connect_page_size>;
 
 #define DECLARE_MESSAGE_TYPE(msg_type) static constexpr Message_type type = msg_type
 
@@ -160,6 +271,14 @@ struct Payload_consumed {
     Shared_memory_handle handle;
 };
 
+/// \brief Several Payload_consumed acknowledgements for the same peer in one message
+///
+/// Transmitted without unused entries, like Event_update_batch.
+struct Payload_consumed_batch {
+    DECLARE_MESSAGE_TYPE(Message_type::Payload_consumed_batch);
+    Fixed_size_container<Payload_consumed, kMax_payload_consumed_batch_size> entries;
+};
+
 /// \brief Shared memory configuration for a single service instance,
 /// sent by the client to the server in the Connect message.
 struct Service_shared_memory_config {
@@ -173,47 +292,123 @@ bool operator==(Service_shared_memory_config const& lhs,
 
 /// \brief Container of shared memory configurations, one entry per service instance
 /// that the server should be able to allocate shared memory for.
-using Shared_memory_configs =
-    Fixed_size_container<Service_shared_memory_config, kMax_find_service_elements>;
+using Shared_memory_configs = std::vector<Service_shared_memory_config>;
+
+/// \brief Part of the shared memory configurations carried by one Connect or Connect_continuation
+using Shared_memory_config_page =
+    Fixed_size_container<Service_shared_memory_config, kMax_connect_page_size>;
 
 /// \brief Initial IPC connection request
+///
+/// Carries the first kMax_connect_page_size find service elements and shared memory
+/// configurations. If the client has more, Connect_continuation messages with the following ones
+/// come next. The server handles the handshake once the message with complete set arrived.
 struct Connect {
     DECLARE_MESSAGE_TYPE(Message_type::Connect);
 
-    Find_service_elements find_service_elements;
+    Find_service_page find_service_elements;
     /// \brief Shared memory configuration for each service instance that the server is expected
     /// to allocate. Sent by the client so the server needs no upfront configuration.
-    Shared_memory_configs shared_memory_configs;
+    Shared_memory_config_page shared_memory_configs;
     Client_identifier identifier;
+    /// \brief Shared memory of the data ring offered by the client, empty if none is offered
+    Shared_memory_path data_ring_path;
+    /// \brief Bytes per direction of the offered data ring
+    std::uint32_t data_ring_capacity;
+    /// \brief No Connect_continuation follows
+    bool complete;
+};
+
+/// \brief Further find service elements and shared memory configurations of a Connect
+struct Connect_continuation {
+    DECLARE_MESSAGE_TYPE(Message_type::Connect_continuation);
+
+    Find_service_page find_service_elements;
+    Shared_memory_config_page shared_memory_configs;
+    /// \brief Last message of the handshake
+    bool complete;
 };
 
 /// \brief Initial IPC connection acknowledgement
 struct Connect_reply {
     DECLARE_MESSAGE_TYPE(Message_type::Connect_reply);
     bool status;
+    /// \brief The server opened the data ring offered in Connect. All further messages of both
+    ///        sides are sent through it.
+    bool data_ring;
+};
+
+/// \brief Wakes up the peer to read the data ring
+///
+/// Sent through the socket only when the reading side has announced in the data ring that it
+/// went idle, so a continuous stream of messages does not cause a wake-up per message.
+struct Data_ring_doorbell {
+    DECLARE_MESSAGE_TYPE(Message_type::Data_ring_doorbell);
+    /// \brief The next socket message was sent around its lane of the data ring, in place of a
+    ///        detour marker. Sent regardless of the reading side being idle.
+    bool detour;
+};
+
+/// \brief Assigns the sender's key to a service instance
+///
+/// Sent once per connection and service instance, before the first message using service_key.
+struct Declare_service {
+    DECLARE_MESSAGE_TYPE(Message_type::Declare_service);
+    Service_key service_key;
+    Service service_id;
+    Instance_id instance_id;
+};
+
+/// \brief State of one service instance in a Service_snapshot
+struct Service_snapshot_entry {
+    /// \brief Key of the sender, declared by this entry
+    Service_key service_key;
+    Service service_id;
+    Instance_id instance_id;
+    /// \brief Same as a Request_service with in_use set
+    bool requested;
+    /// \brief Same as an Offer_service with offered set
+    bool offered;
+};
+
+/// \brief Part of the service instances carried by one Service_snapshot
+using Service_snapshot_page = Fixed_size_container<Service_snapshot_entry, kMax_connect_page_size>;
+
+/// \brief Complete set of services the sender requests and offers on this connection
+///
+/// Sent by each side once per connection, right after the handshake, instead of one
+/// Declare_service, Request_service and Offer_service per service instance. Services which do not
+/// fit into one message continue in further Service_snapshot messages, the last one has complete
+/// set. The receiver compares the snapshot with the state it still has from the peer and only
+/// applies the difference: requests and offers missing from the snapshot are withdrawn, new ones
+/// are handled like the corresponding Request_service and Offer_service.
+/// Connected handles and event subscriptions are not part of it, they are established again with
+/// Connect_service and Subscribe_event.
+struct Service_snapshot {
+    DECLARE_MESSAGE_TYPE(Message_type::Service_snapshot);
+    Service_snapshot_page services;
+    /// \brief Last message of the snapshot
+    bool complete;
 };
 
 /// \brief Request to use or stop using a service
 struct Request_service {
     DECLARE_MESSAGE_TYPE(Message_type::Request_service);
-    Service service_id;
-    Instance_id instance_id;
+    Service_key service_key;
     bool in_use;
 };
 
 /// \brief Announce offered or withdrawn service
 struct Offer_service {
     DECLARE_MESSAGE_TYPE(Message_type::Offer_service);
-    Service service_id;
-    Instance_id instance_id;
+    Service_key service_key;
     bool offered;
 };
 
 /// \brief Request setup/teardown of service connection
 struct Connect_service {
     DECLARE_MESSAGE_TYPE(Message_type::Connect_service);
-    Service service_id;
-    Instance_id instance_id;
+    Service_key service_key;
     Remote_handle required_id;
     // Memory for method calls
     Shared_memory_metadata metadata;
@@ -232,28 +427,50 @@ struct Connect_service_reply {
 };
 
 /// \brief Method invocation request
+///
+/// The request payload is located in the caller's shared memory of the service. invocation_id is
+/// assigned by the caller and identifies the invocation in Call_method_reply and
+/// Cancel_method_call; it is unused for fire and forget calls.
 struct Call_method {
+    DECLARE_MESSAGE_TYPE(Message_type::Call_method);
     Remote_handle provided_id;
     Method_id method_id;
     bool fire_and_forget;
+    Method_invocation invocation_id;
     Shared_memory_handle payload;
 };
 
 /// \brief Identifier for an active method invocation
+///
+/// Reserved, invocation ids are assigned by the caller with Call_method.
 struct Call_method_handle {
     Remote_handle required_id;
     Method_invocation invocation_id;
 };
 
+/// \brief Kind of result carried by Call_method_reply, mirrors socom::Method_result
+enum class Method_result_kind : std::uint8_t {
+    application_return,
+    application_error,
+    /// error_code holds a socom::Error, there is no payload
+    error,
+};
+
 /// \brief Reply to method invocation
+///
+/// The reply payload is located in the callee's shared memory of the service.
 struct Call_method_reply {
+    DECLARE_MESSAGE_TYPE(Message_type::Call_method_reply);
     Remote_handle required_id;
     Method_invocation invocation_id;
+    Method_result_kind result_kind;
+    std::int32_t error_code;
     Shared_memory_handle payload;
 };
 
 /// \brief Cancel an active method invocation
 struct Cancel_method_call {
+    DECLARE_MESSAGE_TYPE(Message_type::Cancel_method_call);
     Remote_handle provided_id;
     Method_id method_id;
     Method_invocation invocation_id;
@@ -265,6 +482,9 @@ struct Subscribe_event {
     Remote_handle provided_id;
     Event_id event_id;
     bool subscribe;
+    /// \brief Updates with payload the producer may send before their slots are consumed, 0 for
+    ///        no limit
+    std::uint32_t credits;
 };
 
 /// \brief Event subscription acknowledgement (accept/reject)
@@ -274,6 +494,18 @@ struct Subscribe_event_reply {
     bool subscribed;
 };
 
+/// \brief Points in time of an event update at the producer, in nanoseconds of
+///        std::chrono::steady_clock
+///
+/// steady_clock is CLOCK_MONOTONIC, which all processes of a host share, so the consumer compares
+/// them with its own. Only sent with Latency_tracing enabled, see Traced_event_update.
+struct Event_timestamps {
+    /// \brief The producer allocated the payload
+    std::uint64_t allocated_ns;
+    /// \brief The producer sent the Event_update
+    std::uint64_t sent_ns;
+};
+
 /// \brief Event payload update
 struct Event_update {
     DECLARE_MESSAGE_TYPE(Message_type::Event_update);
@@ -282,6 +514,175 @@ struct Event_update {
     Shared_memory_handle payload;
 };
 
+/// \brief Several event payload updates for the same peer in one message
+///
+/// Only the first entries.size elements are transmitted, so the frame is shorter than
+/// sizeof(Message_frame<Event_update_batch>) unless the batch is full. The header's payload_size
+/// holds the number of transmitted payload bytes.
+struct Event_update_batch {
+    DECLARE_MESSAGE_TYPE(Message_type::Event_update_batch);
+    Fixed_size_container<Event_update, kMax_event_update_batch_size> entries;
+};
+
+/// \brief Event_update with the timestamps of the producer, sent instead of it by producers with
+///        Latency_tracing enabled
+struct Traced_event_update {
+    DECLARE_MESSAGE_TYPE(Message_type::Traced_event_update);
+    Event_update update;
+    Event_timestamps timestamps;
+};
+
+/// \brief Event_update_batch of Traced_event_update messages
+struct Traced_event_update_batch {
+    DECLARE_MESSAGE_TYPE(Message_type::Traced_event_update_batch);
+    Fixed_size_container<Traced_event_update, kMax_event_update_batch_size> entries;
+};
+
+/// \brief Sender-side policy for combining messages of one kind into a batch message
+///
+/// Messages for the same peer are collected and sent together when max_entries are pending,
+/// when the oldest pending message is max_delay old, when any other message is sent to that peer,
+/// or when the binding is asked to flush explicitly (end of a burst).
+/// max_entries <= 1 disables batching and every message is sent on its own immediately.
+/// max_delay of zero disables the deadline, pending messages then wait for one of the other
+/// triggers.
+struct Batching_policy {
+    std::size_t max_entries{1U};
+    std::chrono::microseconds max_delay{0};
+};
+
+/// \brief Batching of the messages a binding sends to its peers
+struct Message_batching {
+    /// \brief Event_update messages, combined into Event_update_batch
+    Batching_policy event_updates;
+    /// \brief Payload_consumed messages, combined into Payload_consumed_batch. Independent of
+    ///        max_entries, a batch is sent before it may hold back half of a peer's slots.
+    Batching_policy payload_consumed;
+};
+
+/// \brief Shared memory ring buffers carrying the messages of a client connection
+///
+/// The client creates one shared memory with a single-producer single-consumer ring per
+/// direction and offers it to the server in Connect. Once the server accepted it, all messages
+/// after the handshake are written to the rings instead of the socket. The socket only carries
+/// Data_ring_doorbell wake-ups for an idle reader. Control messages, e.g. Offer_service or
+/// Subscribe_event, use a separate lane of a quarter of the capacity, at least 4 KiB, and
+/// overtake event updates and method calls queued before them. A message which does not fit into
+/// its lane, or whose lane stays full for longer than full_ring_timeout, is sent through the socket
+/// in order with the ring messages; the next message uses the ring again.
+struct Data_ring_config {
+    /// \brief Path of the shared memory; empty disables the data ring
+    std::string path;
+    /// \brief Bytes of the data lane per direction, a power of two of at least 4 KiB
+    std::size_t capacity{kDefault_data_ring_capacity};
+    /// \brief How long a writer waits for space in a full ring before sending the message through
+    ///        the socket
+    std::chrono::microseconds full_ring_timeout{1000};
+};
+
+/// \brief How a busy polling thread waits between two polls of an empty data ring
+enum class Busy_poll_wait : std::uint8_t {
+    /// \brief CPU pause hint, lowest latency, the core stays busy
+    pause,
+    /// \brief std::this_thread::yield(), other threads on the core may run in between
+    yield,
+};
+
+/// \brief Low-latency reading of the data ring by a dedicated thread per connection
+///
+/// With a spin_budget above zero, each connection with a data ring gets a thread which takes over
+/// reading the incoming lanes after the first doorbell. It keeps polling them while messages
+/// arrive, so producers never have to ring the doorbell and no socket wake-up is on the path of a
+/// message. After spin_budget without a message it announces itself idle and blocks until the
+/// next doorbell, like the socket thread without busy polling. Connections without a data ring
+/// are not affected.
+struct Busy_poll {
+    std::chrono::microseconds spin_budget{0};
+    Busy_poll_wait wait{Busy_poll_wait::pause};
+    /// \brief CPU the polling threads are pinned to, not pinned if empty
+    std::optional<std::size_t> cpu;
+};
+
+/// \brief Handling of the messages a binding receives from its peers
+///
+/// With worker_count of zero, every message is handled by the thread receiving it. Otherwise,
+/// Event_update, Payload_consumed and method call messages are handed to worker_count threads,
+/// partitioned by peer and required_id or provided_id. Messages of one service connection keep
+/// their order, those of different connections are handled in parallel. All other messages are
+/// handled by the receiving thread, after the workers finished the messages received before them.
+struct Message_dispatch {
+    std::size_t worker_count{0U};
+};
+
+/// \brief How a producer handles an event update for a subscription without credits left
+enum class Credit_exhaustion : std::uint8_t {
+    /// \brief The update is not sent to this subscriber
+    drop_newest,
+    /// \brief Up to credits updates are held back and sent once credits return, the oldest held
+    ///        back update is dropped for a newer one
+    drop_oldest,
+    /// \brief The producer waits up to block_timeout for a credit, then drops the update
+    block,
+};
+
+/// \brief Credit-based flow control of event updates per subscription
+///
+/// As a consumer, a binding grants the producer credits for each event it subscribes to in
+/// Subscribe_event. Every Event_update with a payload takes a credit, the Payload_consumed of its
+/// slot returns it, so a slow consumer keeps at most credits slots of the producer busy. As a
+/// producer, a binding handles updates for subscriptions without credits left as on_exhausted says.
+///
+/// Credits of zero grant unlimited updates. Credits only apply to shared memory with
+/// Consumer_release::payload_consumed_message, conflated events have at most one update in flight
+/// anyway.
+struct Flow_control {
+    std::uint32_t credits{0U};
+    Credit_exhaustion on_exhausted{Credit_exhaustion::drop_newest};
+    std::chrono::microseconds block_timeout{1000};
+};
+
+/// \brief Part of the way of an event update from the producer's service to the consumer's
+enum class Latency_stage : std::uint8_t {
+    /// \brief Producer: payload allocated until the Event_update is sent
+    allocate_to_send,
+    /// \brief Event_update sent by the producer until received by the consumer
+    send_to_receive,
+    /// \brief Consumer: Event_update received until the local clients released the payload
+    receive_to_consume,
+    /// \brief Payload allocated by the producer until the consumer's local clients released it
+    allocate_to_consume,
+};
+
+/// \brief Latency distribution of one stage of the updates of an event
+///
+/// The percentiles are upper bounds of histogram buckets, which are at most 12.5% wide.
+struct Latency_histogram_summary {
+    Service service_id;
+    Instance_id instance_id;
+    Event_id event_id;
+    Latency_stage stage;
+    std::uint64_t count;
+    std::chrono::nanoseconds p50;
+    std::chrono::nanoseconds p99;
+    std::chrono::nanoseconds p999;
+    std::chrono::nanoseconds max;
+};
+
+/// \brief Latency distributions of all recorded events and stages
+using Latency_histogram_summaries = std::vector<Latency_histogram_summary>;
+
+/// \brief Recording of event update latencies, disabled by default
+///
+/// A producer with tracing enabled sends Traced_event_update instead of Event_update, stamped with
+/// the time its payload was allocated and the time it was sent, and records the stage
+/// allocate_to_send. A consumer with tracing enabled records the other stages for updates carrying
+/// timestamps, those ending with the consumption only for producers with
+/// Consumer_release::payload_consumed_message. Disabled, no clock is read and no timestamps are
+/// sent.
+struct Latency_tracing {
+    bool enabled{false};
+};
+
 /// \brief Request latest event update (field pull)
 struct Event_update_request {
     DECLARE_MESSAGE_TYPE(Message_type::Event_update_request);
@@ -293,11 +694,15 @@ static_assert(std::is_trivially_copyable_v<Fixed_string<kMax_service_id_size>>);
 static_assert(std::is_trivially_copyable_v<Client_identifier>);
 static_assert(std::is_trivially_copyable_v<Service>);
 static_assert(std::is_trivially_copyable_v<Shared_memory_handle>);
+static_assert(std::is_trivially_copyable_v<Slot_classes>);
 static_assert(std::is_trivially_copyable_v<Shared_memory_metadata>);
 static_assert(std::is_trivially_copyable_v<Service_shared_memory_config>);
 static_assert(std::is_trivially_copyable_v<Payload_consumed>);
 static_assert(std::is_trivially_copyable_v<Connect>);
+static_assert(std::is_trivially_copyable_v<Connect_continuation>);
 static_assert(std::is_trivially_copyable_v<Connect_reply>);
+static_assert(std::is_trivially_copyable_v<Declare_service>);
+static_assert(std::is_trivially_copyable_v<Service_snapshot>);
 static_assert(std::is_trivially_copyable_v<Request_service>);
 static_assert(std::is_trivially_copyable_v<Offer_service>);
 static_assert(std::is_trivially_copyable_v<Connect_service>);
@@ -310,6 +715,11 @@ static_assert(std::is_trivially_copyable_v<Subscribe_event>);
 static_assert(std::is_trivially_copyable_v<Subscribe_event_reply>);
 static_assert(std::is_trivially_copyable_v<Event_update>);
 static_assert(std::is_trivially_copyable_v<Event_update_request>);
+static_assert(std::is_trivially_copyable_v<Event_update_batch>);
+static_assert(std::is_trivially_copyable_v<Traced_event_update>);
+static_assert(std::is_trivially_copyable_v<Traced_event_update_batch>);
+static_assert(std::is_trivially_copyable_v<Payload_consumed_batch>);
+static_assert(std::is_trivially_copyable_v<Data_ring_doorbell>);
 
 }  // namespace score::gateway_ipc_binding
 
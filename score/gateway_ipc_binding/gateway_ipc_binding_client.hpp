@@ -14,17 +14,30 @@
 #ifndef SCORE_GATEWAY_IPC_BINDING_INCLUDE_SCORE_GATEWAY_IPC_BINDING_GATEWAY_IPC_BINDING_CLIENT
 #define SCORE_GATEWAY_IPC_BINDING_INCLUDE_SCORE_GATEWAY_IPC_BINDING_GATEWAY_IPC_BINDING_CLIENT
 
+#include <chrono>
+#include <cstdint>
 #include <memory>
 #include <score/memory.hpp>
 #include <string_view>
 
 #include "score/gateway_ipc_binding/gateway_ipc_binding.hpp"
+#include "score/gateway_ipc_binding/message_trace.hpp"
 #include "score/gateway_ipc_binding/shared_memory_slot_manager.hpp"
 #include "score/message_passing/i_client_connection.h"
 #include "score/socom/runtime.hpp"
 
 namespace score::gateway_ipc_binding {
 
+/// \brief Lifecycle of the connection of a Gateway_ipc_binding_client to the server
+enum class Client_state : std::uint8_t {
+    /// \brief Waiting for the transport and `Connect_reply`, also after a lost connection
+    connecting,
+    /// \brief `Connect_reply{status=true}` has been received
+    connected,
+    /// \brief The transport was stopped on purpose and is not restarted
+    stopped
+};
+
 /// \brief Client-side transport endpoint for Gateway IPC Binding
 /// \details Owns one outgoing `score::message_passing` connection and forwards all
 ///          Gateway IPC binding protocol handling into the shared binding base.
@@ -56,6 +69,14 @@ class Gateway_ipc_binding_client {
     ///        that the server is expected to create. Sent to the server in the Connect message so
     ///        the server needs no upfront static configuration.
     /// \param identifier Optional string identifying this client peer to the server
+    /// \param batching Batching of messages sent to the server
+    /// \param data_ring Shared memory rings replacing the socket for all messages after the
+    ///        handshake, disabled by default
+    /// \param dispatch Handling of messages received from the server
+    /// \param flow_control Credits granted for subscribed events and handling of exhausted credits
+    /// \param latency_tracing Recording of event update latencies, disabled by default
+    /// \param message_tracing Recording of the messages received from and sent to the server
+    /// \param busy_poll Reading of the data ring by a dedicated polling thread, disabled by default
     /// \return Unique pointer to the created client
     static std::unique_ptr<Gateway_ipc_binding_client> create(
         score::socom::Runtime& runtime,
@@ -63,7 +84,10 @@ class Gateway_ipc_binding_client {
         score::gateway_ipc_binding::Shared_memory_manager_factory::Uptr slot_manager,
         Find_service_elements find_service_elements = {},
         Shared_memory_configs server_shared_memory_configs = {},
-        std::string_view identifier = {}) noexcept;
+        std::string_view identifier = {}, Message_batching batching = {},
+        Data_ring_config data_ring = {}, Message_dispatch dispatch = {},
+        Flow_control flow_control = {}, Latency_tracing latency_tracing = {},
+        Message_tracing message_tracing = {}, Busy_poll busy_poll = {}) noexcept;
 
     /// \brief Virtual destructor
     virtual ~Gateway_ipc_binding_client() = default;
@@ -71,6 +95,36 @@ class Gateway_ipc_binding_client {
     /// \brief Returns true after `Connect_reply{status=true}` has been received
     virtual bool is_connected() const noexcept = 0;
 
+    /// \brief Current state of the connection to the server
+    virtual Client_state get_state() const noexcept = 0;
+
+    /// \brief Blocks until the client reaches state or timeout passed
+    /// \return True if the client is in state
+    virtual bool wait_for_state(Client_state state,
+                                std::chrono::milliseconds timeout) const noexcept = 0;
+
+    /// \brief Non-blocking file descriptor that becomes readable on each change of get_state(),
+    ///        e.g. to wait for the connection in a poll() loop together with other descriptors
+    ///
+    /// Reading from it clears it. The descriptor is owned by the client and stays valid until the
+    /// client is destroyed.
+    /// \return The descriptor, -1 if it could not be created
+    virtual int get_state_fd() const noexcept = 0;
+
+    /// \brief Sends the pending Event_update batch without waiting for its deadline, e.g. at the
+    ///        end of a burst of updates
+    virtual void flush_event_updates() noexcept = 0;
+
+    /// \brief Latency distributions of the event updates sent and received so far
+    /// \return One entry per service instance, event and Latency_stage with recorded updates,
+    ///         empty unless created with Latency_tracing enabled
+    virtual Latency_histogram_summaries get_latency_histograms() noexcept = 0;
+
+    /// \brief Most recent messages received and sent, per thread up to
+    ///        Message_tracing::records_per_thread, e.g. for write_message_trace()
+    /// \return Records ordered by timestamp
+    virtual Message_trace_records get_message_trace() const noexcept = 0;
+
    protected:
     Gateway_ipc_binding_client() = default;
     Gateway_ipc_binding_client(Gateway_ipc_binding_client const&) = delete;
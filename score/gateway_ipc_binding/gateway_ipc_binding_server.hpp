@@ -20,6 +20,7 @@
 #include <unordered_map>
 
 #include "score/gateway_ipc_binding/gateway_ipc_binding.hpp"
+#include "score/gateway_ipc_binding/message_trace.hpp"
 #include "score/gateway_ipc_binding/shared_memory_slot_manager.hpp"
 #include "score/message_passing/i_server.h"
 #include "score/result/result.h"
@@ -55,12 +56,22 @@ class Gateway_ipc_binding_server {
     ///        The factory may be constructed with an empty configuration; per-service shared memory
     ///        configuration is registered dynamically when a client's Connect message is received.
     /// \param on_find_service_change callback invoked on connect/disconnect find-service updates
+    /// \param batching Batching of messages sent to the clients
+    /// \param dispatch Handling of messages received from the clients
+    /// \param flow_control Credits granted for subscribed events and handling of exhausted credits
+    /// \param latency_tracing Recording of event update latencies, disabled by default
+    /// \param message_tracing Recording of the messages received from and sent to the clients
+    /// \param busy_poll Reading of the data rings offered by clients by dedicated polling threads,
+    ///        disabled by default
     /// \return Unique pointer to the created server
     static std::unique_ptr<Gateway_ipc_binding_server> create(
         score::socom::Runtime& runtime,
         score::cpp::pmr::unique_ptr<score::message_passing::IServer> server,
         score::gateway_ipc_binding::Shared_memory_manager_factory::Uptr slot_manager,
-        On_find_service_change on_find_service_change) noexcept;
+        On_find_service_change on_find_service_change, Message_batching batching = {},
+        Message_dispatch dispatch = {}, Flow_control flow_control = {},
+        Latency_tracing latency_tracing = {}, Message_tracing message_tracing = {},
+        Busy_poll busy_poll = {}) noexcept;
 
     /// \brief Virtual destructor
     virtual ~Gateway_ipc_binding_server() = default;
@@ -76,6 +87,20 @@ class Gateway_ipc_binding_server {
     /// \return Map from Client_id to Client_info
     virtual std::unordered_map<Client_id, Client_info> get_client_identifiers() const noexcept = 0;
 
+    /// \brief Sends the pending Event_update batches without waiting for their deadlines, e.g. at
+    ///        the end of a burst of updates
+    virtual void flush_event_updates() noexcept = 0;
+
+    /// \brief Latency distributions of the event updates sent and received so far
+    /// \return One entry per service instance, event and Latency_stage with recorded updates,
+    ///         empty unless created with Latency_tracing enabled
+    virtual Latency_histogram_summaries get_latency_histograms() noexcept = 0;
+
+    /// \brief Most recent messages received and sent, per thread up to
+    ///        Message_tracing::records_per_thread, e.g. for write_message_trace()
+    /// \return Records ordered by timestamp
+    virtual Message_trace_records get_message_trace() const noexcept = 0;
+
    protected:
     Gateway_ipc_binding_server() = default;
     Gateway_ipc_binding_server(Gateway_ipc_binding_server const&) = delete;
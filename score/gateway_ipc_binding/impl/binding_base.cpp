@@ -13,13 +13,19 @@
 
 #include "binding_base.hpp"
 
+#include <algorithm>
 #include <cassert>
+#include <cstddef>
 #include <iostream>
+#include <iterator>
 #include <memory>
 #include <optional>
 #include <ostream>
+#include <type_traits>
 #include <utility>
+#include <variant>
 
+#include "compact_frame.hpp"
 #include "gateway_ipc_binding_util.hpp"
 #include "score/gateway_ipc_binding/error.hpp"
 #include "shared_memory_payload.hpp"
@@ -41,11 +47,60 @@ void log_it_impl(Args... args) {
 
 namespace score::gateway_ipc_binding {
 
+namespace {
+
+void fail_method_call(Pending_method_calls::Pending_method_call const& call,
+                      score::socom::Error error) {
+    if (call.reply_data) {
+        call.reply_data->reply(error);
+    }
+}
+
+void fail_method_calls(std::vector<Pending_method_calls::Pending_method_call> const& calls,
+                       score::socom::Error error) {
+    for (auto const& call : calls) {
+        fail_method_call(call, error);
+    }
+}
+
+}  // namespace
+
 Gateway_ipc_binding_base::Gateway_ipc_binding_base(score::socom::Runtime& runtime,
-                                                   Shared_memory_manager_factory::Sptr slot_manager)
-    : m_runtime(runtime),
+                                                   Shared_memory_manager_factory::Sptr slot_manager,
+                                                   Message_batching batching,
+                                                   Message_dispatch dispatch,
+                                                   Flow_control flow_control,
+                                                   Latency_tracing latency_tracing,
+                                                   Message_tracing message_tracing)
+    : m_message_trace(message_tracing),
+      m_runtime(runtime),
       m_slot_managers(slot_manager, m_keys),
-      m_read_only_slot_managers(std::move(slot_manager)) {
+      m_read_only_slot_managers(std::move(slot_manager)),
+      m_method_call_canceller(std::make_shared<Method_call_canceller>(
+          [this](Method_invocation invocation_id) { cancel_remote_method_call(invocation_id); })),
+      m_granted_credits(flow_control.credits),
+      m_event_credits(flow_control),
+      m_latencies(latency_tracing),
+      m_event_update_batches(
+          batching.event_updates, latency_tracing.enabled,
+          [this](Client_id client_id, Event_update const& update) {
+              event_update_lost_locked(client_id, update);
+          },
+          [this](Batch_clock::time_point deadline) { m_batch_flush_timer->arm(deadline); }),
+      m_payload_consumed_batches(
+          batching.payload_consumed,
+          // The peer is gone or unreachable, like for an unbatched Payload_consumed
+          [](Client_id, Payload_consumed const&) {},
+          [this](Batch_clock::time_point deadline) { m_batch_flush_timer->arm(deadline); }) {
+    if (m_event_update_batches.has_deadline() || m_payload_consumed_batches.has_deadline()) {
+        m_batch_flush_timer.emplace([this](auto const now) { return flush_expired_batches(now); });
+    }
+    if (dispatch.worker_count > 0U) {
+        m_dispatcher.emplace(dispatch.worker_count, [this](Client_id client_id, auto const data) {
+            handle_data_message(client_id, data);
+        });
+    }
+
     // Create callbacks for service bridge registration
     auto request_service_callback =
         [this](score::socom::Service_interface_definition const& configuration,
@@ -62,30 +117,66 @@ Gateway_ipc_binding_base::Gateway_ipc_binding_base(score::socom::Runtime& runtim
 }
 
 Gateway_ipc_binding_base::~Gateway_ipc_binding_base() {
+    // Invocations held by local clients may outlive the binding
+    m_method_call_canceller->detach();
+
     score::socom::Service_bridge_registration bridge_registration;
-    std::vector<score::socom::Client_connector::Uptr> client_connectors;
-    std::lock_guard<std::recursive_mutex> const lock{m_mutex};
-    bridge_registration = std::move(m_bridge_registration);
-    client_connectors = m_service_states.release_client_connectors();
+    std::vector<std::shared_ptr<score::socom::Client_connector>> client_connectors;
+    std::vector<score::socom::Method_invocation::Uptr> cancelled_method_calls;
+    std::vector<Pending_method_calls::Pending_method_call> failed_method_calls;
+    {
+        std::lock_guard<Striped_mutex> const lock{m_mutex};
+        bridge_registration = std::move(m_bridge_registration);
+        client_connectors = m_service_states.release_client_connectors();
+        cancelled_method_calls =
+            m_active_method_calls.take_if([](auto, auto const&) { return true; });
+        failed_method_calls = m_pending_method_calls.take_if([](auto const&) { return true; });
+    }
+    fail_method_calls(failed_method_calls,
+                      score::socom::Error::runtime_error_service_not_available);
 }
 
 void Gateway_ipc_binding_base::register_shared_memory_configurations(
     Shared_memory_configs const& configs) noexcept {
-    std::lock_guard<std::recursive_mutex> const lock{m_mutex};
+    std::lock_guard<Striped_mutex> const lock{m_mutex};
     m_slot_managers.register_configuration(configs);
 }
 
 void Gateway_ipc_binding_base::add_client(Client_id const& client_id,
                                           Reply_channel& reply_channel) {
-    std::lock_guard<std::recursive_mutex> const lock{m_mutex};
+    std::lock_guard<Striped_mutex> const lock{m_mutex};
+    m_connections.add_client(client_id, reply_channel);
+}
+
+void Gateway_ipc_binding_base::add_client_with_service_snapshot(Client_id const& client_id,
+                                                                Reply_channel& reply_channel) {
+    std::lock_guard<Striped_mutex> const lock{m_mutex};
     m_connections.add_client(client_id, reply_channel);
+    send_service_snapshot_locked(client_id, reply_channel);
 }
 
 void Gateway_ipc_binding_base::remove_client(Client_id const& client_id) {
-    std::vector<score::socom::Enabled_server_connector::Uptr> removed_connectors;
-    std::lock_guard<std::recursive_mutex> const lock{m_mutex};
-    m_connections.remove_client(client_id);
-    removed_connectors = remove_client_state_locked(client_id);
+    if (m_dispatcher) {
+        m_dispatcher->wait_idle();
+    }
+
+    std::vector<std::shared_ptr<score::socom::Enabled_server_connector>> removed_connectors;
+    std::vector<score::socom::Method_invocation::Uptr> cancelled_method_calls;
+    std::vector<Pending_method_calls::Pending_method_call> failed_method_calls;
+    {
+        std::lock_guard<Striped_mutex> const lock{m_mutex};
+        m_event_update_batches.remove_client(client_id);
+        m_payload_consumed_batches.remove_client(client_id);
+        m_connections.remove_client(client_id);
+        release_dropped_updates_locked(m_event_credits.remove_client(client_id));
+        removed_connectors = remove_client_state_locked(client_id);
+        cancelled_method_calls = m_active_method_calls.take_if(
+            [client_id](Client_id id, auto const&) { return id == client_id; });
+        failed_method_calls = m_pending_method_calls.take_if(
+            [client_id](auto const& call) { return call.client_id == client_id; });
+    }
+    fail_method_calls(failed_method_calls,
+                      score::socom::Error::runtime_error_service_not_available);
 }
 
 void Gateway_ipc_binding_base::on_receive_message(Client_id client_id, Reply_channel& conn,
@@ -94,45 +185,88 @@ void Gateway_ipc_binding_base::on_receive_message(Client_id client_id, Reply_cha
         return;  // Ignore empty messages
     }
 
+    m_message_trace.record(client_id, Message_direction::received, data);
+    if (m_dispatcher) {
+        if (dispatch_data_message(client_id, data)) {
+            return;
+        }
+        // Any other message must see the effects of the data messages received before it
+        m_dispatcher->wait_idle();
+    }
+    handle_control_message(client_id, conn, data);
+}
+
+void Gateway_ipc_binding_base::on_receive_control_message(
+    Client_id client_id, Reply_channel& conn, score::cpp::span<std::uint8_t const> data) {
+    if (data.empty()) {
+        return;  // Ignore empty messages
+    }
+
+    m_message_trace.record(client_id, Message_direction::received, data);
+    handle_control_message(client_id, conn, data);
+}
+
+void Gateway_ipc_binding_base::handle_control_message(Client_id client_id, Reply_channel& conn,
+                                                      score::cpp::span<std::uint8_t const> data) {
     auto message_type = get_message_type(data[0]);
     log_it("message_type == ", static_cast<int>(message_type));
     switch (message_type) {
         case Message_type::Connect: {
-            auto msg_opt = check_and_cast<Connect>(data);
+            auto const msg_opt = decode_compact_frame<Connect>(data);
+            if (!msg_opt || !msg_opt->complete) {
+                // Invalid message or Connect_continuation follows - log and ignore
+                return;
+            }
+
+            handle_connect_message(client_id, conn);
+            break;
+        }
+        case Message_type::Connect_continuation: {
+            auto const msg_opt = decode_compact_frame<Connect_continuation>(data);
+            if (!msg_opt || !msg_opt->complete) {
+                return;
+            }
+
+            handle_connect_message(client_id, conn);
+            break;
+        }
+        case Message_type::Connect_reply:
+            // Handled by the client, which sent its Service_snapshot together with Connect
+            break;
+        case Message_type::Declare_service: {
+            auto const msg_opt = decode_compact_frame<Declare_service>(data);
             if (!msg_opt) {
-                // Invalid message - log and ignore
                 return;
             }
 
-            handle_connect_message(client_id, conn, **msg_opt);
+            handle_declare_service_message(client_id, *msg_opt);
             break;
         }
-        case Message_type::Connect_reply: {
-            auto msg_opt = check_and_cast<Connect_reply>(data);
+        case Message_type::Service_snapshot: {
+            auto const msg_opt = decode_compact_frame<Service_snapshot>(data);
             if (!msg_opt) {
-                // Invalid message - log and ignore
                 return;
             }
 
-            handle_connect_reply_message(**msg_opt);
+            handle_service_snapshot_message(client_id, conn, *msg_opt);
             break;
         }
         case Message_type::Connect_service: {
-            auto msg_opt = check_and_cast<Connect_service>(data);
+            auto const msg_opt = decode_compact_frame<Connect_service>(data);
             if (!msg_opt) {
                 return;
             }
 
-            handle_connect_service_message(client_id, conn, **msg_opt);
+            handle_connect_service_message(client_id, conn, *msg_opt);
             break;
         }
         case Message_type::Connect_service_reply: {
-            auto msg_opt = check_and_cast<Connect_service_reply>(data);
+            auto const msg_opt = decode_compact_frame<Connect_service_reply>(data);
             if (!msg_opt) {
                 return;
             }
 
-            handle_connect_service_reply_message(client_id, **msg_opt);
+            handle_connect_service_reply_message(client_id, *msg_opt);
             break;
         }
         case Message_type::Request_service: {
@@ -153,6 +287,15 @@ void Gateway_ipc_binding_base::on_receive_message(Client_id client_id, Reply_cha
             handle_offer_service_message(client_id, **msg_opt);
             break;
         }
+        default:
+            handle_data_message(client_id, data);
+            break;
+    }
+}
+
+void Gateway_ipc_binding_base::handle_data_message(Client_id client_id,
+                                                   score::cpp::span<std::uint8_t const> data) {
+    switch (get_message_type(data[0])) {
         case Message_type::Subscribe_event: {
             auto msg_opt = check_and_cast<Subscribe_event>(data);
             if (!msg_opt) {
@@ -171,6 +314,67 @@ void Gateway_ipc_binding_base::on_receive_message(Client_id client_id, Reply_cha
             handle_event_update_message(client_id, **msg_opt);
             break;
         }
+        case Message_type::Event_update_batch: {
+            auto msg_opt = check_and_cast_batch<Event_update_batch>(data);
+            if (!msg_opt) {
+                return;
+            }
+
+            auto const& updates = (*msg_opt)->entries;
+            for (std::size_t i = 0U; i < updates.size; ++i) {
+                handle_event_update_message(client_id, updates.data[i]);
+            }
+            break;
+        }
+        case Message_type::Traced_event_update: {
+            auto msg_opt = check_and_cast<Traced_event_update>(data);
+            if (!msg_opt) {
+                return;
+            }
+
+            handle_event_update_message(client_id, (*msg_opt)->update, (*msg_opt)->timestamps);
+            break;
+        }
+        case Message_type::Traced_event_update_batch: {
+            auto msg_opt = check_and_cast_batch<Traced_event_update_batch>(data);
+            if (!msg_opt) {
+                return;
+            }
+
+            auto const& updates = (*msg_opt)->entries;
+            for (std::size_t i = 0U; i < updates.size; ++i) {
+                handle_event_update_message(client_id, updates.data[i].update,
+                                            updates.data[i].timestamps);
+            }
+            break;
+        }
+        case Message_type::Call_method: {
+            auto msg_opt = check_and_cast<Call_method>(data);
+            if (!msg_opt) {
+                return;
+            }
+
+            handle_call_method_message(client_id, **msg_opt);
+            break;
+        }
+        case Message_type::Call_method_reply: {
+            auto msg_opt = check_and_cast<Call_method_reply>(data);
+            if (!msg_opt) {
+                return;
+            }
+
+            handle_call_method_reply_message(client_id, **msg_opt);
+            break;
+        }
+        case Message_type::Cancel_method_call: {
+            auto msg_opt = check_and_cast<Cancel_method_call>(data);
+            if (!msg_opt) {
+                return;
+            }
+
+            handle_cancel_method_call_message(client_id, **msg_opt);
+            break;
+        }
         case Message_type::Payload_consumed: {
             auto msg_opt = check_and_cast<Payload_consumed>(data);
             if (!msg_opt) {
@@ -180,6 +384,18 @@ void Gateway_ipc_binding_base::on_receive_message(Client_id client_id, Reply_cha
             handle_payload_consumed_message(client_id, **msg_opt);
             break;
         }
+        case Message_type::Payload_consumed_batch: {
+            auto msg_opt = check_and_cast_batch<Payload_consumed_batch>(data);
+            if (!msg_opt) {
+                return;
+            }
+
+            auto const& acknowledgements = (*msg_opt)->entries;
+            for (std::size_t i = 0U; i < acknowledgements.size; ++i) {
+                handle_payload_consumed_message(client_id, acknowledgements.data[i]);
+            }
+            break;
+        }
         default:
             // Unhandled message type - log and ignore
             assert(false);
@@ -187,62 +403,226 @@ void Gateway_ipc_binding_base::on_receive_message(Client_id client_id, Reply_cha
     }
 }
 
-void Gateway_ipc_binding_base::handle_connect_message(Client_id /*client_id*/, Reply_channel& conn,
-                                                      Connect const& /*msg*/) {
+bool Gateway_ipc_binding_base::dispatch_data_message(Client_id client_id,
+                                                     score::cpp::span<std::uint8_t const> data) {
+    // Messages of one service connection go to the same worker, which keeps them in order.
+    // Invalid messages are dropped here, like they would be when handled.
+    auto const dispatch = [this, client_id](Remote_handle id, auto const& msg) {
+        Message_frame<std::decay_t<decltype(msg)>> frame;
+        frame.payload = msg;
+        m_dispatcher->dispatch(static_cast<std::size_t>(id) + client_id, client_id,
+                               {reinterpret_cast<std::uint8_t const*>(&frame), sizeof(frame)});
+    };
+
+    auto const type = get_message_type(data[0]);
+    if (!is_data_message(type)) {
+        return false;
+    }
+
+    switch (type) {
+        case Message_type::Event_update:
+            if (auto const msg_opt = check_and_cast<Event_update>(data)) {
+                dispatch((*msg_opt)->required_id, **msg_opt);
+            }
+            return true;
+        case Message_type::Event_update_batch:
+            if (auto const msg_opt = check_and_cast_batch<Event_update_batch>(data)) {
+                auto const& updates = (*msg_opt)->entries;
+                for (std::size_t i = 0U; i < updates.size; ++i) {
+                    dispatch(updates.data[i].required_id, updates.data[i]);
+                }
+            }
+            return true;
+        case Message_type::Traced_event_update:
+            if (auto const msg_opt = check_and_cast<Traced_event_update>(data)) {
+                dispatch((*msg_opt)->update.required_id, **msg_opt);
+            }
+            return true;
+        case Message_type::Traced_event_update_batch:
+            if (auto const msg_opt = check_and_cast_batch<Traced_event_update_batch>(data)) {
+                auto const& updates = (*msg_opt)->entries;
+                for (std::size_t i = 0U; i < updates.size; ++i) {
+                    dispatch(updates.data[i].update.required_id, updates.data[i]);
+                }
+            }
+            return true;
+        case Message_type::Payload_consumed:
+            if (auto const msg_opt = check_and_cast<Payload_consumed>(data)) {
+                dispatch((*msg_opt)->required_id, **msg_opt);
+            }
+            return true;
+        case Message_type::Payload_consumed_batch:
+            if (auto const msg_opt = check_and_cast_batch<Payload_consumed_batch>(data)) {
+                auto const& acknowledgements = (*msg_opt)->entries;
+                for (std::size_t i = 0U; i < acknowledgements.size; ++i) {
+                    dispatch(acknowledgements.data[i].required_id, acknowledgements.data[i]);
+                }
+            }
+            return true;
+        case Message_type::Call_method_reply:
+            if (auto const msg_opt = check_and_cast<Call_method_reply>(data)) {
+                dispatch((*msg_opt)->required_id, **msg_opt);
+            }
+            return true;
+        case Message_type::Call_method:
+            if (auto const msg_opt = check_and_cast<Call_method>(data)) {
+                dispatch((*msg_opt)->provided_id, **msg_opt);
+            }
+            return true;
+        case Message_type::Cancel_method_call:
+            if (auto const msg_opt = check_and_cast<Cancel_method_call>(data)) {
+                dispatch((*msg_opt)->provided_id, **msg_opt);
+            }
+            return true;
+        case Message_type::Subscribe_event:
+            if (auto const msg_opt = check_and_cast<Subscribe_event>(data)) {
+                dispatch((*msg_opt)->provided_id, **msg_opt);
+            }
+            return true;
+        default:
+            assert(false && "Data message without dispatch hint");
+            return true;
+    }
+}
+
+void Gateway_ipc_binding_base::handle_connect_message(Client_id /*client_id*/,
+                                                      Reply_channel& conn) {
     // serialize reply and send back to client
     Message_frame<Connect_reply> reply;
     reply.payload.status = true;
+    reply.payload.data_ring = conn.has_data_ring();
 
     (void)conn.send(reply);
+    if (reply.payload.data_ring) {
+        conn.activate_data_ring();
+    }
+    // The services requested here are sent in reply to the client's Service_snapshot
+}
+
+void Gateway_ipc_binding_base::handle_declare_service_message(
+    Client_id client_id, Declare_service const& msg) noexcept {
+    std::lock_guard<Striped_mutex> const lock{m_mutex};
+    m_peer_service_keys.add_remote(client_id, msg.service_key,
+                                   m_keys.get(msg.service_id, msg.instance_id));
+}
+
+void Gateway_ipc_binding_base::handle_service_snapshot_message(
+    Client_id client_id, Reply_channel& conn, Service_snapshot const& msg) noexcept {
+    log_it("complete == ", msg.complete);
+    // Destroyed and failed after releasing m_mutex, see handle_offer_service_message()
+    std::vector<std::shared_ptr<score::socom::Enabled_server_connector>> removed_connectors;
+    std::vector<Pending_method_calls::Pending_method_call> failed_method_calls;
 
-    // Re-send any pending Request_service messages that were sent before this client connected.
-    // Mirrors handle_connect_reply_message on the client side.
-    std::lock_guard<std::recursive_mutex> const lock{m_mutex};
-    m_service_states.for_each([&conn](auto const& key, auto& state) {
-        (void)key;
-        if (state.requested) {
-            Message_frame<Request_service> msg;
-            msg.payload.service_id = make_service(state.service);
-            msg.payload.instance_id = make_instance_id(state.instance);
-            msg.payload.in_use = true;
-            (void)conn.send(msg);
+    {
+        std::lock_guard<Striped_mutex> const lock{m_mutex};
+        for (std::size_t i = 0U; i < msg.services.size; ++i) {
+            auto const& entry = msg.services.data[i];
+            auto const key = m_keys.get(entry.service_id, entry.instance_id);
+            m_peer_service_keys.add_remote(client_id, entry.service_key, key);
+            m_service_snapshots.add_received(client_id, {key, entry.requested, entry.offered});
         }
-    });
+
+        if (msg.complete) {
+            apply_service_snapshot_locked(client_id, conn, removed_connectors,
+                                          failed_method_calls);
+        }
+    }
+    fail_method_calls(failed_method_calls,
+                      score::socom::Error::runtime_error_service_not_available);
 }
 
-void Gateway_ipc_binding_base::handle_connect_reply_message(Connect_reply const& msg) {
-    if (msg.status) {
-        std::lock_guard<std::recursive_mutex> const lock{m_mutex};
-        m_service_states.for_each([this](auto const& key, auto& state) {
-            (void)key;
-            if (state.requested) {
-                send_request_service_locked(make_service(state.service),
-                                            make_instance_id(state.instance), true);
-            }
+void Gateway_ipc_binding_base::apply_service_snapshot_locked(
+    Client_id client_id, Reply_channel& conn,
+    std::vector<std::shared_ptr<score::socom::Enabled_server_connector>>& removed_connectors,
+    std::vector<Pending_method_calls::Pending_method_call>& failed_method_calls) noexcept {
+    auto const entries = m_service_snapshots.take_received(client_id);
+    Key_map<bool> requested;
+    Key_map<bool> offered;
+    for (auto const& entry : entries) {
+        requested[entry.key] = requested[entry.key] || entry.requested;
+        offered[entry.key] = offered[entry.key] || entry.offered;
+    }
+    auto const is_set = [](Key_map<bool> const& flags, Key_t const& key) {
+        auto const* const flag = flags.find(key);
+        return flag != nullptr && *flag;
+    };
 
-            maybe_send_connect_service_locked(key, state);
+    // The snapshot is complete, whatever the peer still had before and left out is withdrawn
+    std::vector<Key_t> withdrawn_requests;
+    m_service_to_interested_peers.for_each(
+        [client_id, &requested, &is_set, &withdrawn_requests](Key_t const& key,
+                                                               std::set<Client_id> const& peers) {
+            if (peers.count(client_id) != 0U && !is_set(requested, key)) {
+                withdrawn_requests.push_back(key);
+            }
         });
+    std::vector<Key_t> withdrawn_offers;
+    m_service_states.for_each(
+        [client_id, &offered, &is_set, &withdrawn_offers](Key_t const& key,
+                                                           Service_state const& state) {
+            if (state.offers.count(client_id) != 0U && !is_set(offered, key)) {
+                withdrawn_offers.push_back(key);
+            }
+        });
+    for (auto const& key : withdrawn_requests) {
+        request_service_locked(client_id, conn, key, false);
+    }
+    for (auto const& key : withdrawn_offers) {
+        offer_service_locked(client_id, key, false, removed_connectors, failed_method_calls);
     }
+
+    // Services offered here already are part of the reply instead of one Offer_service each
+    auto const replies = !m_service_snapshots.is_sent(client_id);
+    for (auto const& entry : entries) {
+        if (entry.requested) {
+            auto& peers = m_service_to_interested_peers[entry.key];
+            auto const* const local_offer = m_local_offers.find(entry.key);
+            if (peers.count(client_id) != 0U) {
+                // Already handled
+            } else if (replies && local_offer != nullptr && *local_offer) {
+                peers.insert(client_id);
+            } else {
+                request_service_locked(client_id, conn, entry.key, true);
+            }
+        }
+        if (entry.offered) {
+            offer_service_locked(client_id, entry.key, true, removed_connectors,
+                                 failed_method_calls);
+        }
+    }
+
+    send_service_snapshot_locked(client_id, conn);
 }
 
 void Gateway_ipc_binding_base::handle_request_service_message(Client_id client_id,
                                                               Reply_channel& conn,
                                                               Request_service const& msg) noexcept {
     log_it("");
-    std::lock_guard<std::recursive_mutex> const lock{m_mutex};
-    auto const& key = m_keys.get(msg.service_id, msg.instance_id);
-    if (!msg.in_use) {
+    std::lock_guard<Striped_mutex> const lock{m_mutex};
+    auto const key_opt = m_peer_service_keys.find_remote(client_id, msg.service_key);
+    if (!key_opt) {
+        // Service instance was not declared by the peer - ignore
+        return;
+    }
+
+    request_service_locked(client_id, conn, *key_opt, msg.in_use);
+}
+
+void Gateway_ipc_binding_base::request_service_locked(Client_id client_id, Reply_channel& conn,
+                                                      Key_t const& key, bool in_use) noexcept {
+    if (!in_use) {
         m_service_states.remove_event_subscriptions_for_client(client_id);
         m_id_mapping.remove_mapping_for_client_and_key(client_id, key);
+        m_event_routes.remove_mapping_for_client_and_key(client_id, key);
         clear_pending_connects_for_key_locked(key, client_id);
         m_service_to_interested_peers[key].erase(client_id);
         return;
     }
 
     m_service_to_interested_peers[key].insert(client_id);
-    auto const local_offer = m_local_offers.find(key);
-    if (local_offer != m_local_offers.end() && local_offer->second) {
-        send_offer_service_to_client(conn, msg.service_id, msg.instance_id, true);
+    auto const* const local_offer = m_local_offers.find(key);
+    if (local_offer != nullptr && *local_offer) {
+        send_offer_service_to_client(client_id, conn, key, true);
         return;
     }
 
@@ -268,33 +648,78 @@ void Gateway_ipc_binding_base::handle_request_service_message(Client_id client_i
     log_it("Creating client connector for service request");
 
     // create Client_connector and send offer once Enabled_server_connector is available
-    auto const send_event_update = [this, key = key](score::socom::Client_connector const&,
-                                                     score::socom::Event_id event_id,
-                                                     score::socom::Payload payload) {
-        std::lock_guard<std::recursive_mutex> const lock{m_mutex};
-        std::size_t recipient_count{0U};
-
-        m_id_mapping.for_each_client(
-            key, [this, event_id, &payload, &recipient_count](Client_id client_id,
-                                                              Connection_metadata::Ids const& ids) {
-                Reply_channel* const conn = m_connections.get_reply_channel(client_id);
-                assert(conn != nullptr && "Connection not found for client_id");
-
-                if (conn == nullptr) {
-                    return;
-                }
+    auto const send_event_update = [this, key = key, &fan_out = m_event_fan_outs[key]](
+                                       score::socom::Client_connector const&,
+                                       score::socom::Event_id event_id,
+                                       score::socom::Payload payload) {
+        auto const slot_handle = payload.get_slot_handle();
+        auto const size = payload.data().size();
+
+        // Keeps the updates of the same service in order. Taken before the stripe, which is taken
+        // again under it while waiting for credits.
+        std::lock_guard<std::mutex> const fan_out_lock{fan_out.mutex};
+        // Recipients are sent to without the lock, a slow peer does not hold back other services.
+        // The fence keeps them from being removed until then.
+        std::optional<Striped_mutex::Writer_fence> fence;
+        {
+            Striped_mutex::Shared_lock const lock{m_mutex, key};
+            fan_out.recipients.clear();
+            m_id_mapping.for_each_client(
+                key, [this, &key, &fan_out, slot_handle](Client_id client_id,
+                                                          Connection_metadata::Ids const& ids) {
+                    Reply_channel* const conn = m_connections.get_reply_channel(client_id);
+                    assert(conn != nullptr && "Connection not found for client_id");
+
+                    if (conn != nullptr) {
+                        // The peer may consume the payload before send() returns
+                        m_slot_managers.add_peer_consumer(key, slot_handle);
+                        fan_out.recipients.push_back({client_id, conn, ids.remote_handle});
+                    }
+                });
+
+            // Kept for all recipients before sending, failed sends are released below
+            m_slot_managers.insert_allocation(key, std::move(payload), fan_out.recipients.size());
+            fence.emplace(lock);
+        }
 
-                Message_frame<Event_update> update_msg;
-                update_msg.payload.required_id = ids.remote_handle;
-                update_msg.payload.event_id = event_id;
-                update_msg.payload.payload = {payload.get_slot_handle(), payload.data().size()};
-                auto send_result = conn->send(update_msg);
-                if (send_result) {
-                    ++recipient_count;
-                }
-            });
+        auto const conflated = m_slot_managers.is_conflated(key, event_id);
+        std::unique_lock<std::mutex> conflation_lock{fan_out.conflation_mutex, std::defer_lock};
+        if (conflated) {
+            conflation_lock.lock();
+            // Held back updates of former recipients would never be sent
+            auto& updates = fan_out.conflated_updates;
+            auto const removed = std::remove_if(
+                updates.begin(), updates.end(), [this, &key, &fan_out](auto const& update) {
+                    auto const is_recipient = std::any_of(
+                        fan_out.recipients.begin(), fan_out.recipients.end(),
+                        [&update](auto const& recipient) {
+                            return recipient.client_id == update.client_id &&
+                                   recipient.required_id == update.required_id;
+                        });
+                    if (!is_recipient && update.held_back) {
+                        m_slot_managers.consumer_lost(key, update.held_back->slot_index);
+                    }
+                    return !is_recipient;
+                });
+            updates.erase(removed, updates.end());
+        }
 
-        m_slot_managers.insert_allocation(key, std::move(payload), recipient_count);
+        // Without Payload_consumed messages no credit would ever return
+        auto const flow_controlled = !conflated && m_slot_managers.is_consumption_acknowledged(key);
+        for (std::size_t index = 0U; index < fan_out.recipients.size(); ++index) {
+            auto const& recipient = fan_out.recipients[index];
+            if (recipient.conn == nullptr) {
+                continue;
+            }
+            Event_update const update{recipient.required_id, event_id, {slot_handle, size}};
+            auto const send_now =
+                conflated
+                    ? conflate_event_update(key, fan_out, recipient, update)
+                    : !flow_controlled || take_event_credit(key, fan_out, index, update, fence);
+            if (send_now) {
+                (void)send_event_update_to(key, fan_out.recipients[index], update);
+            }
+        }
     };
 
     auto const service_state_change =
@@ -302,12 +727,14 @@ void Gateway_ipc_binding_base::handle_request_service_message(Client_id client_i
                     score::socom::Service_state state,
                     score::socom::Server_service_interface_definition const& configuration) {
             log_it("");
-            std::lock_guard<std::recursive_mutex> const lock{m_mutex};
+            std::lock_guard<Striped_mutex> const lock{m_mutex};
 
             auto const is_available = state == score::socom::Service_state::available;
 
             if (!is_available) {
                 m_id_mapping.remove_service(key);
+                m_event_routes.remove_service(key);
+                release_dropped_updates_locked(m_event_credits.remove_service(key));
             }
 
             m_local_offers[key] = is_available;
@@ -324,17 +751,21 @@ void Gateway_ipc_binding_base::handle_request_service_message(Client_id client_i
                 Reply_channel* const conn = m_connections.get_reply_channel(client_id);
                 assert(conn != nullptr && "Connection not found for client_id");
 
-                send_offer_service_to_client(*conn, interface.get(), instance.get(), is_available);
+                send_offer_service_to_client(client_id, *conn, key, is_available);
             }
         };
 
     auto const event_payload_allocate =
         [this, key](
             score::socom::Client_connector const& /*connector*/,
-            score::socom::Event_id /*event_id*/) -> score::Result<score::socom::Writable_payload> {
-        std::lock_guard<std::recursive_mutex> const lock{m_mutex};
+            score::socom::Event_id event_id) -> score::Result<score::socom::Writable_payload> {
+        // Serialized with send_event_update, which keeps the slots reclaimed by the allocation
+        Striped_mutex::Shared_lock const lock{m_mutex, key};
 
-        auto allocation = m_slot_managers.get_shared_memory_slot_manager(key).allocate_slot();
+        auto allocation = m_slot_managers.allocate_slot(key, event_id);
+        if (allocation && m_latencies.is_enabled()) {
+            m_latencies.allocated(key, *allocation->get_handle(), Latency_histograms::now());
+        }
 
         return allocation.and_then([](auto& guard) {
             return Result<score::socom::Writable_payload>(
@@ -345,10 +776,14 @@ void Gateway_ipc_binding_base::handle_request_service_message(Client_id client_i
     score::socom::Client_connector::Callbacks client_callbacks{
         service_state_change, send_event_update, send_event_update, event_payload_allocate};
 
-    m_service_states.mark_client_connector_pending(key, msg.service_id, msg.instance_id);
+    auto const interface_instance_opt = m_keys.get(key);
+    assert(interface_instance_opt.has_value() && "Interface and instance should exist for key");
+    auto const& [service, instance_id] = interface_instance_opt.value();
+
+    m_service_states.mark_client_connector_pending(key, service.get(), instance_id.get());
     auto client_connector_result = m_runtime.make_client_connector(
-        score::socom::Service_interface_definition{msg.service_id.to_socom_identifier()},
-        socom::Service_instance{fixed_string_to_string(msg.instance_id)},
+        score::socom::Service_interface_definition{service.get().to_socom_identifier()},
+        socom::Service_instance{fixed_string_to_string(instance_id.get())},
         std::move(client_callbacks));
 
     if (client_connector_result) {
@@ -365,26 +800,54 @@ void Gateway_ipc_binding_base::handle_offer_service_message(Client_id client_id,
     // avoids lock-order-inversion, mutexes are locked in different order in this class and
     // socom, whether a socom callback was called or we received an IPC message and act on it
     // using socom
-    score::socom::Enabled_server_connector::Uptr removed_connector;
+    std::vector<std::shared_ptr<score::socom::Enabled_server_connector>> removed_connectors;
+    std::vector<Pending_method_calls::Pending_method_call> failed_method_calls;
 
-    std::lock_guard<std::recursive_mutex> const lock{m_mutex};
-    auto const& key = m_keys.get(msg.service_id, msg.instance_id);
-    auto state = m_service_states.process_offer(key, client_id, msg);
-    removed_connector = std::move(state.connector);
+    {
+        std::lock_guard<Striped_mutex> const lock{m_mutex};
+        auto const key_opt = m_peer_service_keys.find_remote(client_id, msg.service_key);
+        if (!key_opt) {
+            return;
+        }
 
-    if (!msg.offered) {
-        m_service_states.clear_event_subscriptions(key);
-        m_id_mapping.remove_service(key);
-        clear_pending_connects_for_key_locked(key, client_id);
+        offer_service_locked(client_id, *key_opt, msg.offered, removed_connectors,
+                             failed_method_calls);
+    }
+    fail_method_calls(failed_method_calls,
+                      score::socom::Error::runtime_error_service_not_available);
+}
+
+void Gateway_ipc_binding_base::offer_service_locked(
+    Client_id client_id, Key_t const& key, bool offered,
+    std::vector<std::shared_ptr<score::socom::Enabled_server_connector>>& removed_connectors,
+    std::vector<Pending_method_calls::Pending_method_call>& failed_method_calls) noexcept {
+    auto const interface_instance_opt = m_keys.get(key);
+    assert(interface_instance_opt.has_value() && "Interface and instance should exist for key");
+    auto const& [service, instance_id] = interface_instance_opt.value();
+    auto state =
+        m_service_states.process_offer(key, service.get(), instance_id.get(), client_id, offered);
+    if (state.connector != nullptr) {
+        removed_connectors.push_back(std::move(state.connector));
+    }
+
+    if (offered) {
+        maybe_send_connect_service_locked(key, state.service_state);
         return;
     }
 
-    maybe_send_connect_service_locked(key, state.service_state);
+    m_service_states.clear_event_subscriptions(key);
+    m_id_mapping.remove_service(key);
+    m_event_routes.remove_service(key);
+    clear_pending_connects_for_key_locked(key, client_id);
+    auto failed = m_pending_method_calls.take_if([&key, client_id](auto const& call) {
+        return call.key == key && call.client_id == client_id;
+    });
+    std::move(failed.begin(), failed.end(), std::back_inserter(failed_method_calls));
 }
 
 void Gateway_ipc_binding_base::handle_subscribe_event_message(Client_id client_id,
                                                               Subscribe_event const& msg) noexcept {
-    std::lock_guard<std::recursive_mutex> const lock{m_mutex};
+    std::lock_guard<Striped_mutex> const lock{m_mutex};
     // Find the connection by provided_id for this client
     auto const mapping_info = m_id_mapping.get_by_local_handle(client_id, msg.provided_id);
 
@@ -395,81 +858,250 @@ void Gateway_ipc_binding_base::handle_subscribe_event_message(Client_id client_i
     auto const& key = mapping_info->get().key;
     Event_subscription_endpoint const endpoint{client_id, msg.provided_id};
 
+    // Updates carry the handle of the subscriber, credits are returned with it. Granted before the
+    // local service learns about the subscription and sends its first update.
+    release_dropped_updates_locked(
+        m_event_credits.subscribe(client_id, mapping_info->get().remote_handle, msg.event_id, key,
+                                  msg.subscribe ? msg.credits : 0U));
     m_service_states.update_event_subscription(key, endpoint, msg.event_id, msg.subscribe);
 }
 
-void Gateway_ipc_binding_base::handle_event_update_message(Client_id client_id,
-                                                           Event_update const& msg) noexcept {
-    std::lock_guard<std::recursive_mutex> const lock{m_mutex};
-    auto const mapping_info = m_id_mapping.get_by_remote_handle(client_id, msg.required_id);
-    if (!mapping_info.has_value()) {
-        // Mapping was removed, but peer send event update, before it processed the unsubscription
-        // or service removal
-        return;
+void Gateway_ipc_binding_base::handle_event_update_message(
+    Client_id client_id, Event_update const& msg, Event_timestamps const& timestamps) noexcept {
+    // The update is passed to the local service outside of the lock, so workers of the message
+    // dispatcher update the events of different services in parallel
+    std::shared_ptr<score::socom::Enabled_server_connector> enabled_connector;
+    std::optional<score::socom::Payload> payload;
+    {
+        // The route of required_id is only modified under its stripe or the exclusive lock
+        Striped_mutex::Shared_lock const lock{m_mutex, msg.required_id};
+        auto* const route = m_event_routes.find(client_id, msg.required_id);
+        if (route == nullptr) {
+            // Mapping was removed, but peer send event update, before it processed the
+            // unsubscription or service removal
+            return;
+        }
+
+        enabled_connector = route->service_state->enabled_connector;
+        assert(enabled_connector != nullptr && "Enabled connector should exist for key");
+        if (enabled_connector == nullptr) {
+            return;
+        }
+
+        if (m_latencies.is_enabled()) {
+            auto const received_ns = Latency_histograms::now();
+            m_latencies.record(route->key, msg.event_id, Latency_stage::send_to_receive,
+                               timestamps.sent_ns, received_ns);
+            // Payloads released by consumer count give no notice of their consumption
+            if (msg.payload.slot_index != kNo_payload_slot &&
+                route->remote_metadata.consumer_release ==
+                    Consumer_release::payload_consumed_message) {
+                m_latencies.received(client_id, msg.required_id, msg.payload.slot_index,
+                                     {route->key, msg.event_id, timestamps, received_ns});
+            }
+        }
+        payload = get_peer_payload_locked(*route, msg.payload);
+        assert(payload.has_value() && "Failed to get payload for event update");
     }
 
-    assert(m_service_states.has_connector(mapping_info->get().key) &&
-           "Service state should have connector for key");
-    score::socom::Enabled_server_connector* enabled_connector =
-        m_service_states.get(mapping_info->get().key)->get().enabled_connector.get();
-    assert(enabled_connector != nullptr && "Enabled connector should exist for key");
-    if (enabled_connector == nullptr) {
-        return;
+    auto update_result = enabled_connector->update_event(msg.event_id, std::move(*payload));
+    (void)update_result;
+    assert(update_result);
+}
+
+void Gateway_ipc_binding_base::handle_payload_consumed_message(
+    Client_id client_id, Payload_consumed const& msg) noexcept {
+    Key_t key{};
+    Reply_channel* conn = nullptr;
+    Event_fan_out* fan_out = nullptr;
+    // Updates released by the consumption are sent without the stripe, like the ones of the
+    // fan-out. The fence keeps the connection from being removed until then.
+    std::optional<Striped_mutex::Writer_fence> fence;
+    {
+        Striped_mutex::Shared_lock const lock{m_mutex, msg.required_id};
+        auto const mapping_info = m_id_mapping.get_by_remote_handle(client_id, msg.required_id);
+        if (!mapping_info.has_value()) {
+            return;
+        }
+
+        key = mapping_info->get().key;
+        m_slot_managers.payload_consumed(key, msg);
+        conn = m_connections.get_reply_channel(client_id);
+        fan_out = m_event_fan_outs.find(key);
+        fence.emplace(lock);
     }
 
-    Read_only_shared_memory_slot_manager::On_payload_destruction_callback on_payload_destruction =
-        [this, client_id, required_id = msg.required_id, payload_handle = msg.payload]() {
-            std::lock_guard<std::recursive_mutex> const lock{m_mutex};
-            Reply_channel* const conn = m_connections.get_reply_channel(client_id);
+    // Before taking the fan-out mutex, which a producer waiting for this credit may hold
+    return_event_credit(key, {client_id, conn, msg.required_id}, msg);
+    if (fan_out != nullptr) {
+        send_held_back_event_update(key, *fan_out, {client_id, conn, msg.required_id}, msg);
+    }
+}
 
-            if (conn == nullptr) {
-                return;
+void Gateway_ipc_binding_base::handle_call_method_message(Client_id client_id,
+                                                          Call_method const& msg) noexcept {
+    // The local service is called outside of the lock, it may take long or reply right away
+    std::shared_ptr<score::socom::Client_connector> client_connector;
+    // Destroyed after the lock is released, it may call into the local service
+    score::socom::Method_invocation::Uptr finished_invocation;
+    std::optional<score::socom::Payload> payload;
+    score::socom::Method_call_reply_data_opt reply_data;
+    Remote_handle required_id{0U};
+    {
+        Striped_mutex::Shared_lock const lock{m_mutex, msg.provided_id};
+        auto const mapping_info = m_id_mapping.get_by_local_handle(client_id, msg.provided_id);
+        if (!mapping_info.has_value()) {
+            if (!msg.fire_and_forget) {
+                send_method_error_locked(client_id, msg.invocation_id, Remote_handle{0U},
+                                         score::socom::Error::runtime_error_service_not_available);
+            }
+            return;
+        }
+
+        auto const ids = mapping_info->get();
+        required_id = ids.remote_handle;
+        auto const state_opt = m_service_states.get(ids.key);
+        if (state_opt.has_value()) {
+            client_connector = state_opt->get().client_connector;
+        }
+        if (client_connector == nullptr) {
+            if (!msg.fire_and_forget) {
+                send_method_error_locked(client_id, msg.invocation_id, ids.remote_handle,
+                                         score::socom::Error::runtime_error_service_not_available);
             }
+            return;
+        }
 
-            Message_frame<Payload_consumed> payload_consumed_msg;
-            payload_consumed_msg.payload.required_id = required_id;
-            payload_consumed_msg.payload.handle = payload_handle;
-            (void)conn->send(payload_consumed_msg);
-        };
+        auto route = make_event_route(client_id, ids, nullptr);
+        payload = get_peer_payload_locked(route, msg.payload);
+        if (!payload.has_value()) {
+            if (!msg.fire_and_forget) {
+                send_method_error_locked(client_id, msg.invocation_id, ids.remote_handle,
+                                         score::socom::Error::runtime_error_malformed_payload);
+            }
+            return;
+        }
 
-    auto payload =
-        m_read_only_slot_managers
-            .get_read_only_shared_memory_slot_manager(mapping_info->get().remote_metadata)
-            .get_payload(msg.payload, std::move(on_payload_destruction));
+        if (!msg.fire_and_forget) {
+            // Registered before the call, the local service may reply before call_method()
+            // returns
+            m_active_method_calls.add(client_id, msg.invocation_id, ids.key, ids.remote_handle);
 
-    assert(payload.has_value() && "Failed to get payload for event update");
+            // A reply written into this payload is passed to the peer without copying
+            std::optional<score::socom::Writable_payload> reply_payload;
+            auto guard = m_slot_managers.allocate_slot(ids.key);
+            if (guard) {
+                reply_payload = make_shared_memory_writable_payload(std::move(*guard));
+            }
 
-    auto update_result = enabled_connector->update_event(msg.event_id, std::move(*payload));
-    (void)update_result;
-    assert(update_result);
+            reply_data.emplace(
+                [this, client_id, invocation_id = msg.invocation_id](
+                    score::socom::Method_result const& result) {
+                    send_method_reply(client_id, invocation_id, result);
+                },
+                std::move(reply_payload));
+        }
+    }
+
+    auto invocation =
+        client_connector->call_method(msg.method_id, std::move(*payload), std::move(reply_data));
+    if (msg.fire_and_forget) {
+        if (invocation) {
+            finished_invocation = std::move(*invocation);
+        }
+        return;
+    }
+
+    if (!invocation) {
+        if (m_active_method_calls.take(client_id, msg.invocation_id).has_value()) {
+            Striped_mutex::Shared_lock const lock{m_mutex, msg.provided_id};
+            send_method_error_locked(client_id, msg.invocation_id, required_id,
+                                     score::socom::Error::runtime_error_request_rejected);
+        }
+        return;
+    }
+
+    finished_invocation =
+        m_active_method_calls.set_invocation(client_id, msg.invocation_id, std::move(*invocation));
 }
 
-void Gateway_ipc_binding_base::handle_payload_consumed_message(
-    Client_id client_id, Payload_consumed const& msg) noexcept {
-    std::lock_guard<std::recursive_mutex> const lock{m_mutex};
-    auto const mapping_info = m_id_mapping.get_by_remote_handle(client_id, msg.required_id);
-    if (!mapping_info.has_value()) {
+void Gateway_ipc_binding_base::handle_call_method_reply_message(
+    Client_id client_id, Call_method_reply const& msg) noexcept {
+    std::optional<Pending_method_calls::Pending_method_call> call;
+    std::optional<score::socom::Payload> payload;
+    {
+        Striped_mutex::Shared_lock const lock{m_mutex, msg.required_id};
+        call = m_pending_method_calls.take(client_id, msg.invocation_id);
+        auto* const route = m_event_routes.find(client_id, msg.required_id);
+        if (msg.result_kind != Method_result_kind::error && route != nullptr) {
+            // Also taken for a reply that crossed a cancellation, to release the slot of the peer
+            payload = get_peer_payload_locked(*route, msg.payload);
+        }
+    }
+
+    if (!call.has_value() || !call->reply_data) {
         return;
     }
 
-    m_slot_managers.payload_consumed(mapping_info->get().key, msg);
+    switch (msg.result_kind) {
+        case Method_result_kind::application_return:
+            if (payload.has_value()) {
+                call->reply_data->reply(score::socom::Application_return{std::move(*payload)});
+                return;
+            }
+            break;
+        case Method_result_kind::application_error:
+            if (payload.has_value()) {
+                call->reply_data->reply(
+                    score::socom::Application_error{msg.error_code, std::move(*payload)});
+                return;
+            }
+            break;
+        case Method_result_kind::error:
+            call->reply_data->reply(static_cast<score::socom::Error>(msg.error_code));
+            return;
+        default:
+            break;
+    }
+
+    call->reply_data->reply(score::socom::Error::runtime_error_malformed_payload);
+}
+
+void Gateway_ipc_binding_base::handle_cancel_method_call_message(
+    Client_id client_id, Cancel_method_call const& msg) noexcept {
+    // Destroying the invocation cancels the call in the local service, outside of the lock
+    std::optional<Active_method_calls::Active_method_call> call;
+    Striped_mutex::Shared_lock const lock{m_mutex, msg.provided_id};
+    call = m_active_method_calls.take(client_id, msg.invocation_id);
 }
 
 void Gateway_ipc_binding_base::handle_connect_service_message(Client_id client_id,
                                                               Reply_channel& conn,
                                                               Connect_service const& msg) noexcept {
     log_it("");
-    std::unique_lock<std::recursive_mutex> lock{m_mutex};
-    auto const& key = m_keys.get(msg.service_id, msg.instance_id);
+    std::unique_lock<Striped_mutex> lock{m_mutex};
+    auto const key_opt = m_peer_service_keys.find_remote(client_id, msg.service_key);
+    if (!key_opt) {
+        return;
+    }
+
+    auto const key = *key_opt;
     if (!msg.in_use) {
-        score::socom::Client_connector::Uptr removed_connector;
+        std::shared_ptr<score::socom::Client_connector> removed_connector;
+        std::vector<score::socom::Method_invocation::Uptr> cancelled_method_calls;
         auto const mapping_info = m_id_mapping.get_by_remote_handle(client_id, msg.required_id);
         if (mapping_info.has_value()) {
             m_service_states.remove_event_subscriptions_for_connection(
                 key, client_id, mapping_info->get().local_handle);
         }
 
+        cancelled_method_calls = m_active_method_calls.take_if(
+            [client_id, &msg](Client_id id, auto const& call) {
+                return id == client_id && call.required_id == msg.required_id;
+            });
+
         m_id_mapping.remove_mapping(client_id, msg.required_id);
+        m_event_routes.remove(client_id, msg.required_id);
 
         clear_pending_connects_for_key_locked(key, client_id);
 
@@ -491,13 +1123,14 @@ void Gateway_ipc_binding_base::handle_connect_service_message(Client_id client_i
     assert(service_state_opt.has_value() && "Service state should exist for key");
     auto& service_state = service_state_opt->get();
 
-    Message_frame<Connect_service_reply> reply;
-    reply.payload.required_id = msg.required_id;
-    reply.payload.provided_id = info.local_handle;
-    reply.payload.metadata = info.local_metadata;
-    reply.payload.num_methods = service_state.counts.num_methods;
-    reply.payload.num_events = service_state.counts.num_events;
-    (void)conn.send(reply);
+    Connect_service_reply reply{};
+    reply.required_id = msg.required_id;
+    reply.provided_id = info.local_handle;
+    reply.metadata = info.local_metadata;
+    reply.num_methods = service_state.counts.num_methods;
+    reply.num_events = service_state.counts.num_events;
+    flush_batches_locked(client_id);
+    (void)conn.send(encode_compact_frame(reply));
 }
 
 void Gateway_ipc_binding_base::handle_connect_service_reply_message(
@@ -507,7 +1140,7 @@ void Gateway_ipc_binding_base::handle_connect_service_reply_message(
     Connection_metadata::Ids info{};
 
     {
-        std::lock_guard<std::recursive_mutex> const lock{m_mutex};
+        std::lock_guard<Striped_mutex> const lock{m_mutex};
         auto const pending = m_pending_connects.find(msg.required_id);
         if (pending == m_pending_connects.end()) {
             return;
@@ -534,6 +1167,7 @@ void Gateway_ipc_binding_base::handle_connect_service_reply_message(
         info.remote_metadata = msg.metadata;
 
         m_id_mapping.add_mapping(client_id, info);
+        m_event_routes.add(make_event_route(client_id, info, state));
 
         m_pending_connects.erase(pending);
     }
@@ -546,16 +1180,18 @@ void Gateway_ipc_binding_base::handle_connect_service_reply_message(
 
     // Create callbacks for the server connector that send IPC messages
     socom::Disabled_server_connector::Callbacks server_callbacks{
-        [](socom::Enabled_server_connector&, socom::Method_id, socom::Payload,
-           socom::Method_call_reply_data_opt,
-           socom::Posix_credentials const&) -> socom::Method_invocation::Uptr {
-            // No-op callback - remote service methods are handled through IPC
-            return nullptr;
+        [this, client_id, info](
+            socom::Enabled_server_connector&, socom::Method_id method_id, socom::Payload payload,
+            socom::Method_call_reply_data_opt reply_data,
+            socom::Posix_credentials const&) -> socom::Method_invocation::Uptr {
+            return call_remote_method({client_id, info.key, info.local_handle, info.remote_handle,
+                                       method_id, std::move(reply_data)},
+                                      std::move(payload));
         },
         [this, client_id, provided_id = info.local_handle](socom::Enabled_server_connector&,
                                                            socom::Event_id event_id,
                                                            socom::Event_state event_state) {
-            std::lock_guard<std::recursive_mutex> const lock{m_mutex};
+            std::lock_guard<Striped_mutex> const lock{m_mutex};
             Reply_channel* conn = m_connections.get_reply_channel(client_id);
 
             if (conn == nullptr) {
@@ -566,17 +1202,21 @@ void Gateway_ipc_binding_base::handle_connect_service_reply_message(
             msg.payload.provided_id = provided_id;
             msg.payload.event_id = event_id;
             msg.payload.subscribe = event_state == socom::Event_state::subscribed;
+            msg.payload.credits = m_granted_credits;
             (void)conn->send(msg);
         },
         [](socom::Enabled_server_connector&, socom::Event_id) {
             // No-op callback - remote service event updates are handled through IPC
         },
-        [](socom::Enabled_server_connector&,
-           socom::Method_id) -> score::Result<socom::Writable_payload> {
-            // No-op callback - remote service method payloads are handled through IPC
-            // Return empty payload as we're not allocating anything for remote service methods
-            return socom::Writable_payload{socom::Writable_payload::Writable_span{},
-                                           socom::kNoSlotHandle, []() {}};
+        [this, key = info.key](socom::Enabled_server_connector&,
+                               socom::Method_id) -> score::Result<socom::Writable_payload> {
+            // Method call payloads in shared memory are passed to the peer without copying
+            Striped_mutex::Shared_lock const lock{m_mutex, key};
+            auto allocation = m_slot_managers.allocate_slot(key);
+            return allocation.and_then([](auto& guard) {
+                return Result<socom::Writable_payload>(
+                    make_shared_memory_writable_payload(std::move(guard)));
+            });
         }};
 
     // Create server connector through the runtime
@@ -593,28 +1233,213 @@ void Gateway_ipc_binding_base::handle_connect_service_reply_message(
         socom::Disabled_server_connector::enable(std::move(server_connector_result).value());
 
     if (enabled_connector) {
-        std::lock_guard<std::recursive_mutex> const lock{m_mutex};
+        std::lock_guard<Striped_mutex> const lock{m_mutex};
         m_service_states.add_server_connector(info.key, std::move(enabled_connector));
     }
 }
 
-bool Gateway_ipc_binding_base::send_request_service_locked(Service const& service,
-                                                           Instance_id const& instance,
-                                                           bool in_use) noexcept {
-    log_it("in_use == ", in_use);
-    Message_frame<Request_service> msg;
-    msg.payload.service_id = service;
-    msg.payload.instance_id = instance;
-    msg.payload.in_use = in_use;
+score::socom::Method_invocation::Uptr Gateway_ipc_binding_base::call_remote_method(
+    Pending_method_calls::Pending_method_call call, score::socom::Payload payload) noexcept {
+    auto const client_id = call.client_id;
+    auto const key = call.key;
+    auto const fire_and_forget = !call.reply_data.has_value();
+
+    Reply_channel* conn = nullptr;
+    Message_frame<Call_method> msg;
+    // The local client is failed outside of the lock, it may call back into the binding
+    std::optional<score::socom::Error> error;
+    // Sent without the stripe like event updates, the fence keeps the connection until then. It
+    // is released before the local client is failed, which may call back into the binding.
+    std::optional<Striped_mutex::Writer_fence> fence;
+    {
+        Striped_mutex::Shared_lock const lock{m_mutex, key};
+        conn = m_connections.get_reply_channel(client_id);
+        if (conn == nullptr) {
+            error = score::socom::Error::runtime_error_service_not_available;
+        } else if (auto const handle = m_slot_managers.share_payload(key, payload); !handle) {
+            error = score::socom::Error::runtime_error_request_rejected;
+        } else {
+            msg.payload.provided_id = call.provided_id;
+            msg.payload.method_id = call.method_id;
+            msg.payload.fire_and_forget = fire_and_forget;
+            msg.payload.invocation_id = Method_invocation{0U};
+            msg.payload.payload = *handle;
+            if (!fire_and_forget) {
+                // Registered before sending, the reply may arrive before send() returns
+                msg.payload.invocation_id = m_pending_method_calls.add(std::move(call));
+            }
+            fence.emplace(lock);
+        }
+    }
 
-    auto const key = m_keys.get(service, instance);
+    if (error.has_value()) {
+        fail_method_call(call, *error);
+        return nullptr;
+    }
+
+    flush_batches_locked(client_id);
+    auto const sent = conn->send(msg).has_value();
+    fence.reset();
+    if (!sent) {
+        if (msg.payload.payload.slot_index != kNo_payload_slot) {
+            m_slot_managers.consumer_lost(key, msg.payload.payload.slot_index);
+        }
+        auto failed = m_pending_method_calls.take(client_id, msg.payload.invocation_id);
+        if (failed.has_value()) {
+            fail_method_call(*failed, score::socom::Error::runtime_error_service_not_available);
+        }
+        return nullptr;
+    }
+
+    if (fire_and_forget) {
+        return nullptr;
+    }
+    return std::make_unique<Forwarded_method_invocation>(m_method_call_canceller,
+                                                         msg.payload.invocation_id);
+}
+
+void Gateway_ipc_binding_base::cancel_remote_method_call(Method_invocation invocation_id) noexcept {
+    // Destroyed after the lock is released, it holds the reply callback of the local client
+    std::optional<Pending_method_calls::Pending_method_call> call;
+    std::lock_guard<Striped_mutex> const lock{m_mutex};
+    call = m_pending_method_calls.take(invocation_id);
+    if (!call.has_value()) {
+        return;  // Already replied or failed
+    }
+
+    Reply_channel* const conn = m_connections.get_reply_channel(call->client_id);
+    if (conn == nullptr) {
+        return;
+    }
+
+    Message_frame<Cancel_method_call> msg;
+    msg.payload.provided_id = call->provided_id;
+    msg.payload.method_id = call->method_id;
+    msg.payload.invocation_id = invocation_id;
+    flush_batches_locked(call->client_id);
+    (void)conn->send(msg);
+}
+
+void Gateway_ipc_binding_base::send_method_reply(
+    Client_id client_id, Method_invocation invocation_id,
+    score::socom::Method_result const& result) noexcept {
+    // Destroyed after the lock is released, it may hold the invocation of the local service
+    std::optional<Active_method_calls::Active_method_call> call;
+    call = m_active_method_calls.take(client_id, invocation_id);
+    if (!call.has_value()) {
+        return;  // Cancelled or the peer is gone
+    }
+
+    // Shared, the local service may reply from within a call made under a stripe
+    Striped_mutex::Shared_lock const lock{m_mutex, call->key};
+    send_method_reply_locked(client_id, invocation_id, call->key, call->required_id, result);
+}
+
+void Gateway_ipc_binding_base::send_method_reply_locked(
+    Client_id client_id, Method_invocation invocation_id, Key_t const& key,
+    Remote_handle required_id, score::socom::Method_result const& result) noexcept {
+    if (auto const* const error = std::get_if<score::socom::Error>(&result)) {
+        send_method_error_locked(client_id, invocation_id, required_id, *error);
+        return;
+    }
+
+    Reply_channel* const conn = m_connections.get_reply_channel(client_id);
+    if (conn == nullptr) {
+        return;
+    }
+
+    Message_frame<Call_method_reply> reply;
+    reply.payload.required_id = required_id;
+    reply.payload.invocation_id = invocation_id;
+    reply.payload.result_kind = Method_result_kind::application_return;
+    reply.payload.error_code = 0;
+    score::socom::Payload const* payload = nullptr;
+    if (auto const* const error = std::get_if<score::socom::Application_error>(&result)) {
+        reply.payload.result_kind = Method_result_kind::application_error;
+        reply.payload.error_code = error->code;
+        payload = &error->payload;
+    } else {
+        payload = &std::get<score::socom::Application_return>(result).payload;
+    }
+
+    auto const handle = m_slot_managers.share_payload(key, *payload);
+    if (!handle) {
+        send_method_error_locked(client_id, invocation_id, required_id,
+                                 score::socom::Error::runtime_error_request_rejected);
+        return;
+    }
+
+    reply.payload.payload = *handle;
+    flush_batches_locked(client_id);
+    if (!conn->send(reply) && handle->slot_index != kNo_payload_slot) {
+        m_slot_managers.consumer_lost(key, handle->slot_index);
+    }
+}
+
+void Gateway_ipc_binding_base::send_method_error_locked(Client_id client_id,
+                                                        Method_invocation invocation_id,
+                                                        Remote_handle required_id,
+                                                        score::socom::Error error) noexcept {
+    Reply_channel* const conn = m_connections.get_reply_channel(client_id);
+    if (conn == nullptr) {
+        return;
+    }
+
+    Message_frame<Call_method_reply> reply;
+    reply.payload.required_id = required_id;
+    reply.payload.invocation_id = invocation_id;
+    reply.payload.result_kind = Method_result_kind::error;
+    reply.payload.error_code = static_cast<std::int32_t>(error);
+    reply.payload.payload = Shared_memory_handle{kNo_payload_slot, 0U};
+    flush_batches_locked(client_id);
+    (void)conn->send(reply);
+}
+
+std::optional<score::socom::Payload> Gateway_ipc_binding_base::get_peer_payload_locked(
+    Event_route& route, Shared_memory_handle handle) noexcept {
+    if (handle.slot_index == kNo_payload_slot) {
+        return score::socom::empty_payload();
+    }
+
+    if (route.slot_manager == nullptr) {
+        route.slot_manager = &m_read_only_slot_managers.get_read_only_shared_memory_slot_manager(
+            route.remote_metadata);
+    }
+
+    // With consumer counts in shared memory, the read-only slot manager releases the slot itself
+    Read_only_shared_memory_slot_manager::On_payload_destruction_callback on_payload_destruction;
+    if (route.remote_metadata.consumer_release == Consumer_release::payload_consumed_message) {
+        on_payload_destruction = [this, client_id = route.client_id,
+                                  max_pending = route.max_pending_consumed,
+                                  consumed = Payload_consumed{route.required_id, handle}]() {
+            if (m_latencies.is_enabled()) {
+                m_latencies.consumed(client_id, consumed.required_id, consumed.handle.slot_index);
+            }
+            Striped_mutex::Shared_lock const lock{m_mutex, consumed.required_id};
+            send_payload_consumed_locked(client_id, consumed, max_pending);
+        };
+    }
+
+    return route.slot_manager->get_payload(handle, std::move(on_payload_destruction));
+}
+
+bool Gateway_ipc_binding_base::send_request_service_locked(Key_t key, bool in_use) noexcept {
+    log_it("in_use == ", in_use);
     if (m_service_states.has_client_connector(key)) {
         // Callback call was triggered by our creation of Client_connector
         log_it("Client connector already exists for key, skipping creation and offer");
         return false;
     }
 
-    (void)m_connections.send_to_all(msg);
+    m_event_update_batches.flush_all();
+    m_payload_consumed_batches.flush_all();
+    m_connections.for_each([this, key, in_use](Client_id client_id, Reply_channel& conn) {
+        declare_service_locked(client_id, conn, key);
+        Message_frame<Request_service> msg;
+        msg.payload.service_key = static_cast<Service_key>(key);
+        msg.payload.in_use = in_use;
+        (void)conn.send(msg);
+    });
     return true;
 }
 
@@ -623,44 +1448,120 @@ void Gateway_ipc_binding_base::send_request_service(
     score::socom::Service_instance const& instance, bool in_use) noexcept {
     log_it("in_use == ", in_use);
 
-    score::socom::Enabled_server_connector::Uptr removed_connector;
-    std::lock_guard<std::recursive_mutex> const lock{m_mutex};
+    std::shared_ptr<score::socom::Enabled_server_connector> removed_connector;
+    std::vector<Pending_method_calls::Pending_method_call> failed_method_calls;
 
-    auto const service = make_service(configuration.interface);
-    auto const instance_id = make_instance_id(instance);
+    {
+        std::lock_guard<Striped_mutex> const lock{m_mutex};
 
-    if (!send_request_service_locked(service, instance_id, in_use)) {
-        return;
-    }
+        auto const service = make_service(configuration.interface);
+        auto const instance_id = make_instance_id(instance);
+
+        auto const key = m_keys.get(service, instance_id);
+        if (!send_request_service_locked(key, in_use)) {
+            return;
+        }
+
+        auto state_opt = m_service_states.process_request_service(key, configuration, service,
+                                                                  instance_id, in_use);
+        removed_connector = std::move(state_opt.connector);
+        if (state_opt.service_state) {
+            auto& state = state_opt.service_state->get();
+            maybe_send_connect_service_locked(key, state);
+            return;
+        }
 
-    auto const key = m_keys.get(service, instance_id);
-    auto state_opt = m_service_states.process_request_service(
-        key, configuration, Request_service{service, instance_id, in_use});
-    removed_connector = std::move(state_opt.connector);
-    if (!state_opt.service_state) {
         m_id_mapping.remove_service(key);
+        m_event_routes.remove_service(key);
         m_pending_connects.clear_pending_connects_for_key(key);
-        return;
+        failed_method_calls =
+            m_pending_method_calls.take_if([&key](auto const& call) { return call.key == key; });
     }
-
-    auto& state = state_opt.service_state->get();
-    maybe_send_connect_service_locked(key, state);
+    fail_method_calls(failed_method_calls,
+                      score::socom::Error::runtime_error_service_not_available);
 }
 
-void Gateway_ipc_binding_base::send_offer_service_to_client(Reply_channel& conn,
-                                                            Service const& service,
-                                                            Instance_id const& instance,
+void Gateway_ipc_binding_base::send_offer_service_to_client(Client_id client_id,
+                                                            Reply_channel& conn, Key_t key,
                                                             bool offered) noexcept {
     log_it("offered ==", offered);
 
     Message_frame<Offer_service> msg;
-    msg.payload.service_id = service;
-    msg.payload.instance_id = instance;
+    msg.payload.service_key = static_cast<Service_key>(key);
     msg.payload.offered = offered;
 
+    flush_batches_locked(client_id);
+    declare_service_locked(client_id, conn, key);
     (void)conn.send(msg);
 }
 
+void Gateway_ipc_binding_base::send_service_snapshot_locked(Client_id client_id,
+                                                            Reply_channel& conn) noexcept {
+    if (!m_service_snapshots.mark_sent(client_id)) {
+        return;
+    }
+
+    Key_map<Service_snapshot_entry> flags;
+    m_service_states.for_each([this, &flags](Key_t const& key, Service_state const& state) {
+        // Client connectors are created for requests of peers, not for requests of this side
+        if (state.requested && !m_service_states.has_client_connector(key)) {
+            flags[key].requested = true;
+        }
+    });
+    m_local_offers.for_each([this, client_id, &flags](Key_t const& key, bool offered) {
+        auto const* const peers = m_service_to_interested_peers.find(key);
+        if (offered && peers != nullptr && peers->count(client_id) != 0U) {
+            flags[key].offered = true;
+        }
+    });
+
+    std::vector<Service_snapshot_entry> entries;
+    flags.for_each([this, client_id, &entries](Key_t const& key, Service_snapshot_entry& entry) {
+        if (!entry.requested && !entry.offered) {
+            return;
+        }
+
+        auto const interface_instance_opt = m_keys.get(key);
+        assert(interface_instance_opt.has_value() &&
+               "Interface and instance should exist for key");
+        auto const& [service, instance_id] = interface_instance_opt.value();
+        entry.service_key = static_cast<Service_key>(key);
+        entry.service_id = service.get();
+        entry.instance_id = instance_id.get();
+        // Declared by the entry itself
+        (void)m_peer_service_keys.mark_declared(client_id, key);
+        entries.push_back(entry);
+    });
+
+    flush_batches_locked(client_id);
+    auto const page_count = connect_page_count(entries.size(), 0U);
+    for (std::size_t page = 0U; page < page_count; ++page) {
+        Service_snapshot msg{};
+        fill_connect_page(msg.services, entries, page);
+        msg.complete = page + 1U == page_count;
+        if (!conn.send(encode_compact_frame(msg))) {
+            return;
+        }
+    }
+}
+
+void Gateway_ipc_binding_base::declare_service_locked(Client_id client_id, Reply_channel& conn,
+                                                      Key_t key) noexcept {
+    if (!m_peer_service_keys.mark_declared(client_id, key)) {
+        return;
+    }
+
+    auto const interface_instance_opt = m_keys.get(key);
+    assert(interface_instance_opt.has_value() && "Interface and instance should exist for key");
+    auto const& [service, instance_id] = interface_instance_opt.value();
+
+    Declare_service msg{};
+    msg.service_key = static_cast<Service_key>(key);
+    msg.service_id = service.get();
+    msg.instance_id = instance_id.get();
+    (void)conn.send(encode_compact_frame(msg));
+}
+
 void Gateway_ipc_binding_base::maybe_send_connect_service_locked(Key_t const& key,
                                                                  Service_state& state) noexcept {
     auto send_func = [this, &key](auto const& client_id, auto const& remote_handle,
@@ -671,34 +1572,258 @@ void Gateway_ipc_binding_base::maybe_send_connect_service_locked(Key_t const& ke
 
         m_pending_connects.emplace(remote_handle, {key, client_id});
 
-        return conn->send(connect_service).has_value();
+        flush_batches_locked(client_id);
+        declare_service_locked(client_id, *conn, key);
+        return conn->send(encode_compact_frame(connect_service)).has_value();
     };
 
     state.send_connect_service(m_next_local_id, m_keys, m_slot_managers, send_func);
 }
 
-std::vector<score::socom::Enabled_server_connector::Uptr>
+std::vector<std::shared_ptr<score::socom::Enabled_server_connector>>
 Gateway_ipc_binding_base::remove_client_state_locked(Client_id client_id) {
     m_service_states.remove_event_subscriptions_for_client(client_id);
     auto connectors = m_service_states.remove_offers(client_id);
 
-    for (auto it = m_service_to_interested_peers.begin();
-         it != m_service_to_interested_peers.end();) {
-        it->second.erase(client_id);
-        if (it->second.empty()) {
-            it = m_service_to_interested_peers.erase(it);
-        } else {
-            ++it;
-        }
-    }
+    m_service_to_interested_peers.for_each(
+        [client_id](Key_t const&, std::set<Client_id>& peers) { peers.erase(client_id); });
 
     m_id_mapping.remove_client(client_id);
+    m_event_routes.remove_client(client_id);
+    m_peer_service_keys.remove_client(client_id);
+    m_service_snapshots.remove_client(client_id);
     m_pending_connects.clear_pending_connects(
         [&client_id](auto const& val) { return val.client_id == client_id; });
 
     return connectors;
 }
 
+Latency_histogram_summaries Gateway_ipc_binding_base::get_latency_histograms() {
+    // Keys are only modified under the exclusive lock
+    Striped_mutex::Shared_lock const lock{m_mutex, 0U};
+    return m_latencies.summarize(m_keys);
+}
+
+void Gateway_ipc_binding_base::flush_event_updates() noexcept {
+    Striped_mutex::Shared_lock const lock{m_mutex, 0U};
+    m_event_update_batches.flush_all();
+}
+
+void Gateway_ipc_binding_base::event_update_lost_locked(Client_id client_id,
+                                                        Event_update const& update) noexcept {
+    auto const mapping_info = m_id_mapping.get_by_remote_handle(client_id, update.required_id);
+    if (!mapping_info.has_value()) {
+        return;
+    }
+
+    m_slot_managers.consumer_lost(mapping_info->get().key, update.payload.slot_index);
+}
+
+bool Gateway_ipc_binding_base::send_event_update_to(Key_t const& key,
+                                                    Event_fan_out::Recipient const& recipient,
+                                                    Event_update const& update) noexcept {
+    auto const send = [this, &recipient](auto const& msg) {
+        if (m_event_update_batches.is_enabled()) {
+            return m_event_update_batches.add(recipient.client_id, *recipient.conn, msg);
+        }
+        Message_frame<std::decay_t<decltype(msg)>> frame;
+        frame.payload = msg;
+        return recipient.conn->send(frame);
+    };
+
+    Result<void> send_result;
+    if (m_latencies.is_enabled()) {
+        // Stamped here, so updates held back for credits or conflation are covered as well
+        Traced_event_update const traced_update{
+            update,
+            {m_latencies.allocation_time(key, update.payload.slot_index),
+             Latency_histograms::now()}};
+        m_latencies.record(key, update.event_id, Latency_stage::allocate_to_send,
+                           traced_update.timestamps.allocated_ns, traced_update.timestamps.sent_ns);
+        send_result = send(traced_update);
+    } else {
+        send_result = send(update);
+    }
+    if (!send_result) {
+        m_slot_managers.consumer_lost(key, update.payload.slot_index);
+        return false;
+    }
+    return true;
+}
+
+bool Gateway_ipc_binding_base::conflate_event_update(Key_t const& key, Event_fan_out& fan_out,
+                                                     Event_fan_out::Recipient const& recipient,
+                                                     Event_update const& update) noexcept {
+    auto& updates = fan_out.conflated_updates;
+    auto it = std::find_if(updates.begin(), updates.end(), [&recipient, &update](auto const& u) {
+        return u.client_id == recipient.client_id && u.required_id == recipient.required_id &&
+               u.event_id == update.event_id;
+    });
+    if (it == updates.end()) {
+        updates.push_back({recipient.client_id, recipient.required_id, update.event_id,
+                           std::nullopt, std::nullopt});
+        it = std::prev(updates.end());
+    }
+
+    if (it->in_flight) {
+        if (it->held_back) {
+            m_slot_managers.consumer_lost(key, it->held_back->slot_index);
+        }
+        it->held_back = update.payload;
+        return false;
+    }
+
+    // Empty payloads have no slot which the peer could acknowledge
+    if (update.payload.slot_index != kNo_payload_slot) {
+        it->in_flight = update.payload.slot_index;
+    }
+    return true;
+}
+
+bool Gateway_ipc_binding_base::take_event_credit(
+    Key_t const& key, Event_fan_out& fan_out, std::size_t index, Event_update const& update,
+    std::optional<Striped_mutex::Writer_fence>& fence) noexcept {
+    auto const client_id = fan_out.recipients[index].client_id;
+    auto acquisition = m_event_credits.acquire(client_id, update);
+    if (acquisition.decision == Event_credits::Decision::wait) {
+        auto const deadline = m_event_credits.wait_deadline();
+        do {
+            // Exclusive lock() waits for the fence while holding the stripes, which the
+            // Payload_consumed messages returning the credit need
+            fence.reset();
+            auto const may_wait = m_event_credits.wait_for_credit(client_id, update, deadline);
+
+            Striped_mutex::Shared_lock const lock{m_mutex, key};
+            update_event_recipients_locked(key, fan_out, index, update.payload.slot_index);
+            fence.emplace(lock);
+            if (fan_out.recipients[index].conn == nullptr) {
+                return false;
+            }
+            acquisition = m_event_credits.acquire(client_id, update, may_wait);
+        } while (acquisition.decision == Event_credits::Decision::wait);
+    }
+
+    if (acquisition.dropped) {
+        m_slot_managers.consumer_lost(key, *acquisition.dropped);
+    }
+    if (acquisition.decision == Event_credits::Decision::drop) {
+        m_slot_managers.consumer_lost(key, update.payload.slot_index);
+    }
+    return acquisition.decision == Event_credits::Decision::send;
+}
+
+void Gateway_ipc_binding_base::update_event_recipients_locked(Key_t const& key,
+                                                              Event_fan_out& fan_out,
+                                                              std::size_t index,
+                                                              Slot_handle slot_handle) noexcept {
+    for (auto it = fan_out.recipients.begin() + static_cast<std::ptrdiff_t>(index);
+         it != fan_out.recipients.end(); ++it) {
+        if (it->conn == nullptr) {
+            continue;
+        }
+        auto const ids = m_id_mapping.get_by_remote_handle(it->client_id, it->required_id);
+        it->conn = ids && ids->get().key == key ? m_connections.get_reply_channel(it->client_id)
+                                                : nullptr;
+        if (it->conn == nullptr) {
+            m_slot_managers.consumer_lost(key, slot_handle);
+        }
+    }
+}
+
+void Gateway_ipc_binding_base::return_event_credit(Key_t const& key,
+                                                   Event_fan_out::Recipient const& consumer,
+                                                   Payload_consumed const& consumed) noexcept {
+    auto next = m_event_credits.release(consumer.client_id, consumed.required_id,
+                                        consumed.handle.slot_index);
+    while (next) {
+        if (consumer.conn == nullptr) {
+            m_slot_managers.consumer_lost(key, next->payload.slot_index);
+        } else if (send_event_update_to(key, {consumer.client_id, consumer.conn, next->required_id},
+                                        *next)) {
+            return;
+        }
+        // The update took the credit of the consumed slot, which is free again
+        next = m_event_credits.release(consumer.client_id, next->required_id,
+                                       next->payload.slot_index);
+    }
+}
+
+void Gateway_ipc_binding_base::release_dropped_updates_locked(
+    std::vector<Event_credits::Dropped_update> const& dropped) noexcept {
+    for (auto const& update : dropped) {
+        m_slot_managers.consumer_lost(update.key, update.slot);
+    }
+}
+
+void Gateway_ipc_binding_base::send_held_back_event_update(
+    Key_t const& key, Event_fan_out& fan_out, Event_fan_out::Recipient const& consumer,
+    Payload_consumed const& consumed) noexcept {
+    std::lock_guard<std::mutex> const conflation_lock{fan_out.conflation_mutex};
+    auto& updates = fan_out.conflated_updates;
+    auto const it =
+        std::find_if(updates.begin(), updates.end(), [&consumer, &consumed](auto const& update) {
+            return update.client_id == consumer.client_id &&
+                   update.required_id == consumed.required_id &&
+                   update.in_flight == consumed.handle.slot_index;
+        });
+    if (it == updates.end()) {
+        return;
+    }
+
+    it->in_flight.reset();
+    if (!it->held_back) {
+        return;
+    }
+
+    Event_update const update{it->required_id, it->event_id, *it->held_back};
+    it->held_back.reset();
+    if (consumer.conn == nullptr) {
+        m_slot_managers.consumer_lost(key, update.payload.slot_index);
+        return;
+    }
+
+    if (update.payload.slot_index != kNo_payload_slot) {
+        it->in_flight = update.payload.slot_index;
+    }
+    if (!send_event_update_to(key, consumer, update)) {
+        it->in_flight.reset();
+    }
+}
+
+void Gateway_ipc_binding_base::send_payload_consumed_locked(Client_id client_id,
+                                                            Payload_consumed const& msg,
+                                                            std::size_t max_pending) noexcept {
+    Reply_channel* const conn = m_connections.get_reply_channel(client_id);
+    if (conn == nullptr) {
+        return;
+    }
+
+    if (m_payload_consumed_batches.is_enabled()) {
+        (void)m_payload_consumed_batches.add(client_id, *conn, msg, max_pending);
+        return;
+    }
+
+    Message_frame<Payload_consumed> payload_consumed_msg;
+    payload_consumed_msg.payload = msg;
+    (void)conn->send(payload_consumed_msg);
+}
+
+void Gateway_ipc_binding_base::flush_batches_locked(Client_id client_id) noexcept {
+    m_event_update_batches.flush(client_id);
+    m_payload_consumed_batches.flush(client_id);
+}
+
+std::optional<Batch_clock::time_point> Gateway_ipc_binding_base::flush_expired_batches(
+    Batch_clock::time_point now) noexcept {
+    Striped_mutex::Shared_lock const lock{m_mutex, 0U};
+    auto const next_event_update = m_event_update_batches.flush_expired(now);
+    auto const next_payload_consumed = m_payload_consumed_batches.flush_expired(now);
+    if (!next_event_update || !next_payload_consumed) {
+        return next_event_update ? next_event_update : next_payload_consumed;
+    }
+    return std::min(*next_event_update, *next_payload_consumed);
+}
+
 void Gateway_ipc_binding_base::clear_pending_connects_for_key_locked(
     Key_t const& key, Client_id const& client_id) noexcept {
     m_pending_connects.clear_pending_connects([&key, &client_id](auto const& val) {
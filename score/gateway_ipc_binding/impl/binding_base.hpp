@@ -14,21 +14,35 @@
 #ifndef SRC_GATEWAY_IPC_BINDING_SRC_BINDING_BASE
 #define SRC_GATEWAY_IPC_BINDING_SRC_BINDING_BASE
 
+#include <cstddef>
+#include <memory>
 #include <mutex>
+#include <optional>
 #include <set>
 #include <unordered_map>
+#include <vector>
 
 #include "connection_metadata.hpp"
 #include "connections.hpp"
+#include "event_credits.hpp"
+#include "event_routes.hpp"
 #include "key.hpp"
+#include "latency_histograms.hpp"
+#include "message_batches.hpp"
+#include "message_dispatcher.hpp"
+#include "message_trace_recorder.hpp"
+#include "method_calls.hpp"
+#include "peer_service_keys.hpp"
 #include "pending_connects.hpp"
 #include "reply_channel.hpp"
 #include "request_service_handle.hpp"
 #include "score/gateway_ipc_binding/gateway_ipc_binding_server.hpp"
 #include "score/socom/client_connector.hpp"
 #include "score/socom/runtime.hpp"
+#include "service_snapshots.hpp"
 #include "service_state.hpp"
 #include "shared_memory_managers.hpp"
+#include "striped_mutex.hpp"
 
 namespace score::gateway_ipc_binding {
 
@@ -37,14 +51,39 @@ namespace score::gateway_ipc_binding {
 /// Via the server this will manage multiple client connections and via the client there will be
 /// only one connection to the server, but in both cases the underlying logic for handling service
 /// offers, requests, and events is shared.
+///
+/// Connection and service state is modified under the exclusive lock of m_mutex. Sending and
+/// releasing event payloads only takes the stripe of m_mutex for the service key, so producers of
+/// different services do not wait for each other. Event updates are sent after releasing the
+/// stripe, so a slow peer does not hold back other services either. Functions suffixed _locked
+/// expect the caller to hold m_mutex, those used on the event path may also be called with a
+/// shared lock or a writer fence.
+///
+/// Event updates to subscriptions with credits are limited by m_event_credits, which has its own
+/// mutex. A producer blocked on credits holds the fan-out of its service, so Payload_consumed
+/// returns credits before anything else takes that mutex.
+///
+/// With a Message_dispatch of workers, data messages are handled by m_dispatcher. The receiving
+/// thread waits for the workers to become idle before it handles any other message, or removes a
+/// client, so these always see the effects of the data messages received before them. Only
+/// messages of the control lane of a data ring skip the wait, they overtake data messages anyway.
 class Gateway_ipc_binding_base : public Service_request_sender {
    public:
     /// \brief Constructor
     /// \param runtime SOCom runtime for service bridge registration
     /// \param slot_manager Factory for creating shared memory slot manager
-    /// \param server Unique pointer to message_passing server
+    /// \param batching Batching of messages sent to peers
+    /// \param dispatch Handling of messages received from peers
+    /// \param flow_control Credits granted for subscribed events and handling of exhausted credits
+    /// \param latency_tracing Recording of event update latencies
+    /// \param message_tracing Recording of the received and sent messages
     explicit Gateway_ipc_binding_base(score::socom::Runtime& runtime,
-                                      Shared_memory_manager_factory::Sptr slot_manager);
+                                      Shared_memory_manager_factory::Sptr slot_manager,
+                                      Message_batching batching = {},
+                                      Message_dispatch dispatch = {},
+                                      Flow_control flow_control = {},
+                                      Latency_tracing latency_tracing = {},
+                                      Message_tracing message_tracing = {});
     ~Gateway_ipc_binding_base() override;
 
     /// \brief Register shared memory configurations received from a client's Connect message
@@ -60,6 +99,13 @@ class Gateway_ipc_binding_base : public Service_request_sender {
     /// \param reply_channel Channel for sending replies to the client
     void add_client(Client_id const& client_id, Reply_channel& reply_channel);
 
+    /// \brief Add an IPC connection and send the Service_snapshot of this side to it
+    ///
+    /// Used by the side which establishes the connection. The other side replies with its own
+    /// snapshot once it applied this one.
+    void add_client_with_service_snapshot(Client_id const& client_id,
+                                          Reply_channel& reply_channel);
+
     /// \brief Remove an IPC connection to another process
     /// \param client_id Identifier for the client
     void remove_client(Client_id const& client_id);
@@ -71,59 +117,243 @@ class Gateway_ipc_binding_base : public Service_request_sender {
     void on_receive_message(Client_id client_id, Reply_channel& conn,
                             score::cpp::span<std::uint8_t const> data);
 
+    /// \brief Handle a message received through the control lane of a data ring
+    ///
+    /// Messages of the control lane overtake the data messages received before them, so they are
+    /// handled right away instead of after the workers of m_dispatcher.
+    void on_receive_control_message(Client_id client_id, Reply_channel& conn,
+                                    score::cpp::span<std::uint8_t const> data);
+
+    /// \brief Send all Event_update messages that are pending in batches
+    void flush_event_updates() noexcept;
+
+    /// \brief Latency distributions recorded so far, empty unless Latency_tracing is enabled
+    Latency_histogram_summaries get_latency_histograms();
+
+    /// \brief Recorder of the messages, which Reply_channels record sent messages into
+    Message_trace_recorder& get_message_trace_recorder() noexcept { return m_message_trace; }
+
+    /// \brief Most recent messages received and sent by all threads, ordered by timestamp
+    Message_trace_records get_message_trace() const { return m_message_trace.snapshot(); }
+
    private:
-    void handle_connect_message(Client_id client_id, Reply_channel& conn, Connect const& msg);
+    void handle_control_message(Client_id client_id, Reply_channel& conn,
+                                score::cpp::span<std::uint8_t const> data);
+
+    /// \brief Handles the messages which may be passed to the workers of m_dispatcher
+    void handle_data_message(Client_id client_id, score::cpp::span<std::uint8_t const> data);
 
-    void handle_connect_reply_message(Connect_reply const& msg);
+    /// \brief Hands a data message over to m_dispatcher, in single messages for batches
+    /// \return false if data is not a data message
+    bool dispatch_data_message(Client_id client_id, score::cpp::span<std::uint8_t const> data);
+
+    /// \brief Replies to the last message of the Connect handshake
+    void handle_connect_message(Client_id client_id, Reply_channel& conn);
+
+    void handle_declare_service_message(Client_id client_id, Declare_service const& msg) noexcept;
+
+    void handle_service_snapshot_message(Client_id client_id, Reply_channel& conn,
+                                         Service_snapshot const& msg) noexcept;
+
+    /// \brief Applies the difference of the complete snapshot received from client_id and replies
+    ///        with the own snapshot, unless it has been sent to client_id already
+    void apply_service_snapshot_locked(
+        Client_id client_id, Reply_channel& conn,
+        std::vector<std::shared_ptr<score::socom::Enabled_server_connector>>& removed_connectors,
+        std::vector<Pending_method_calls::Pending_method_call>& failed_method_calls) noexcept;
 
     void handle_request_service_message(Client_id client_id, Reply_channel& conn,
                                         Request_service const& msg) noexcept;
 
+    /// \brief Handles the request of key by client_id, like Request_service
+    void request_service_locked(Client_id client_id, Reply_channel& conn, Key_t const& key,
+                                bool in_use) noexcept;
+
     void handle_offer_service_message(Client_id client_id, Offer_service const& msg) noexcept;
 
+    /// \brief Handles the offer of key by client_id, like Offer_service
+    /// \param removed_connectors Connectors to destroy after releasing m_mutex
+    /// \param failed_method_calls Method calls to fail after releasing m_mutex
+    void offer_service_locked(
+        Client_id client_id, Key_t const& key, bool offered,
+        std::vector<std::shared_ptr<score::socom::Enabled_server_connector>>& removed_connectors,
+        std::vector<Pending_method_calls::Pending_method_call>& failed_method_calls) noexcept;
+
     void handle_subscribe_event_message(Client_id client_id, Subscribe_event const& msg) noexcept;
 
-    void handle_event_update_message(Client_id client_id, Event_update const& msg) noexcept;
+    /// \param timestamps Of a Traced_event_update, zero for an Event_update
+    void handle_event_update_message(Client_id client_id, Event_update const& msg,
+                                     Event_timestamps const& timestamps = {}) noexcept;
 
     void handle_payload_consumed_message(Client_id client_id, Payload_consumed const& msg) noexcept;
 
+    void handle_call_method_message(Client_id client_id, Call_method const& msg) noexcept;
+
+    void handle_call_method_reply_message(Client_id client_id,
+                                          Call_method_reply const& msg) noexcept;
+
+    void handle_cancel_method_call_message(Client_id client_id,
+                                           Cancel_method_call const& msg) noexcept;
+
     void handle_connect_service_message(Client_id client_id, Reply_channel& conn,
                                         Connect_service const& msg) noexcept;
 
     void handle_connect_service_reply_message(Client_id client_id,
                                               Connect_service_reply const& msg) noexcept;
 
-    bool send_request_service_locked(Service const& service, Instance_id const& instance,
-                                     bool in_use) noexcept;
+    score::socom::Method_invocation::Uptr call_remote_method(
+        Pending_method_calls::Pending_method_call call, score::socom::Payload payload) noexcept;
+
+    void cancel_remote_method_call(Method_invocation invocation_id) noexcept;
+
+    void send_method_reply(Client_id client_id, Method_invocation invocation_id,
+                           score::socom::Method_result const& result) noexcept;
+
+    void send_method_reply_locked(Client_id client_id, Method_invocation invocation_id,
+                                  Key_t const& key, Remote_handle required_id,
+                                  score::socom::Method_result const& result) noexcept;
+
+    void send_method_error_locked(Client_id client_id, Method_invocation invocation_id,
+                                  Remote_handle required_id, score::socom::Error error) noexcept;
+
+    std::optional<score::socom::Payload> get_peer_payload_locked(
+        Event_route& route, Shared_memory_handle handle) noexcept;
+
+    bool send_request_service_locked(Key_t key, bool in_use) noexcept;
 
     void send_request_service(score::socom::Service_interface_definition const& configuration,
                               score::socom::Service_instance const& instance,
                               bool in_use) noexcept override;
 
-    void send_offer_service_to_client(Reply_channel& conn, Service const& service,
-                                      Instance_id const& instance, bool offered) noexcept;
+    void send_offer_service_to_client(Client_id client_id, Reply_channel& conn, Key_t key,
+                                      bool offered) noexcept;
+
+    /// \brief Sends the requests and offers of this side for client_id in Service_snapshot
+    ///        messages, unless they have been sent to client_id before
+    void send_service_snapshot_locked(Client_id client_id, Reply_channel& conn) noexcept;
+
+    /// \brief Sends Declare_service for key, unless it has been declared to client_id before
+    void declare_service_locked(Client_id client_id, Reply_channel& conn, Key_t key) noexcept;
 
     void maybe_send_connect_service_locked(Key_t const& key, Service_state& state) noexcept;
 
-    std::vector<score::socom::Enabled_server_connector::Uptr> remove_client_state_locked(
-        Client_id client_id);
+    std::vector<std::shared_ptr<score::socom::Enabled_server_connector>>
+    remove_client_state_locked(Client_id client_id);
+
+    void event_update_lost_locked(Client_id client_id, Event_update const& update) noexcept;
+
+    void send_payload_consumed_locked(Client_id client_id, Payload_consumed const& msg,
+                                      std::size_t max_pending) noexcept;
+
+    void flush_batches_locked(Client_id client_id) noexcept;
+
+    std::optional<Batch_clock::time_point> flush_expired_batches(
+        Batch_clock::time_point now) noexcept;
 
     void clear_pending_connects_for_key_locked(Key_t const& key,
                                                Client_id const& client_id) noexcept;
 
+    /// \brief Recipients of the event update of a service which is being sent
+    struct Event_fan_out {
+        struct Recipient {
+            Client_id client_id;
+            Reply_channel* conn;
+            Remote_handle required_id;
+        };
+
+        /// \brief Delivery of a conflated event to one peer
+        struct Conflated_update {
+            Client_id client_id;
+            Remote_handle required_id;
+            score::socom::Event_id event_id;
+            /// \brief Slot of the update sent last, until the peer consumed it
+            std::optional<Slot_handle> in_flight;
+            /// \brief Latest update held back while another one is in flight
+            std::optional<Shared_memory_handle> held_back;
+        };
+
+        /// \brief Held while sending, keeps the updates of the service in order
+        std::mutex mutex;
+        /// \brief Recipients without connection unsubscribed while the sender waited for a credit
+        std::vector<Recipient> recipients;
+        /// \brief Taken after mutex, consumed slots release held back updates with it only
+        std::mutex conflation_mutex;
+        /// \brief Entries of peers which are no recipients anymore are dropped on the next update
+        std::vector<Conflated_update> conflated_updates;
+    };
+
+    /// \brief Sends an Event_update of key to a recipient, releasing the slot if that fails
+    /// \return true if the update was sent or added to a batch
+    bool send_event_update_to(Key_t const& key, Event_fan_out::Recipient const& recipient,
+                              Event_update const& update) noexcept;
+
+    /// \brief Holds back the update of a conflated event while the previous one is in flight
+    /// \return true if the update has to be sent to the recipient now
+    bool conflate_event_update(Key_t const& key, Event_fan_out& fan_out,
+                               Event_fan_out::Recipient const& recipient,
+                               Event_update const& update) noexcept;
+
+    /// \brief Takes a credit of a recipient's subscription, see Event_credits::acquire()
+    ///
+    /// Waits for a credit without the fence, which is taken again under the stripe of key. The
+    /// recipients from index on are looked up again then.
+    /// \return true if the update has to be sent to the recipient now
+    bool take_event_credit(Key_t const& key, Event_fan_out& fan_out, std::size_t index,
+                           Event_update const& update,
+                           std::optional<Striped_mutex::Writer_fence>& fence) noexcept;
+
+    /// \brief Drops the recipients from index on which are not subscribed to key anymore
+    void update_event_recipients_locked(Key_t const& key, Event_fan_out& fan_out,
+                                        std::size_t index, Slot_handle slot_handle) noexcept;
+
+    /// \brief Returns the credit of a consumed slot and sends the next held back update
+    ///
+    /// Called without the stripe, but with a Writer_fence keeping the consumer's connection.
+    void return_event_credit(Key_t const& key, Event_fan_out::Recipient const& consumer,
+                             Payload_consumed const& consumed) noexcept;
+
+    void release_dropped_updates_locked(
+        std::vector<Event_credits::Dropped_update> const& dropped) noexcept;
+
+    /// \brief Sends the update held back for the conflated event whose slot handle was consumed
+    /// \see return_event_credit
+    void send_held_back_event_update(Key_t const& key, Event_fan_out& fan_out,
+                                     Event_fan_out::Recipient const& consumer,
+                                     Payload_consumed const& consumed) noexcept;
+
+    // Declared first, Reply_channels record into it until the binding is destroyed
+    Message_trace_recorder m_message_trace;
     Keys m_keys;
+    Peer_service_keys m_peer_service_keys;
+    Service_snapshots m_service_snapshots;
     Connections m_connections;
     score::socom::Runtime& m_runtime;
     Shared_memory_managers m_slot_managers;
     Read_only_memory_managers m_read_only_slot_managers;
     score::socom::Service_bridge_registration m_bridge_registration;
-    std::recursive_mutex m_mutex;
+    Striped_mutex m_mutex;
     Service_states m_service_states;
     Connection_metadata m_id_mapping;
-    std::unordered_map<Key_t, bool> m_local_offers;
+    Event_routes m_event_routes;
+    Key_map<bool> m_local_offers;
     Pending_connects m_pending_connects;
-    std::unordered_map<Key_t, std::set<Client_id>> m_service_to_interested_peers;
+    Key_map<std::set<Client_id>> m_service_to_interested_peers;
     Id_generator<Remote_handle> m_next_local_id{1};
+    Pending_method_calls m_pending_method_calls;
+    Active_method_calls m_active_method_calls;
+    std::shared_ptr<Method_call_canceller> m_method_call_canceller;
+    // Entries are never removed, the event callbacks of client connectors refer to them
+    Key_map<Event_fan_out> m_event_fan_outs;
+    // Credits this binding grants to the producers of the events it subscribes to
+    std::uint32_t m_granted_credits;
+    Event_credits m_event_credits;
+    Latency_histograms m_latencies;
+    Event_update_batches m_event_update_batches;
+    Payload_consumed_batches m_payload_consumed_batches;
+    // Declared after all state it flushes, so the timer thread is stopped first
+    std::optional<Batch_flush_timer> m_batch_flush_timer;
+    // Workers are joined before the timer, they may still add messages to batches
+    std::optional<Message_dispatcher> m_dispatcher;
 };
 
 }  // namespace score::gateway_ipc_binding
@@ -0,0 +1,376 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "compact_frame.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace score::gateway_ipc_binding {
+
+namespace {
+
+constexpr std::size_t k_header_size = sizeof(Message_frame_header);
+constexpr std::uint8_t k_varint_continuation = 0x80U;
+constexpr std::uint8_t k_varint_value_bits = 7U;
+
+class Compact_writer {
+   public:
+    explicit Compact_writer(Message_type type) : m_frame(k_header_size, std::uint8_t{0U}) {
+        m_frame[offsetof(Message_frame_header, type)] = static_cast<std::uint8_t>(type);
+    }
+
+    template <typename T>
+    std::enable_if_t<std::is_unsigned_v<T> && !std::is_same_v<T, bool>> put(T value) {
+        std::uint64_t remaining = value;
+        while (remaining >= k_varint_continuation) {
+            m_frame.push_back(static_cast<std::uint8_t>(remaining | k_varint_continuation));
+            remaining >>= k_varint_value_bits;
+        }
+        m_frame.push_back(static_cast<std::uint8_t>(remaining));
+    }
+
+    template <typename T>
+    std::enable_if_t<std::is_enum_v<T>> put(T value) {
+        put(static_cast<std::make_unsigned_t<std::underlying_type_t<T>>>(value));
+    }
+
+    void put(bool value) { m_frame.push_back(value ? 1U : 0U); }
+
+    template <std::size_t Max_size>
+    void put(Fixed_string<Max_size> const& value) {
+        put(value.size);
+        m_frame.insert(m_frame.end(), value.data.begin(), value.data.begin() + value.size);
+    }
+
+    template <typename T, std::size_t Max_size>
+    void put(Fixed_size_container<T, Max_size> const& value) {
+        put(value.size);
+        for (std::size_t i = 0U; i < value.size; ++i) {
+            put(value.data[i]);
+        }
+    }
+
+    void put(Service const& value) {
+        put(value.service_id);
+        put(value.version.major);
+        put(value.version.minor);
+    }
+
+    void put(Service_instance const& value) {
+        put(value.service);
+        put(value.instance_id);
+    }
+
+    void put(Slot_class const& value) {
+        put(value.slot_size);
+        put(value.slot_count);
+    }
+
+    void put(Shared_memory_metadata const& value) {
+        put(value.path);
+        put(value.slot_size);
+        put(value.slot_count);
+        put(value.slot_classes);
+        put(value.event_slot_sizes);
+        put(value.consumer_release);
+        put(value.conflated_events);
+    }
+
+    void put(Service_shared_memory_config const& value) {
+        put(value.service);
+        put(value.instance_id);
+        put(value.metadata);
+    }
+
+    void put(Service_snapshot_entry const& value) {
+        put(value.service_key);
+        put(value.service_id);
+        put(value.instance_id);
+        put(value.requested);
+        put(value.offered);
+    }
+
+    Compact_frame finish() && {
+        auto const payload_size = m_frame.size() - k_header_size;
+        assert(payload_size <= std::numeric_limits<std::uint16_t>::max() &&
+               "Compact frame exceeds the maximum payload size");
+        auto const size = static_cast<std::uint16_t>(payload_size);
+        std::memcpy(&m_frame[offsetof(Message_frame_header, payload_size)], &size, sizeof(size));
+        return std::move(m_frame);
+    }
+
+   private:
+    Compact_frame m_frame;
+};
+
+/// \brief Reads fields written by Compact_writer, every get() fails once any field was invalid
+class Compact_reader {
+   public:
+    explicit Compact_reader(score::cpp::span<std::uint8_t const> payload) noexcept
+        : m_data(payload.data()), m_remaining(payload.size()) {}
+
+    template <typename T>
+    std::enable_if_t<std::is_unsigned_v<T> && !std::is_same_v<T, bool>, bool> get(
+        T& value) noexcept {
+        std::uint64_t result{0U};
+        for (std::uint8_t shift = 0U; shift < 64U; shift += k_varint_value_bits) {
+            if (m_remaining == 0U) {
+                return false;
+            }
+            auto const byte = *m_data;
+            ++m_data;
+            --m_remaining;
+            result |= static_cast<std::uint64_t>(byte & ~k_varint_continuation) << shift;
+            if ((byte & k_varint_continuation) == 0U) {
+                if (result > std::numeric_limits<T>::max()) {
+                    return false;
+                }
+                value = static_cast<T>(result);
+                return true;
+            }
+        }
+        return false;  // Longer than any 64 bit value
+    }
+
+    /// \brief Enums are only accepted within the range of their enumerators
+    bool get(Consumer_release& value) noexcept {
+        std::underlying_type_t<Consumer_release> raw{};
+        if (!get(raw) || raw > static_cast<std::underlying_type_t<Consumer_release>>(
+                                   Consumer_release::shared_memory_consumer_count)) {
+            return false;
+        }
+        value = static_cast<Consumer_release>(raw);
+        return true;
+    }
+
+    bool get(bool& value) noexcept {
+        if (m_remaining == 0U || *m_data > 1U) {
+            return false;
+        }
+        value = *m_data == 1U;
+        ++m_data;
+        --m_remaining;
+        return true;
+    }
+
+    template <std::size_t Max_size>
+    bool get(Fixed_string<Max_size>& value) noexcept {
+        if (!get(value.size) || value.size > Max_size || value.size > m_remaining) {
+            return false;
+        }
+        std::memcpy(value.data.data(), m_data, value.size);
+        m_data += value.size;
+        m_remaining -= value.size;
+        return true;
+    }
+
+    template <typename T, std::size_t Max_size>
+    bool get(Fixed_size_container<T, Max_size>& value) noexcept {
+        if (!get(value.size) || value.size > Max_size) {
+            return false;
+        }
+        for (std::size_t i = 0U; i < value.size; ++i) {
+            if (!get(value.data[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool get(Service& value) noexcept {
+        return get(value.service_id) && get(value.version.major) && get(value.version.minor);
+    }
+
+    bool get(Service_instance& value) noexcept {
+        return get(value.service) && get(value.instance_id);
+    }
+
+    bool get(Slot_class& value) noexcept { return get(value.slot_size) && get(value.slot_count); }
+
+    bool get(Shared_memory_metadata& value) noexcept {
+        return get(value.path) && get(value.slot_size) && get(value.slot_count) &&
+               get(value.slot_classes) && get(value.event_slot_sizes) &&
+               get(value.consumer_release) && get(value.conflated_events);
+    }
+
+    bool get(Service_shared_memory_config& value) noexcept {
+        return get(value.service) && get(value.instance_id) && get(value.metadata);
+    }
+
+    bool get(Service_snapshot_entry& value) noexcept {
+        return get(value.service_key) && get(value.service_id) && get(value.instance_id) &&
+               get(value.requested) && get(value.offered);
+    }
+
+    bool at_end() const noexcept { return m_remaining == 0U; }
+
+   private:
+    std::uint8_t const* m_data;
+    std::size_t m_remaining;
+};
+
+/// \return Reader for the payload of data if type and payload size are valid
+template <typename Msg_type>
+std::optional<Compact_reader> open_compact_frame(
+    score::cpp::span<std::uint8_t const> data) noexcept {
+    if (data.size() < k_header_size || get_message_type(data[0]) != Msg_type::type) {
+        return std::nullopt;
+    }
+
+    std::uint16_t payload_size{0U};
+    std::memcpy(&payload_size, &data[offsetof(Message_frame_header, payload_size)],
+                sizeof(payload_size));
+    if (data.size() < k_header_size + payload_size) {
+        return std::nullopt;  // Invalid frame - insufficient data
+    }
+
+    return Compact_reader{data.subspan(k_header_size, payload_size)};
+}
+
+}  // namespace
+
+Compact_frame encode_compact_frame(Connect const& msg) {
+    Compact_writer writer{Connect::type};
+    writer.put(msg.find_service_elements);
+    writer.put(msg.shared_memory_configs);
+    writer.put(msg.identifier);
+    writer.put(msg.data_ring_path);
+    writer.put(msg.data_ring_capacity);
+    writer.put(msg.complete);
+    return std::move(writer).finish();
+}
+
+Compact_frame encode_compact_frame(Connect_continuation const& msg) {
+    Compact_writer writer{Connect_continuation::type};
+    writer.put(msg.find_service_elements);
+    writer.put(msg.shared_memory_configs);
+    writer.put(msg.complete);
+    return std::move(writer).finish();
+}
+
+Compact_frame encode_compact_frame(Declare_service const& msg) {
+    Compact_writer writer{Declare_service::type};
+    writer.put(msg.service_key);
+    writer.put(msg.service_id);
+    writer.put(msg.instance_id);
+    return std::move(writer).finish();
+}
+
+Compact_frame encode_compact_frame(Service_snapshot const& msg) {
+    Compact_writer writer{Service_snapshot::type};
+    writer.put(msg.services);
+    writer.put(msg.complete);
+    return std::move(writer).finish();
+}
+
+Compact_frame encode_compact_frame(Connect_service const& msg) {
+    Compact_writer writer{Connect_service::type};
+    writer.put(msg.service_key);
+    writer.put(msg.required_id);
+    writer.put(msg.metadata);
+    writer.put(msg.in_use);
+    return std::move(writer).finish();
+}
+
+Compact_frame encode_compact_frame(Connect_service_reply const& msg) {
+    Compact_writer writer{Connect_service_reply::type};
+    writer.put(msg.required_id);
+    writer.put(msg.provided_id);
+    writer.put(msg.metadata);
+    writer.put(msg.num_methods);
+    writer.put(msg.num_events);
+    return std::move(writer).finish();
+}
+
+template <>
+std::optional<Connect> decode_compact_frame<Connect>(
+    score::cpp::span<std::uint8_t const> data) noexcept {
+    auto reader = open_compact_frame<Connect>(data);
+    Connect msg{};
+    if (!reader || !reader->get(msg.find_service_elements) ||
+        !reader->get(msg.shared_memory_configs) || !reader->get(msg.identifier) ||
+        !reader->get(msg.data_ring_path) || !reader->get(msg.data_ring_capacity) ||
+        !reader->get(msg.complete) || !reader->at_end()) {
+        return std::nullopt;
+    }
+    return msg;
+}
+
+template <>
+std::optional<Connect_continuation> decode_compact_frame<Connect_continuation>(
+    score::cpp::span<std::uint8_t const> data) noexcept {
+    auto reader = open_compact_frame<Connect_continuation>(data);
+    Connect_continuation msg{};
+    if (!reader || !reader->get(msg.find_service_elements) ||
+        !reader->get(msg.shared_memory_configs) || !reader->get(msg.complete) ||
+        !reader->at_end()) {
+        return std::nullopt;
+    }
+    return msg;
+}
+
+template <>
+std::optional<Declare_service> decode_compact_frame<Declare_service>(
+    score::cpp::span<std::uint8_t const> data) noexcept {
+    auto reader = open_compact_frame<Declare_service>(data);
+    Declare_service msg{};
+    if (!reader || !reader->get(msg.service_key) || !reader->get(msg.service_id) ||
+        !reader->get(msg.instance_id) || !reader->at_end()) {
+        return std::nullopt;
+    }
+    return msg;
+}
+
+template <>
+std::optional<Service_snapshot> decode_compact_frame<Service_snapshot>(
+    score::cpp::span<std::uint8_t const> data) noexcept {
+    auto reader = open_compact_frame<Service_snapshot>(data);
+    Service_snapshot msg{};
+    if (!reader || !reader->get(msg.services) || !reader->get(msg.complete) ||
+        !reader->at_end()) {
+        return std::nullopt;
+    }
+    return msg;
+}
+
+template <>
+std::optional<Connect_service> decode_compact_frame<Connect_service>(
+    score::cpp::span<std::uint8_t const> data) noexcept {
+    auto reader = open_compact_frame<Connect_service>(data);
+    Connect_service msg{};
+    if (!reader || !reader->get(msg.service_key) || !reader->get(msg.required_id) ||
+        !reader->get(msg.metadata) || !reader->get(msg.in_use) || !reader->at_end()) {
+        return std::nullopt;
+    }
+    return msg;
+}
+
+template <>
+std::optional<Connect_service_reply> decode_compact_frame<Connect_service_reply>(
+    score::cpp::span<std::uint8_t const> data) noexcept {
+    auto reader = open_compact_frame<Connect_service_reply>(data);
+    Connect_service_reply msg{};
+    if (!reader || !reader->get(msg.required_id) || !reader->get(msg.provided_id) ||
+        !reader->get(msg.metadata) || !reader->get(msg.num_methods) ||
+        !reader->get(msg.num_events) || !reader->at_end()) {
+        return std::nullopt;
+    }
+    return msg;
+}
+
+}  // namespace score::gateway_ipc_binding
@@ -0,0 +1,73 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SRC_GATEWAY_IPC_BINDING_SRC_COMPACT_FRAME
+#define SRC_GATEWAY_IPC_BINDING_SRC_COMPACT_FRAME
+
+#include <cstdint>
+#include <optional>
+#include <score/span.hpp>
+#include <vector>
+
+#include "gateway_ipc_binding_util.hpp"
+#include "score/gateway_ipc_binding/gateway_ipc_binding.hpp"
+
+namespace score::gateway_ipc_binding {
+
+/// \brief Frame of a control message in compact wire form
+///
+/// Connect, Connect_continuation, Declare_service, Service_snapshot, Connect_service and
+/// Connect_service_reply mostly consist of fixed-size strings and containers, which are almost
+/// empty in practice. They are sent with a regular Message_frame_header followed by their fields in
+/// declaration order: integers and enums as LEB128 varints, bools as one byte, strings and
+/// containers as varint length followed by the used elements only. The header's payload_size holds
+/// the number of bytes after the header.
+///
+/// All other messages keep their trivially copyable Message_frame<T> layout.
+using Compact_frame = std::vector<std::uint8_t>;
+
+Compact_frame encode_compact_frame(Connect const& msg);
+Compact_frame encode_compact_frame(Connect_continuation const& msg);
+Compact_frame encode_compact_frame(Declare_service const& msg);
+Compact_frame encode_compact_frame(Service_snapshot const& msg);
+Compact_frame encode_compact_frame(Connect_service const& msg);
+Compact_frame encode_compact_frame(Connect_service_reply const& msg);
+
+/// \brief Decodes a frame created by encode_compact_frame()
+/// \param data Incoming message data (including framing)
+/// \return The message if type, sizes and all fields are valid, std::nullopt otherwise
+template <typename Msg_type>
+std::optional<Msg_type> decode_compact_frame(score::cpp::span<std::uint8_t const> data) noexcept;
+
+template <>
+std::optional<Connect> decode_compact_frame<Connect>(
+    score::cpp::span<std::uint8_t const> data) noexcept;
+template <>
+std::optional<Connect_continuation> decode_compact_frame<Connect_continuation>(
+    score::cpp::span<std::uint8_t const> data) noexcept;
+template <>
+std::optional<Declare_service> decode_compact_frame<Declare_service>(
+    score::cpp::span<std::uint8_t const> data) noexcept;
+template <>
+std::optional<Service_snapshot> decode_compact_frame<Service_snapshot>(
+    score::cpp::span<std::uint8_t const> data) noexcept;
+template <>
+std::optional<Connect_service> decode_compact_frame<Connect_service>(
+    score::cpp::span<std::uint8_t const> data) noexcept;
+template <>
+std::optional<Connect_service_reply> decode_compact_frame<Connect_service_reply>(
+    score::cpp::span<std::uint8_t const> data) noexcept;
+
+}  // namespace score::gateway_ipc_binding
+
+#endif  // SRC_GATEWAY_IPC_BINDING_SRC_COMPACT_FRAME
@@ -14,9 +14,11 @@
 #ifndef SRC_GATEWAY_IPC_BINDING_SRC_CONNECTION_METADATA
 #define SRC_GATEWAY_IPC_BINDING_SRC_CONNECTION_METADATA
 
-#include <algorithm>
 #include <cassert>
+#include <functional>
+#include <optional>
 #include <unordered_map>
+#include <utility>
 
 #include "key.hpp"
 #include "score/gateway_ipc_binding/gateway_ipc_binding_server.hpp"
@@ -24,6 +26,8 @@
 namespace score::gateway_ipc_binding {
 
 // This mapping represents fully established connections
+//
+// All lookups are hashed, removals only touch the affected mappings.
 class Connection_metadata {
    public:
     struct Ids {
@@ -34,40 +38,38 @@ class Connection_metadata {
         Shared_memory_metadata remote_metadata;
     };
 
-    using Client_id_to_metadata = std::unordered_map<Client_id, std::vector<Ids>>;
-
     template <typename Func>
     void for_each_client(Key_t const& key, Func&& func) const {
-        auto key_it = m_key_to_client_indices.find(key);
-        if (key_it == m_key_to_client_indices.end()) {
+        auto key_it = m_clients_by_key.find(key);
+        if (key_it == m_clients_by_key.end()) {
             return;
         }
 
-        for (auto const& [client_id, index] : key_it->second) {
-            auto client_it = m_id_to_key.find(client_id);
-            if (client_it == m_id_to_key.end() || index >= client_it->second.size()) {
-                continue;
-            }
-            func(client_id, client_it->second[index]);
+        for (auto const& [client_id, ids] : key_it->second) {
+            func(client_id, *ids);
         }
     }
 
     void add_mapping(Client_id const client_id, Ids ids) {
         assert(!is_mapping_present(client_id, ids) && "Mapping already exists for given client_id");
-        auto& ids_vec = m_id_to_key[client_id];
-        ids_vec.push_back(std::move(ids));
-        auto const index = ids_vec.size() - 1U;
-        m_key_to_client_indices[ids_vec[index].key][client_id] = index;
+        auto& client = m_clients[client_id];
+        auto const key = ids.key;
+        auto const local_handle = ids.local_handle;
+        auto const [it, inserted] = client.by_remote_handle.emplace(ids.remote_handle, ids);
+        assert(inserted && "Remote handle already used by client_id");
+        (void)inserted;
+        // Elements of unordered_map keep their address, so the indices can point to them
+        client.by_local_handle[local_handle] = &it->second;
+        m_clients_by_key[key][client_id] = &it->second;
     }
 
     std::optional<std::reference_wrapper<Ids const>> get_by_remote_handle(
         Client_id const client_id, Remote_handle const remote_handle) const {
-        auto it = m_id_to_key.find(client_id);
-        if (it != m_id_to_key.end()) {
-            for (const auto& ids : it->second) {
-                if (ids.remote_handle == remote_handle) {
-                    return std::cref(ids);
-                }
+        auto it = m_clients.find(client_id);
+        if (it != m_clients.end()) {
+            auto ids_it = it->second.by_remote_handle.find(remote_handle);
+            if (ids_it != it->second.by_remote_handle.end()) {
+                return std::cref(ids_it->second);
             }
         }
         return std::nullopt;
@@ -75,12 +77,11 @@ class Connection_metadata {
 
     std::optional<std::reference_wrapper<Ids const>> get_by_local_handle(
         Client_id const client_id, Remote_handle const local_handle) const {
-        auto it = m_id_to_key.find(client_id);
-        if (it != m_id_to_key.end()) {
-            for (const auto& ids : it->second) {
-                if (ids.local_handle == local_handle) {
-                    return std::cref(ids);
-                }
+        auto it = m_clients.find(client_id);
+        if (it != m_clients.end()) {
+            auto ids_it = it->second.by_local_handle.find(local_handle);
+            if (ids_it != it->second.by_local_handle.end()) {
+                return std::cref(*ids_it->second);
             }
         }
         return std::nullopt;
@@ -88,104 +89,103 @@ class Connection_metadata {
 
     // might need to return removed metadata for further cleanup
     void remove_client(Client_id const client_id) {
-        m_id_to_key.erase(client_id);
-        remove_client_from_key_indices(client_id);
+        auto it = m_clients.find(client_id);
+        if (it == m_clients.end()) {
+            return;
+        }
+
+        for (auto const& [remote_handle, ids] : it->second.by_remote_handle) {
+            remove_from_key_index(ids.key, client_id);
+        }
+        m_clients.erase(it);
     }
 
     void remove_mapping_for_client_and_key(Client_id const client_id, Key_t const& key) {
-        auto it = m_id_to_key.find(client_id);
-        if (it != m_id_to_key.end()) {
-            auto& vec = it->second;
-            vec.erase(std::remove_if(vec.begin(), vec.end(),
-                                     [&key](Ids const& ids) { return ids.key == key; }),
-                      vec.end());
-            if (vec.empty()) {
-                m_id_to_key.erase(it);
-                remove_client_from_key_indices(client_id);
-            } else {
-                rebuild_client_key_indices(client_id);
-            }
+        auto key_it = m_clients_by_key.find(key);
+        if (key_it == m_clients_by_key.end()) {
+            return;
+        }
+        auto client_it = key_it->second.find(client_id);
+        if (client_it != key_it->second.end()) {
+            remove_mapping(client_id, client_it->second->remote_handle);
         }
     }
 
     // might need to return removed metadata for further cleanup
     void remove_mapping(Client_id const client_id, Remote_handle const remote_handle) {
-        auto it = m_id_to_key.find(client_id);
-        if (it != m_id_to_key.end()) {
-            auto& vec = it->second;
-            vec.erase(std::remove_if(vec.begin(), vec.end(),
-                                     [remote_handle](Ids const& ids) {
-                                         return ids.remote_handle == remote_handle;
-                                     }),
-                      vec.end());
-            if (vec.empty()) {
-                m_id_to_key.erase(it);
-                remove_client_from_key_indices(client_id);
-            } else {
-                rebuild_client_key_indices(client_id);
-            }
+        auto it = m_clients.find(client_id);
+        if (it == m_clients.end()) {
+            return;
+        }
+
+        auto& client = it->second;
+        auto ids_it = client.by_remote_handle.find(remote_handle);
+        if (ids_it == client.by_remote_handle.end()) {
+            return;
+        }
+
+        remove_from_key_index(ids_it->second.key, client_id);
+        client.by_local_handle.erase(ids_it->second.local_handle);
+        client.by_remote_handle.erase(ids_it);
+        if (client.by_remote_handle.empty()) {
+            m_clients.erase(it);
         }
     }
 
     // might need to return removed metadata for further cleanup
     void remove_service(Key_t const& key) {
-        for (auto it = m_id_to_key.begin(); it != m_id_to_key.end();) {
-            auto& vec = it->second;
-            vec.erase(std::remove_if(vec.begin(), vec.end(),
-                                     [&key](Ids const& ids) { return ids.key == key; }),
-                      vec.end());
-            if (vec.empty()) {
-                remove_client_from_key_indices(it->first);
-                it = m_id_to_key.erase(it);
-            } else {
-                rebuild_client_key_indices(it->first);
-                ++it;
-            }
+        auto key_it = m_clients_by_key.find(key);
+        if (key_it == m_clients_by_key.end()) {
+            return;
+        }
+
+        // Moved out, remove_mapping() updates the key index
+        auto const clients = std::move(key_it->second);
+        m_clients_by_key.erase(key_it);
+        for (auto const& [client_id, ids] : clients) {
+            remove_mapping(client_id, ids->remote_handle);
         }
     }
 
    private:
+    struct Client_mappings {
+        std::unordered_map<Remote_handle, Ids> by_remote_handle;
+        std::unordered_map<Remote_handle, Ids const*> by_local_handle;
+    };
+
     bool is_mapping_present(Client_id const client_id, Ids const& ids) const {
-        auto it = m_id_to_key.find(client_id);
-        if (it != m_id_to_key.end()) {
-            for (const auto& existing_ids : it->second) {
-                if (existing_ids.local_handle == ids.local_handle || existing_ids.key == ids.key) {
-                    assert(existing_ids.local_handle == ids.local_handle &&
-                           existing_ids.key == ids.key &&
-                           "Inconsistent mapping found for client_id");
-                    return true;
-                }
-            }
+        auto const by_local_handle = get_by_local_handle(client_id, ids.local_handle);
+        auto const* by_key = find_in_key_index(ids.key, client_id);
+        if (!by_local_handle && by_key == nullptr) {
+            return false;
         }
-        return false;
+        assert(by_local_handle && &by_local_handle->get() == by_key &&
+               "Inconsistent mapping found for client_id");
+        return true;
     }
 
-    void remove_client_from_key_indices(Client_id const client_id) {
-        for (auto it = m_key_to_client_indices.begin(); it != m_key_to_client_indices.end();) {
-            it->second.erase(client_id);
-            if (it->second.empty()) {
-                it = m_key_to_client_indices.erase(it);
-            } else {
-                ++it;
-            }
+    Ids const* find_in_key_index(Key_t const& key, Client_id const client_id) const {
+        auto key_it = m_clients_by_key.find(key);
+        if (key_it == m_clients_by_key.end()) {
+            return nullptr;
         }
+        auto client_it = key_it->second.find(client_id);
+        return client_it == key_it->second.end() ? nullptr : client_it->second;
     }
 
-    void rebuild_client_key_indices(Client_id const client_id) {
-        remove_client_from_key_indices(client_id);
-
-        auto const client_it = m_id_to_key.find(client_id);
-        if (client_it == m_id_to_key.end()) {
+    void remove_from_key_index(Key_t const& key, Client_id const client_id) {
+        auto key_it = m_clients_by_key.find(key);
+        if (key_it == m_clients_by_key.end()) {
             return;
         }
-
-        for (std::size_t i = 0U; i < client_it->second.size(); ++i) {
-            m_key_to_client_indices[client_it->second[i].key][client_id] = i;
+        key_it->second.erase(client_id);
+        if (key_it->second.empty()) {
+            m_clients_by_key.erase(key_it);
         }
     }
 
-    Client_id_to_metadata m_id_to_key;
-    std::unordered_map<Key_t, std::unordered_map<Client_id, std::size_t>> m_key_to_client_indices;
+    std::unordered_map<Client_id, Client_mappings> m_clients;
+    std::unordered_map<Key_t, std::unordered_map<Client_id, Ids const*>> m_clients_by_key;
 };
 
 }  // namespace score::gateway_ipc_binding
@@ -41,19 +41,11 @@ class Connections {
         return connection_it->second.get().send(msg);
     }
 
-    template <typename Msg_frame>
-    Result<void> send_to_all(Msg_frame const& msg) const noexcept {
-        static_assert(std::is_trivially_copyable_v<Msg_frame>,
-                      "Msg_frame must be trivially copyable for send_to_all");
-
-        Result<void> last_failure = {};
-        for (auto& entry : m_connections) {
-            auto send_result = entry.second.get().send(msg);
-            if (!send_result) {
-                last_failure = send_result;
-            }
+    template <typename Function>
+    void for_each(Function&& function) const {
+        for (auto const& entry : m_connections) {
+            function(entry.first, entry.second.get());
         }
-        return last_failure;
     }
 
     void add_client(Client_id const& client_id, Reply_channel& reply_channel) {
@@ -0,0 +1,534 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "data_ring.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <pthread.h>
+#include <sched.h>
+
+#include "score/gateway_ipc_binding/error.hpp"
+#include "score/memory/shared/shared_memory_factory.h"
+#include "score/mw/log/logging.h"
+
+namespace score::gateway_ipc_binding {
+
+namespace {
+
+constexpr std::size_t k_cache_line_size = 64U;
+constexpr std::size_t k_min_capacity = 4U * 1024U;
+constexpr std::size_t k_max_capacity = 16U * 1024U * 1024U;
+constexpr std::size_t k_record_alignment = 8U;
+/// \brief Minimum time between two reports of messages sent around the ring
+constexpr std::chrono::seconds k_detour_log_interval{1};
+constexpr std::uint32_t k_wrap_marker = std::numeric_limits<std::uint32_t>::max();
+/// \brief Record size of a message sent through the socket instead of its lane
+constexpr std::uint32_t k_detour_marker = k_wrap_marker - 1U;
+constexpr std::size_t k_data_lane = static_cast<std::size_t>(Data_ring::Lane::data);
+constexpr std::size_t k_control_lane = static_cast<std::size_t>(Data_ring::Lane::control);
+
+struct Record_header {
+    std::uint32_t size;
+    std::uint32_t reserved;
+};
+
+static_assert(sizeof(Record_header) == k_record_alignment);
+
+constexpr std::size_t align_to_record(std::size_t size) noexcept {
+    return (size + k_record_alignment - 1U) / k_record_alignment * k_record_alignment;
+}
+
+constexpr std::size_t record_size(std::size_t message_size) noexcept {
+    return align_to_record(sizeof(Record_header) + message_size);
+}
+
+/// \brief Kept free by each push, so a detour marker always fits
+constexpr std::size_t k_detour_record_size = sizeof(Record_header);
+
+}  // namespace
+
+/// \brief Positions of one lane
+///
+/// Positions count the bytes written and read since creation and are masked with the capacity to
+/// get offsets. Producer and consumer fields live on separate cache lines.
+struct Data_ring::Lane_positions {
+    alignas(k_cache_line_size) std::atomic<std::uint64_t> head{0U};
+    alignas(k_cache_line_size) std::atomic<std::uint64_t> tail{0U};
+};
+
+/// \brief Shared control block of one direction
+struct Data_ring::Ring {
+    std::array<Lane_positions, 2U> lanes;
+    alignas(k_cache_line_size) std::atomic<std::uint32_t> consumer_idle{1U};
+};
+
+// Atomics used across processes must be address-free, which only holds for lock-free atomics
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free);
+static_assert(std::atomic<std::uint32_t>::is_always_lock_free);
+
+bool Data_ring::is_valid_capacity(std::size_t capacity) noexcept {
+    return capacity >= k_min_capacity && capacity <= k_max_capacity &&
+           (capacity & (capacity - 1U)) == 0U;
+}
+
+std::size_t Data_ring::get_control_capacity(std::size_t capacity) noexcept {
+    return std::max(capacity / 4U, k_min_capacity);
+}
+
+Data_ring::Lane Data_ring::get_lane(Message_type type) noexcept {
+    return is_data_message(type) ? Lane::data : Lane::control;
+}
+
+Result<Data_ring::Uptr> Data_ring::create(std::string const& path, std::size_t capacity) noexcept {
+    if (!is_valid_capacity(capacity)) {
+        return MakeUnexpected(Bidirectional_channel_error::logic_error_invalid_argument,
+                              "Invalid data ring capacity");
+    }
+
+    score::memory::shared::SharedMemoryFactory factory;
+    factory.RemoveStaleArtefacts(path);
+
+    score::memory::shared::SharedMemoryFactory::InitializeCallback init_callback =
+        [](std::shared_ptr<score::memory::shared::ISharedMemoryResource> /* resource */) {
+            // Rings are initialized below
+        };
+
+    // The control blocks of both directions, followed by their data lanes and control lanes
+    auto const size = 2U * sizeof(Ring) + 2U * capacity + 2U * get_control_capacity(capacity);
+    auto shared_memory = factory.Create(path, std::move(init_callback), size);
+    if (!shared_memory) {
+        return MakeUnexpected(
+            Shared_memory_manager_error::runtime_error_shared_memory_allocation_failed);
+    }
+
+    auto* const base_address = shared_memory->allocate(size, k_cache_line_size);
+    if (!base_address) {
+        return MakeUnexpected(
+            Shared_memory_manager_error::runtime_error_shared_memory_allocation_failed);
+    }
+
+    auto* const rings = static_cast<Ring*>(base_address);
+    new (&rings[0]) Ring{};
+    new (&rings[1]) Ring{};
+
+    return std::make_unique<Data_ring>(std::move(shared_memory), base_address, capacity, true);
+}
+
+Result<Data_ring::Uptr> Data_ring::open(std::string const& path, std::size_t capacity) noexcept {
+    if (!is_valid_capacity(capacity)) {
+        return MakeUnexpected(Bidirectional_channel_error::logic_error_invalid_argument,
+                              "Invalid data ring capacity");
+    }
+
+    auto shared_memory = score::memory::shared::SharedMemoryFactory::Open(path, true);
+    if (shared_memory == nullptr) {
+        return MakeUnexpected(
+            Shared_memory_manager_error::runtime_error_shared_memory_allocation_failed);
+    }
+
+    auto* const base_address = shared_memory->getUsableBaseAddress();
+    return std::make_unique<Data_ring>(std::move(shared_memory), base_address, capacity, false);
+}
+
+Data_ring::Data_ring(std::shared_ptr<score::memory::shared::ISharedMemoryResource> shared_memory,
+                     void* base_address, std::size_t capacity, bool is_creator) noexcept
+    : m_shared_memory(std::move(shared_memory)), m_is_creator(is_creator) {
+    assert(m_shared_memory != nullptr);
+    assert(base_address != nullptr);
+    assert(is_valid_capacity(capacity));
+
+    auto const control_capacity = get_control_capacity(capacity);
+    auto* const rings = static_cast<Ring*>(base_address);
+    auto* const data = static_cast<std::uint8_t*>(base_address) + 2U * sizeof(Ring);
+    auto* const control = data + 2U * capacity;
+    auto const tx_index = is_creator ? 0U : 1U;
+    auto const rx_index = 1U - tx_index;
+
+    m_tx = &rings[tx_index];
+    m_rx = &rings[rx_index];
+    auto const init_lanes = [this, tx_index, rx_index](std::size_t lane, std::uint8_t* lane_data,
+                                                        std::size_t lane_capacity) {
+        auto& tx_positions = m_tx->lanes[lane];
+        m_tx_lanes[lane] = {&tx_positions, lane_data + tx_index * lane_capacity, lane_capacity,
+                            tx_positions.head.load(std::memory_order_acquire)};
+        auto& rx_positions = m_rx->lanes[lane];
+        m_rx_lanes[lane] = {&rx_positions, lane_data + rx_index * lane_capacity, lane_capacity,
+                            rx_positions.tail.load(std::memory_order_acquire)};
+    };
+    init_lanes(k_data_lane, data, capacity);
+    init_lanes(k_control_lane, control, control_capacity);
+}
+
+Data_ring::~Data_ring() noexcept {
+    if (m_is_creator) {
+        m_shared_memory->UnlinkFilesystemEntry();
+    }
+}
+
+std::string const& Data_ring::get_path() const noexcept {
+    static std::string const unknown{"<unknown>"};
+    auto const* const path = m_shared_memory->getPath();
+    return path != nullptr ? *path : unknown;
+}
+
+Data_ring::Push_result Data_ring::push(Lane lane,
+                                       score::cpp::span<std::uint8_t const> data) noexcept {
+    auto& tx = m_tx_lanes[static_cast<std::size_t>(lane)];
+    auto const size = record_size(data.size());
+    if (size > tx.capacity / 2U) {
+        return Push_result::too_large;
+    }
+
+    auto const offset = tx.head & (tx.capacity - 1U);
+    auto const contiguous = tx.capacity - offset;
+    auto const padding = contiguous < size ? contiguous : 0U;
+    auto const tail = tx.positions->tail.load(std::memory_order_acquire);
+    if (tx.head + padding + size + k_detour_record_size - tail > tx.capacity) {
+        return Push_result::full;
+    }
+
+    if (padding != 0U) {
+        Record_header const wrap{k_wrap_marker, 0U};
+        std::memcpy(tx.data + offset, &wrap, sizeof(wrap));
+        tx.head += padding;
+    }
+
+    auto* const record = tx.data + (tx.head & (tx.capacity - 1U));
+    Record_header const header{static_cast<std::uint32_t>(data.size()), 0U};
+    std::memcpy(record, &header, sizeof(header));
+    std::memcpy(record + sizeof(header), data.data(), data.size());
+    tx.head += size;
+
+    // Sequentially consistent like the idle announcement of the consumer: either the producer
+    // sees the consumer idle, or the consumer sees the new head before it goes idle.
+    tx.positions->head.store(tx.head, std::memory_order_seq_cst);
+    return claim_idle_consumer() ? Push_result::pushed_consumer_idle : Push_result::pushed;
+}
+
+bool Data_ring::push_detour(Lane lane) noexcept {
+    auto& tx = m_tx_lanes[static_cast<std::size_t>(lane)];
+    // Every record reserves the room for a marker after it, only consecutive detours may lack it
+    auto const tail = tx.positions->tail.load(std::memory_order_acquire);
+    if (tx.head + k_detour_record_size - tail > tx.capacity) {
+        return false;
+    }
+
+    // Records are aligned to their header size, so the marker never has to wrap
+    Record_header const header{k_detour_marker, 0U};
+    std::memcpy(tx.data + (tx.head & (tx.capacity - 1U)), &header, sizeof(header));
+    tx.head += k_detour_record_size;
+    tx.positions->head.store(tx.head, std::memory_order_seq_cst);
+    return true;
+}
+
+bool Data_ring::claim_idle_consumer() noexcept {
+    return m_tx->consumer_idle.load(std::memory_order_seq_cst) != 0U &&
+           m_tx->consumer_idle.exchange(0U, std::memory_order_seq_cst) != 0U;
+}
+
+std::optional<Data_ring::Message> Data_ring::front() noexcept {
+    // A control message written before a data message is published before it, so reading the
+    // control lane first keeps their order. Messages after a detour wait for the detoured one.
+    for (auto const lane : {Lane::control, Lane::data}) {
+        auto& rx = m_rx_lanes[static_cast<std::size_t>(lane)];
+        if (auto const record = front(rx)) {
+            return record->is_detour ? std::nullopt : std::optional<Message>{Message{
+                                                          record->data, lane}};
+        }
+    }
+    return std::nullopt;
+}
+
+std::optional<Data_ring::Message> Data_ring::front(Lane detoured_lane) noexcept {
+    auto& control = m_rx_lanes[k_control_lane];
+    auto const control_record = front(control);
+    if (control_record && !control_record->is_detour) {
+        return Message{control_record->data, Lane::control};
+    }
+    if (detoured_lane == Lane::control) {
+        return std::nullopt;
+    }
+
+    // A detour of the control lane is handled later, its message was sent after this one
+    auto const data_record = front(m_rx_lanes[k_data_lane]);
+    if (data_record && !data_record->is_detour) {
+        return Message{data_record->data, Lane::data};
+    }
+    return std::nullopt;
+}
+
+bool Data_ring::pop_detour(Lane lane) noexcept {
+    auto& rx = m_rx_lanes[static_cast<std::size_t>(lane)];
+    auto const record = front(rx);
+    if (!record || !record->is_detour) {
+        return false;
+    }
+    pop();
+    return true;
+}
+
+std::optional<Data_ring::Rx_record> Data_ring::front(Rx_lane& rx) noexcept {
+    if (m_rx_malformed) {
+        return std::nullopt;
+    }
+
+    auto const head = rx.positions->head.load(std::memory_order_acquire);
+    while (rx.tail != head) {
+        auto const offset = rx.tail & (rx.capacity - 1U);
+        auto const available = head - rx.tail;
+        Record_header header{};
+        std::memcpy(&header, rx.data + offset, sizeof(header));
+        auto const size = header.size == k_wrap_marker     ? rx.capacity - offset
+                          : header.size == k_detour_marker ? k_detour_record_size
+                                                           : record_size(header.size);
+        if (available > rx.capacity || size > rx.capacity - offset || size > available) {
+            score::mw::log::LogError() << "[gateway_ipc_binding] Malformed record in data ring "
+                                       << get_path();
+            m_rx_malformed = true;
+            return std::nullopt;
+        }
+
+        if (header.size == k_wrap_marker) {
+            rx.tail += size;
+            continue;
+        }
+
+        m_rx_front_lane = &rx;
+        m_rx_record_size = size;
+        if (header.size == k_detour_marker) {
+            return Rx_record{{}, true};
+        }
+        return Rx_record{
+            score::cpp::span<std::uint8_t const>(rx.data + offset + sizeof(header), header.size),
+            false};
+    }
+    return std::nullopt;
+}
+
+void Data_ring::pop() noexcept {
+    auto& rx = *m_rx_front_lane;
+    rx.tail += m_rx_record_size;
+    m_rx_record_size = 0U;
+    rx.positions->tail.store(rx.tail, std::memory_order_release);
+}
+
+bool Data_ring::try_enter_idle() noexcept {
+    if (m_rx_malformed) {
+        return true;
+    }
+
+    m_rx->consumer_idle.store(1U, std::memory_order_seq_cst);
+    // A lane waiting for its detoured message is read on in the order of the socket messages
+    auto const is_empty = [this](Rx_lane& rx) {
+        if (rx.positions->head.load(std::memory_order_seq_cst) == rx.tail) {
+            return true;
+        }
+        auto const record = front(rx);
+        return record && record->is_detour;
+    };
+    if (std::all_of(m_rx_lanes.begin(), m_rx_lanes.end(), is_empty)) {
+        return true;
+    }
+
+    // A producer which saw the idle flag rings the doorbell anyway, which then finds the messages
+    // already read. That is cheaper than waiting for it.
+    m_rx->consumer_idle.store(0U, std::memory_order_relaxed);
+    return false;
+}
+
+void Data_ring::leave_idle() noexcept {
+    m_rx->consumer_idle.store(0U, std::memory_order_seq_cst);
+}
+
+namespace {
+
+/// \brief Waits a moment between two polls of empty lanes
+void relax(Busy_poll_wait wait) noexcept {
+    if (wait == Busy_poll_wait::yield) {
+        std::this_thread::yield();
+        return;
+    }
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield");
+#endif
+}
+
+void pin_current_thread(std::size_t cpu) noexcept {
+#if defined(__linux__)
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    CPU_SET(cpu, &cpus);
+    auto const result = pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus);
+    if (result != 0) {
+        score::mw::log::LogWarn()
+            << "[gateway_ipc_binding] Failed to pin data ring polling thread to CPU " << cpu
+            << ": " << std::strerror(result);
+    }
+#else
+    score::mw::log::LogWarn()
+        << "[gateway_ipc_binding] Pinning the data ring polling thread to CPU " << cpu
+        << " is not supported on this platform";
+#endif
+}
+
+}  // namespace
+
+struct Data_ring_endpoint::Poller {
+    Busy_poll busy_poll;
+    On_message on_message;
+    std::mutex mutex;
+    std::condition_variable wake;
+    bool woken{false};    // Protected by mutex
+    bool stopped{false};  // Protected by mutex
+    // Read while spinning, without mutex
+    std::atomic<bool> stopping{false};
+    std::thread thread;
+};
+
+Data_ring_endpoint::Data_ring_endpoint(std::chrono::microseconds full_ring_timeout) noexcept
+    : m_full_ring_timeout(full_ring_timeout) {}
+
+Data_ring_endpoint::~Data_ring_endpoint() noexcept { stop_polling(); }
+
+void Data_ring_endpoint::start_polling(Busy_poll const& busy_poll, On_message on_message) {
+    if (busy_poll.spin_budget <= std::chrono::microseconds::zero() || m_poller != nullptr) {
+        return;
+    }
+
+    m_poller = std::make_unique<Poller>();
+    m_poller->busy_poll = busy_poll;
+    m_poller->on_message = std::move(on_message);
+    m_poller->thread = std::thread([this, &poller = *m_poller]() { run_poller(poller); });
+}
+
+void Data_ring_endpoint::stop_polling() noexcept {
+    if (m_poller == nullptr) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> const lock{m_poller->mutex};
+        m_poller->stopped = true;
+    }
+    m_poller->stopping.store(true, std::memory_order_relaxed);
+    m_poller->wake.notify_one();
+    m_poller->thread.join();
+    m_poller.reset();
+}
+
+void Data_ring_endpoint::wake_poller() noexcept {
+    if (m_poller == nullptr) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> const lock{m_poller->mutex};
+        m_poller->woken = true;
+    }
+    m_poller->wake.notify_one();
+}
+
+void Data_ring_endpoint::log_detour(Data_ring::Lane lane, Data_ring::Push_result reason,
+                                    bool sent) noexcept {
+    std::lock_guard<std::mutex> const lock{m_log_mutex};
+    ++m_detours_since_log;
+    auto const now = Clock::now();
+    if (sent && m_detours_logged_at.has_value() &&
+        now - *m_detours_logged_at < k_detour_log_interval) {
+        return;
+    }
+
+    score::mw::log::LogWarn() << "[gateway_ipc_binding] " << m_detours_since_log
+                              << " message(s) sent through the socket instead of the "
+                              << (lane == Data_ring::Lane::data ? "data" : "control")
+                              << " lane of data ring " << m_ring->get_path() << ", last one "
+                              << (reason == Data_ring::Push_result::too_large
+                                      ? "does not fit into the lane"
+                                      : "found the lane full")
+                              << (sent ? "" : " and was not sent, the lane stayed blocked");
+    m_detours_logged_at = now;
+    m_detours_since_log = 0U;
+}
+
+void Data_ring_endpoint::log_missing_detour_marker() const noexcept {
+    score::mw::log::LogError()
+        << "[gateway_ipc_binding] Detoured message without detour marker in data ring "
+        << m_ring->get_path();
+}
+
+void Data_ring_endpoint::run_poller(Poller& poller) noexcept {
+    if (poller.busy_poll.cpu.has_value()) {
+        pin_current_thread(*poller.busy_poll.cpu);
+    }
+
+    std::unique_lock<std::mutex> lock{poller.mutex};
+    while (true) {
+        poller.wake.wait(lock, [&poller]() { return poller.stopped || poller.woken; });
+        if (poller.stopped) {
+            return;
+        }
+        poller.woken = false;
+
+        lock.unlock();
+        spin(poller);
+        lock.lock();
+    }
+}
+
+void Data_ring_endpoint::spin(Poller& poller) noexcept {
+    {
+        std::lock_guard<std::mutex> const lock{m_rx_mutex};
+        if (m_ring == nullptr) {
+            return;
+        }
+        m_ring->leave_idle();
+    }
+
+    auto last_message = Clock::now();
+    while (!poller.stopping.load(std::memory_order_relaxed)) {
+        {
+            std::lock_guard<std::mutex> const lock{m_rx_mutex};
+            if (m_ring == nullptr) {
+                return;
+            }
+
+            auto received = false;
+            while (auto const message = m_ring->front()) {
+                poller.on_message(message->data, message->lane);
+                m_ring->pop();
+                received = true;
+            }
+            if (received) {
+                last_message = Clock::now();
+                continue;
+            }
+            // Producers ring the doorbell again from now on, which wakes this thread
+            if (Clock::now() - last_message >= poller.busy_poll.spin_budget &&
+                m_ring->try_enter_idle()) {
+                return;
+            }
+        }
+        relax(poller.busy_poll.wait);
+    }
+}
+
+}  // namespace score::gateway_ipc_binding
@@ -0,0 +1,407 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SRC_GATEWAY_IPC_BINDING_SRC_DATA_RING
+#define SRC_GATEWAY_IPC_BINDING_SRC_DATA_RING
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <score/span.hpp>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include "gateway_ipc_binding_util.hpp"
+#include "score/gateway_ipc_binding/error.hpp"
+#include "score/gateway_ipc_binding/gateway_ipc_binding.hpp"
+#include "score/result/result.h"
+
+namespace score::memory::shared {
+class ISharedMemoryResource;
+}
+
+namespace score::gateway_ipc_binding {
+
+/// \brief Single-producer single-consumer byte rings of both directions in one shared memory
+///
+/// The creator writes the rings of the first direction and reads those of the second one, the
+/// opener the other way round. Each direction has two lanes: data messages, see is_data_message(),
+/// go to the data lane of the configured capacity, all other messages to a smaller control lane.
+/// The consumer reads the control lane before each message of the data lane, so control messages
+/// overtake the data messages written before them, but never the other way round.
+///
+/// Each message is stored as a record: an 8 byte header holding the message size, followed by the
+/// message, padded to 8 bytes. Records never wrap around the end of a lane, the producer stores a
+/// wrap marker instead and continues at the start of the lane.
+///
+/// A message which does not fit into its lane in time is sent through the socket instead, in
+/// place of a detour marker the producer stores in the lane. The consumer does not read past the
+/// marker until the receiver of the socket message took it with pop_detour(). Each push keeps room
+/// for one marker, so it always fits.
+///
+/// Besides its read positions, the consumer publishes whether it went idle. A producer claims
+/// the idle flag after publishing a record and has to wake up the consumer only if the flag was
+/// set, so a consumer that keeps reading is never woken up.
+///
+/// The writing side of each lane and the reading side each have to be serialized by the owner.
+class Data_ring {
+   public:
+    using Uptr = std::unique_ptr<Data_ring>;
+
+    enum class Lane : std::uint8_t { data, control };
+
+    enum class Push_result : std::uint8_t {
+        /// The message was appended
+        pushed,
+        /// The message was appended and the consumer has to be woken up
+        pushed_consumer_idle,
+        /// Not enough space until the consumer reads more messages
+        full,
+        /// The message does not fit into the lane at all
+        too_large,
+    };
+
+    struct Message {
+        score::cpp::span<std::uint8_t const> data;
+        Lane lane;
+    };
+
+    /// \brief Checks that capacity is a power of two between 4 KiB and 16 MiB
+    static bool is_valid_capacity(std::size_t capacity) noexcept;
+
+    /// \brief Capacity of the control lanes of a ring with a data lane capacity
+    static std::size_t get_control_capacity(std::size_t capacity) noexcept;
+
+    /// \brief Lane which carries messages of type
+    static Lane get_lane(Message_type type) noexcept;
+
+    /// \brief Creates the shared memory at path holding the lanes of both directions
+    /// \param capacity Bytes of the data lane per direction
+    static Result<Uptr> create(std::string const& path, std::size_t capacity) noexcept;
+
+    /// \brief Opens the shared memory created by the peer with create()
+    static Result<Uptr> open(std::string const& path, std::size_t capacity) noexcept;
+
+    Data_ring(std::shared_ptr<score::memory::shared::ISharedMemoryResource> shared_memory,
+              void* base_address, std::size_t capacity, bool is_creator) noexcept;
+    ~Data_ring() noexcept;
+
+    Data_ring(Data_ring const&) = delete;
+    Data_ring& operator=(Data_ring const&) = delete;
+    Data_ring(Data_ring&&) = delete;
+    Data_ring& operator=(Data_ring&&) = delete;
+
+    std::string const& get_path() const noexcept;
+
+    /// \brief Appends a message to an outgoing lane
+    Push_result push(Lane lane, score::cpp::span<std::uint8_t const> data) noexcept;
+
+    /// \brief Appends a detour marker for the next message of lane, which is sent through the
+    ///        socket instead
+    /// \return false if the marker of an earlier detour was not read yet and took its room
+    bool push_detour(Lane lane) noexcept;
+
+    /// \brief Claims the wake-up of the consumer of the outgoing lanes
+    /// \return true if the consumer was idle and the caller has to wake it up
+    bool claim_idle_consumer() noexcept;
+
+    /// \brief Oldest unread message of the incoming control lane, else of the incoming data lane
+    /// \return Message which stays valid until pop(), std::nullopt if both lanes are empty or one
+    ///         holds a malformed record
+    std::optional<Message> front() noexcept;
+
+    /// \brief Oldest unread message written before the detour marker of detoured_lane
+    ///
+    /// For the receiver of a message sent through the socket, which passes a detour of the control
+    /// lane to reach the one of the data lane.
+    /// \return std::nullopt if detoured_lane is empty or at its detour marker
+    std::optional<Message> front(Lane detoured_lane) noexcept;
+
+    /// \brief Takes the detour marker at the front of lane
+    /// \return false if the next record of lane is no detour marker
+    bool pop_detour(Lane lane) noexcept;
+
+    /// \brief Releases the message returned by front()
+    void pop() noexcept;
+
+    /// \brief Announces to the producer that the consumer went idle
+    /// \return false if messages arrived in between, the consumer then stays busy and has to read
+    ///         them
+    bool try_enter_idle() noexcept;
+
+    /// \brief Announces to the producer that the consumer polls the incoming lanes, so that no
+    ///        doorbell is rung until try_enter_idle()
+    void leave_idle() noexcept;
+
+   private:
+    struct Lane_positions;
+    struct Ring;
+
+    struct Tx_lane {
+        Lane_positions* positions;
+        std::uint8_t* data;
+        std::size_t capacity;
+        std::uint64_t head;
+    };
+
+    struct Rx_lane {
+        Lane_positions* positions;
+        std::uint8_t const* data;
+        std::size_t capacity;
+        std::uint64_t tail;
+    };
+
+    struct Rx_record {
+        score::cpp::span<std::uint8_t const> data;
+        bool is_detour;
+    };
+
+    /// \brief Next record of lane after wrap markers, which is released by pop()
+    std::optional<Rx_record> front(Rx_lane& lane) noexcept;
+
+    std::shared_ptr<score::memory::shared::ISharedMemoryResource> m_shared_memory;
+    bool m_is_creator;
+    Ring* m_tx;
+    std::array<Tx_lane, 2U> m_tx_lanes;
+    Ring* m_rx;
+    std::array<Rx_lane, 2U> m_rx_lanes;
+    Rx_lane* m_rx_front_lane{nullptr};
+    std::size_t m_rx_record_size{0U};
+    bool m_rx_malformed{false};
+};
+
+/// \brief Data ring of one connection together with the state of its writing side
+///
+/// Until activate() all messages are sent through the socket. attach(), detach(), drain() and
+/// receive_detour() must be called by the thread receiving the socket messages of the connection,
+/// send() may be called by any thread. Senders of the control lane do not wait for those of the
+/// data lane, which may spin on a full ring.
+///
+/// With start_polling(), a thread of the endpoint reads the incoming lanes as described by
+/// Busy_poll, serialized with drain() and receive_detour() by m_rx_mutex. start_polling() and
+/// stop_polling() must not be called concurrently with drain().
+class Data_ring_endpoint {
+   public:
+    using Clock = std::chrono::steady_clock;
+
+    /// \brief Called for each message read from the incoming lanes, with its lane
+    using On_message =
+        std::function<void(score::cpp::span<std::uint8_t const>, Data_ring::Lane)>;
+
+    explicit Data_ring_endpoint(std::chrono::microseconds full_ring_timeout) noexcept;
+    ~Data_ring_endpoint() noexcept;
+
+    Data_ring_endpoint(Data_ring_endpoint const&) = delete;
+    Data_ring_endpoint& operator=(Data_ring_endpoint const&) = delete;
+    Data_ring_endpoint(Data_ring_endpoint&&) = delete;
+    Data_ring_endpoint& operator=(Data_ring_endpoint&&) = delete;
+
+    /// \brief Replaces the ring, the endpoint sends through the socket until activate()
+    void attach(Data_ring::Uptr ring) noexcept {
+        std::scoped_lock const lock{m_mutex, m_control_mutex, m_rx_mutex};
+        m_ring = std::move(ring);
+        m_writing = false;
+        m_rx_detour_pending = false;
+    }
+
+    void detach() noexcept { attach(nullptr); }
+
+    Data_ring* get_ring() const noexcept { return m_ring.get(); }
+
+    /// \brief Sends all further messages through the ring
+    void activate() noexcept {
+        std::scoped_lock const lock{m_mutex, m_control_mutex};
+        m_writing = m_ring != nullptr;
+    }
+
+    /// \brief Sends data through its lane of the ring if active, otherwise through send_on_socket
+    ///
+    /// A message which never fits into its lane, or whose lane stays full for longer than the
+    /// configured timeout, is sent through the socket in place of a detour marker, see Data_ring.
+    /// The next message uses the ring again.
+    template <typename Send_on_socket>
+    Result<void> send(score::cpp::span<std::uint8_t const> data,
+                      Send_on_socket&& send_on_socket) noexcept {
+        auto const lane = data.empty() ? Data_ring::Lane::control
+                                       : Data_ring::get_lane(get_message_type(data[0]));
+        std::lock_guard<std::mutex> const lock{lane == Data_ring::Lane::data ? m_mutex
+                                                                             : m_control_mutex};
+        // Both lanes may send through the socket at the same time
+        auto const send_serialized = [this, &send_on_socket](auto const socket_data) {
+            std::lock_guard<std::mutex> const socket_lock{m_socket_mutex};
+            return send_on_socket(socket_data);
+        };
+        if (!m_writing.load(std::memory_order_acquire)) {
+            return send_serialized(data);
+        }
+
+        auto deadline = Clock::now() + m_full_ring_timeout;
+        auto result = m_ring->push(lane, data);
+        while (result == Data_ring::Push_result::full && Clock::now() < deadline) {
+            if (m_ring->claim_idle_consumer()) {
+                static_cast<void>(send_doorbell(send_serialized));
+            }
+            std::this_thread::yield();
+            result = m_ring->push(lane, data);
+        }
+
+        switch (result) {
+            case Data_ring::Push_result::pushed:
+                return {};
+            case Data_ring::Push_result::pushed_consumer_idle:
+                return send_doorbell(send_serialized);
+            case Data_ring::Push_result::full:
+            case Data_ring::Push_result::too_large:
+            default:
+                break;
+        }
+
+        // Only the marker of an earlier detour, which was not read yet, may take its room
+        deadline = Clock::now() + m_full_ring_timeout;
+        while (!m_ring->push_detour(lane)) {
+            if (Clock::now() >= deadline) {
+                log_detour(lane, result, false);
+                return MakeUnexpected(Bidirectional_channel_error::runtime_error_send_failed,
+                                      "Data ring lane is blocked");
+            }
+            std::this_thread::yield();
+        }
+        log_detour(lane, result, true);
+
+        // The doorbell makes the receiver read the lane up to the marker and take the directly
+        // following socket message for the detoured one
+        std::lock_guard<std::mutex> const socket_lock{m_socket_mutex};
+        auto const rung = send_doorbell(send_on_socket, true);
+        if (!rung) {
+            return rung;
+        }
+        return send_on_socket(data);
+    }
+
+    /// \brief Passes all messages of the incoming lanes to on_message with their lane, control
+    ///        messages first
+    ///
+    /// Afterwards, the polling thread takes over reading, if started. For a doorbell announcing a
+    /// detour, the lanes are read up to the detour marker, receive_detour() reads on.
+    template <typename Message_handler>
+    void drain(Data_ring_doorbell const& doorbell, Message_handler&& on_message) {
+        {
+            std::lock_guard<std::mutex> const lock{m_rx_mutex};
+            if (m_ring == nullptr) {
+                return;
+            }
+            m_rx_detour_pending = doorbell.detour;
+            drain_locked(on_message);
+        }
+        wake_poller();
+    }
+
+    /// \brief Passes a socket message which follows a doorbell announcing a detour to on_message,
+    ///        in the order in which it was sent
+    ///
+    /// The messages written before its detour marker are passed first, the remaining ones
+    /// afterwards like by drain().
+    /// \return false if data is no detoured message, it was not passed then
+    template <typename Message_handler>
+    bool receive_detour(score::cpp::span<std::uint8_t const> data, Message_handler&& on_message) {
+        {
+            std::lock_guard<std::mutex> const lock{m_rx_mutex};
+            if (m_ring == nullptr || !m_rx_detour_pending || data.empty()) {
+                return false;
+            }
+            m_rx_detour_pending = false;
+
+            auto const lane = Data_ring::get_lane(get_message_type(data[0]));
+            while (auto const message = m_ring->front(lane)) {
+                on_message(message->data, message->lane);
+                m_ring->pop();
+            }
+            if (!m_ring->pop_detour(lane)) {
+                // The peer did not follow the protocol, the lane stays stalled
+                log_missing_detour_marker();
+            }
+            on_message(data, lane);
+            drain_locked(on_message);
+        }
+        wake_poller();
+        return true;
+    }
+
+    /// \brief Starts the thread polling the incoming lanes, on_message is called by it
+    ///
+    /// Does nothing if busy_poll has no spin budget or polling already started. The thread waits
+    /// for the first drain() before it polls.
+    void start_polling(Busy_poll const& busy_poll, On_message on_message);
+
+    /// \brief Stops the polling thread, has to be called before on_message becomes invalid
+    void stop_polling() noexcept;
+
+   private:
+    struct Poller;
+
+    void wake_poller() noexcept;
+
+    template <typename Message_handler>
+    void drain_locked(Message_handler& on_message) {
+        do {
+            while (auto const message = m_ring->front()) {
+                on_message(message->data, message->lane);
+                m_ring->pop();
+            }
+        } while (!m_ring->try_enter_idle());
+    }
+
+    /// \brief Reports messages sent around lane, at most once per k_detour_log_interval
+    void log_detour(Data_ring::Lane lane, Data_ring::Push_result reason, bool sent) noexcept;
+
+    void log_missing_detour_marker() const noexcept;
+
+    void run_poller(Poller& poller) noexcept;
+
+    /// \brief Polls the incoming lanes until they stayed empty for the spin budget
+    void spin(Poller& poller) noexcept;
+
+    template <typename Send_on_socket>
+    static Result<void> send_doorbell(Send_on_socket const& send_on_socket,
+                                      bool detour = false) noexcept {
+        Message_frame<Data_ring_doorbell> doorbell{};
+        doorbell.payload.detour = detour;
+        return send_on_socket(score::cpp::span<std::uint8_t const>(
+            reinterpret_cast<std::uint8_t const*>(&doorbell), sizeof(doorbell)));
+    }
+
+    std::chrono::microseconds m_full_ring_timeout;
+    std::mutex m_mutex;          // Protects the writing side of the data lane
+    std::mutex m_control_mutex;  // Protects the writing side of the control lane
+    std::mutex m_socket_mutex;   // Serializes socket sends of both lanes
+    std::mutex m_rx_mutex;       // Protects the reading side
+    // Replaced only while holding both lane mutexes and m_rx_mutex
+    Data_ring::Uptr m_ring;
+    std::atomic<bool> m_writing{false};
+    bool m_rx_detour_pending{false};  // Protected by m_rx_mutex
+    std::unique_ptr<Poller> m_poller;
+    std::mutex m_log_mutex;  // Protects the detour reports
+    std::optional<Clock::time_point> m_detours_logged_at;
+    std::size_t m_detours_since_log{0U};
+};
+
+}  // namespace score::gateway_ipc_binding
+
+#endif  // SRC_GATEWAY_IPC_BINDING_SRC_DATA_RING
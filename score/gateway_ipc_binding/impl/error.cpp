@@ -36,6 +36,10 @@ class Shared_memory_manager_error_domain final : public score::result::ErrorDoma
                 return "No configuration found for the specified interface";
             case Shared_memory_manager_error::logic_error_no_configuration_for_instance:
                 return "No configuration found for the specified instance";
+            case Shared_memory_manager_error::logic_error_requested_size_too_large:
+                return "Requested size exceeds the slot size of all slot classes";
+            case Shared_memory_manager_error::logic_error_no_consumer_counts:
+                return "Shared memory does not hold consumer counts";
             default:
                 return "Unknown error";
         }
@@ -92,6 +96,10 @@ class Gateway_ipc_binding_error_domain final : public score::result::ErrorDomain
             case Gateway_ipc_binding_error::fixed_size_container_too_small:
                 return "Data to be copied into container is larger than the container's maximum "
                        "size";
+            case Gateway_ipc_binding_error::runtime_error_message_trace_io_failed:
+                return "Reading or writing a message trace failed";
+            case Gateway_ipc_binding_error::runtime_error_invalid_message_trace:
+                return "Data read is no message trace of a supported version";
             default:
                 return "Unknown error";
         }
@@ -0,0 +1,297 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SRC_GATEWAY_IPC_BINDING_SRC_EVENT_CREDITS
+#define SRC_GATEWAY_IPC_BINDING_SRC_EVENT_CREDITS
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "key.hpp"
+#include "score/gateway_ipc_binding/gateway_ipc_binding.hpp"
+#include "score/gateway_ipc_binding/gateway_ipc_binding_server.hpp"
+#include "score/gateway_ipc_binding/shared_memory_slot_manager.hpp"
+
+namespace score::gateway_ipc_binding {
+
+/// \brief Credits of the event subscriptions of peers, see Flow_control
+///
+/// A subscription is identified by the peer, the required_id its Event_update messages carry and
+/// the event. Its credits are the granted window minus the slots in flight, i.e. sent and not yet
+/// consumed. Updates without payload have no slot the peer could acknowledge, they neither take
+/// nor wait for credits.
+///
+/// Has its own mutex, so a producer waiting in wait_for_credit() does not keep Payload_consumed
+/// messages from returning credits. For the same reason, updates held back by
+/// Credit_exhaustion::drop_oldest are handed out by release() instead of being sent under the lock
+/// of the event's fan-out.
+/// Releases of one subscription are serialized by the order of its Payload_consumed messages.
+class Event_credits {
+   public:
+    enum class Decision : std::uint8_t { send, hold_back, drop, wait };
+
+    struct Acquisition {
+        Decision decision;
+        /// \brief Held back update which was dropped for the new one
+        std::optional<Slot_handle> dropped;
+    };
+
+    /// \brief Held back update which has to be released by the caller
+    struct Dropped_update {
+        Key_t key;
+        Slot_handle slot;
+    };
+
+    explicit Event_credits(Flow_control const& flow_control) noexcept
+        : m_on_exhausted(flow_control.on_exhausted), m_block_timeout(flow_control.block_timeout) {}
+
+    /// \brief Tracks a subscription with a window of credits, no credits stop tracking it
+    ///
+    /// A repeated subscription keeps its slots in flight, only the window changes.
+    /// \return Held back updates which do not fit into the window anymore
+    std::vector<Dropped_update> subscribe(Client_id client_id, Remote_handle required_id,
+                                          Event_id event_id, Key_t key, std::uint32_t credits) {
+        std::vector<Dropped_update> dropped;
+        {
+            std::lock_guard<std::mutex> const lock{m_mutex};
+            Subscriber const subscriber{client_id, required_id};
+            auto& subscriptions = m_subscriptions[subscriber];
+            auto it = find(subscriptions, event_id);
+            if (it == subscriptions.end()) {
+                subscriptions.push_back({event_id, key, credits, {}, {}});
+                it = std::prev(subscriptions.end());
+            }
+
+            it->credits = credits;
+            while (it->held_back.size() > credits) {
+                dropped.push_back({it->key, it->held_back.front().slot_index});
+                it->held_back.pop_front();
+            }
+            if (credits == 0U) {
+                subscriptions.erase(it);
+            }
+            if (subscriptions.empty()) {
+                m_subscriptions.erase(subscriber);
+            }
+        }
+        m_credit_returned.notify_all();
+        return dropped;
+    }
+
+    /// \return Updates held back for the subscription
+    std::vector<Dropped_update> unsubscribe(Client_id client_id, Remote_handle required_id,
+                                            Event_id event_id) {
+        return subscribe(client_id, required_id, event_id, Key_t{}, 0U);
+    }
+
+    /// \return Updates held back for all subscriptions to services with key
+    std::vector<Dropped_update> remove_service(Key_t key) {
+        return remove_if([key](Subscriber const&, Subscription const& subscription) {
+            return subscription.key == key;
+        });
+    }
+
+    /// \return Updates held back for all subscriptions of client_id
+    std::vector<Dropped_update> remove_client(Client_id client_id) {
+        return remove_if([client_id](Subscriber const& subscriber, Subscription const&) {
+            return subscriber.client_id == client_id;
+        });
+    }
+
+    /// \brief Takes a credit of the subscription for sending update
+    ///
+    /// Without a credit, Decision::hold_back means update is kept until release() hands it out
+    /// again. With Credit_exhaustion::block, Decision::wait means the caller has to
+    /// wait_for_credit() and acquire again, which returns Decision::drop unless it may wait.
+    Acquisition acquire(Client_id client_id, Event_update const& update, bool may_wait = true) {
+        std::lock_guard<std::mutex> const lock{m_mutex};
+        auto* const subscription = find({client_id, update.required_id}, update.event_id);
+        if (subscription == nullptr || update.payload.slot_index == kNo_payload_slot) {
+            return {Decision::send, std::nullopt};
+        }
+
+        if (has_credit(*subscription)) {
+            subscription->in_flight.push_back(update.payload.slot_index);
+            return {Decision::send, std::nullopt};
+        }
+
+        if (m_on_exhausted == Credit_exhaustion::block && may_wait) {
+            return {Decision::wait, std::nullopt};
+        }
+        if (m_on_exhausted != Credit_exhaustion::drop_oldest) {
+            return {Decision::drop, std::nullopt};
+        }
+
+        subscription->held_back.push_back(update.payload);
+        if (subscription->held_back.size() <= subscription->credits) {
+            return {Decision::hold_back, std::nullopt};
+        }
+        auto const oldest = subscription->held_back.front().slot_index;
+        subscription->held_back.pop_front();
+        return {Decision::hold_back, oldest};
+    }
+
+    /// \brief Deadline of a producer which starts to wait for a credit now
+    std::chrono::steady_clock::time_point wait_deadline() const noexcept {
+        return std::chrono::steady_clock::now() + m_block_timeout;
+    }
+
+    /// \brief Waits until the subscription of update has a credit again or was removed
+    ///
+    /// Must be called without the locks the release of a credit takes.
+    /// \return false if deadline passed before
+    bool wait_for_credit(Client_id client_id, Event_update const& update,
+                         std::chrono::steady_clock::time_point deadline) {
+        std::unique_lock<std::mutex> lock{m_mutex};
+        Subscriber const subscriber{client_id, update.required_id};
+        // The subscription may be removed while waiting, it is looked up again each time
+        return m_credit_returned.wait_until(lock, deadline, [this, &subscriber, &update]() {
+            auto const* const subscription = find(subscriber, update.event_id);
+            return subscription == nullptr || has_credit(*subscription);
+        });
+    }
+
+    /// \brief Returns the credit taken for the consumed slot
+    /// \return The oldest held back update of the subscription, which took the credit again and
+    ///         has to be sent to the peer now
+    std::optional<Event_update> release(Client_id client_id, Remote_handle required_id,
+                                        Slot_handle slot) {
+        std::optional<Event_update> next;
+        {
+            std::lock_guard<std::mutex> const lock{m_mutex};
+            auto const subscriptions = m_subscriptions.find({client_id, required_id});
+            if (subscriptions == m_subscriptions.end()) {
+                return std::nullopt;
+            }
+
+            for (auto& subscription : subscriptions->second) {
+                auto const in_flight = std::find(subscription.in_flight.begin(),
+                                                 subscription.in_flight.end(), slot);
+                if (in_flight == subscription.in_flight.end()) {
+                    continue;
+                }
+
+                subscription.in_flight.erase(in_flight);
+                if (!subscription.held_back.empty()) {
+                    next = Event_update{required_id, subscription.event_id,
+                                        subscription.held_back.front()};
+                    subscription.held_back.pop_front();
+                    subscription.in_flight.push_back(next->payload.slot_index);
+                }
+                break;
+            }
+        }
+        if (!next) {
+            m_credit_returned.notify_all();
+        }
+        return next;
+    }
+
+   private:
+    struct Subscriber {
+        Client_id client_id;
+        Remote_handle required_id;
+
+        bool operator==(Subscriber const& other) const noexcept {
+            return client_id == other.client_id && required_id == other.required_id;
+        }
+    };
+
+    struct Subscriber_hash {
+        std::size_t operator()(Subscriber const& subscriber) const noexcept {
+            return std::hash<Client_id>{}(subscriber.client_id) ^
+                   (std::hash<Remote_handle>{}(subscriber.required_id) << 1U);
+        }
+    };
+
+    struct Subscription {
+        Event_id event_id;
+        Key_t key;
+        std::uint32_t credits;
+        std::vector<Slot_handle> in_flight;
+        std::deque<Shared_memory_handle> held_back;
+    };
+
+    using Subscriptions = std::vector<Subscription>;
+
+    static Subscriptions::iterator find(Subscriptions& subscriptions, Event_id event_id) noexcept {
+        return std::find_if(subscriptions.begin(), subscriptions.end(),
+                            [event_id](auto const& s) { return s.event_id == event_id; });
+    }
+
+    Subscription* find(Subscriber const& subscriber, Event_id event_id) noexcept {
+        auto const subscriptions = m_subscriptions.find(subscriber);
+        if (subscriptions == m_subscriptions.end()) {
+            return nullptr;
+        }
+        auto const it = find(subscriptions->second, event_id);
+        return it == subscriptions->second.end() ? nullptr : &*it;
+    }
+
+    /// \brief Held back updates are sent before any new one, to keep the order of updates
+    static bool has_credit(Subscription const& subscription) noexcept {
+        return subscription.in_flight.size() < subscription.credits &&
+               subscription.held_back.empty();
+    }
+
+    static void take_held_back(Subscription& subscription, std::vector<Dropped_update>& dropped) {
+        for (auto const& handle : subscription.held_back) {
+            dropped.push_back({subscription.key, handle.slot_index});
+        }
+        subscription.held_back.clear();
+    }
+
+    template <typename Predicate>
+    std::vector<Dropped_update> remove_if(Predicate predicate) {
+        std::vector<Dropped_update> dropped;
+        {
+            std::lock_guard<std::mutex> const lock{m_mutex};
+            for (auto it = m_subscriptions.begin(); it != m_subscriptions.end();) {
+                auto& subscriptions = it->second;
+                auto const removed = std::remove_if(
+                    subscriptions.begin(), subscriptions.end(),
+                    [&it, &predicate, &dropped](auto& subscription) {
+                        if (!predicate(it->first, subscription)) {
+                            return false;
+                        }
+                        take_held_back(subscription, dropped);
+                        return true;
+                    });
+                subscriptions.erase(removed, subscriptions.end());
+                it = subscriptions.empty() ? m_subscriptions.erase(it) : std::next(it);
+            }
+        }
+        m_credit_returned.notify_all();
+        return dropped;
+    }
+
+    Credit_exhaustion const m_on_exhausted;
+    std::chrono::microseconds const m_block_timeout;
+    std::mutex m_mutex;
+    std::condition_variable m_credit_returned;
+    std::unordered_map<Subscriber, Subscriptions, Subscriber_hash> m_subscriptions;
+};
+
+}  // namespace score::gateway_ipc_binding
+
+#endif  // SRC_GATEWAY_IPC_BINDING_SRC_EVENT_CREDITS
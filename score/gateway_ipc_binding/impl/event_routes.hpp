@@ -0,0 +1,111 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SRC_GATEWAY_IPC_BINDING_SRC_EVENT_ROUTES
+#define SRC_GATEWAY_IPC_BINDING_SRC_EVENT_ROUTES
+
+#include <algorithm>
+#include <cstddef>
+#include <unordered_map>
+#include <utility>
+
+#include "connection_metadata.hpp"
+#include "gateway_ipc_binding_util.hpp"
+#include "key.hpp"
+#include "score/gateway_ipc_binding/gateway_ipc_binding_server.hpp"
+#include "score/gateway_ipc_binding/shared_memory_slot_manager.hpp"
+#include "service_state.hpp"
+
+namespace score::gateway_ipc_binding {
+
+/// \brief Everything needed to pass a payload of a peer's service to local clients
+struct Event_route {
+    Client_id client_id;
+    Key_t key;
+    Remote_handle required_id;
+    /// \brief Owner of the server connector, nullptr for routes of method call payloads
+    Service_state const* service_state;
+    Shared_memory_metadata remote_metadata;
+    /// \brief Pending Payload_consumed acknowledgements must not hold back more of the peer's
+    ///        slots
+    std::size_t max_pending_consumed;
+    /// \brief Opened with the first payload, nullptr before
+    Read_only_shared_memory_slot_manager* slot_manager{nullptr};
+};
+
+inline Event_route make_event_route(Client_id client_id, Connection_metadata::Ids const& ids,
+                                    Service_state const* service_state) {
+    return Event_route{client_id,
+                       ids.key,
+                       ids.remote_handle,
+                       service_state,
+                       ids.remote_metadata,
+                       std::max<std::size_t>(1U, total_slot_count(ids.remote_metadata) / 2U),
+                       nullptr};
+}
+
+/// \brief Routes of the services of peers, resolved when a peer replies to Connect_service
+///
+/// Required ids are unique per binding, so an inbound Event_update finds its route with a single
+/// lookup instead of resolving mapping, service state and read-only shared memory each time. A
+/// route exists as long as the mapping of its required_id in Connection_metadata.
+class Event_routes {
+   public:
+    void add(Event_route route) { m_routes.insert_or_assign(route.required_id, std::move(route)); }
+
+    Event_route* find(Client_id client_id, Remote_handle required_id) noexcept {
+        auto it = m_routes.find(required_id);
+        if (it == m_routes.end() || it->second.client_id != client_id) {
+            return nullptr;
+        }
+        return &it->second;
+    }
+
+    void remove(Client_id client_id, Remote_handle required_id) noexcept {
+        if (find(client_id, required_id) != nullptr) {
+            m_routes.erase(required_id);
+        }
+    }
+
+    void remove_client(Client_id client_id) noexcept {
+        remove_if([client_id](auto const& route) { return route.client_id == client_id; });
+    }
+
+    void remove_mapping_for_client_and_key(Client_id client_id, Key_t const& key) noexcept {
+        remove_if([client_id, &key](auto const& route) {
+            return route.client_id == client_id && route.key == key;
+        });
+    }
+
+    void remove_service(Key_t const& key) noexcept {
+        remove_if([&key](auto const& route) { return route.key == key; });
+    }
+
+   private:
+    template <typename Value_checker>
+    void remove_if(Value_checker checker) noexcept {
+        for (auto it = m_routes.begin(); it != m_routes.end();) {
+            if (checker(it->second)) {
+                it = m_routes.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    std::unordered_map<Remote_handle, Event_route> m_routes;
+};
+
+}  // namespace score::gateway_ipc_binding
+
+#endif  // SRC_GATEWAY_IPC_BINDING_SRC_EVENT_ROUTES
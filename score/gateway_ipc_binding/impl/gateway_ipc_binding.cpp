@@ -15,6 +15,8 @@
 
 #include <algorithm>
 #include <cassert>
+#include <iterator>
+#include <map>
 #include <string>
 #include <string_view>
 
@@ -79,6 +81,15 @@ Result<Shared_memory_path> make_path(std::string_view prefix, std::string_view s
     return fixed_string_from_string<Shared_memory_path>(path);
 }
 
+/// \brief Rounds a slot size up to the power of two size class it is allocated from
+std::size_t slot_class_size(std::size_t size) noexcept {
+    std::size_t class_size = kMin_slot_class_size;
+    while (class_size < size) {
+        class_size *= 2U;
+    }
+    return class_size;
+}
+
 }  // namespace
 
 Result<Shared_memory_path> make_shared_memory_path(std::string_view service_type_name,
@@ -95,11 +106,70 @@ bool operator==(Shared_memory_handle const& lhs, Shared_memory_handle const& rhs
     return lhs.slot_index == rhs.slot_index && lhs.used_bytes == rhs.used_bytes;
 }
 
+bool operator==(Slot_class const& lhs, Slot_class const& rhs) noexcept {
+    return lhs.slot_size == rhs.slot_size && lhs.slot_count == rhs.slot_count;
+}
+
 bool operator==(Shared_memory_metadata const& lhs, Shared_memory_metadata const& rhs) noexcept {
     return lhs.slot_count == rhs.slot_count && lhs.slot_size == rhs.slot_size &&
            lhs.path.size == rhs.path.size &&
            std::equal(lhs.path.data.data(), lhs.path.data.data() + lhs.path.size,
-                      rhs.path.data.data(), rhs.path.data.data() + rhs.path.size);
+                      rhs.path.data.data(), rhs.path.data.data() + rhs.path.size) &&
+           lhs.slot_classes == rhs.slot_classes && lhs.event_slot_sizes == rhs.event_slot_sizes &&
+           lhs.consumer_release == rhs.consumer_release &&
+           lhs.conflated_events == rhs.conflated_events;
+}
+
+Shared_memory_metadata make_event_slot_layout(Shared_memory_path const& path,
+                                              std::vector<std::size_t> const& event_slot_sizes,
+                                              std::size_t sample_count) {
+    Shared_memory_metadata metadata{};
+    metadata.path = path;
+    metadata.slot_count = sample_count;
+    if (event_slot_sizes.empty()) {
+        return metadata;
+    }
+    auto const largest = *std::max_element(event_slot_sizes.begin(), event_slot_sizes.end());
+    metadata.slot_size = largest;
+    if (event_slot_sizes.size() > Event_slot_sizes::max_size) {
+        return metadata;
+    }
+
+    // class size -> number of events allocating from it
+    std::map<std::size_t, std::size_t> class_events;
+    for (auto const size : event_slot_sizes) {
+        auto const class_size = slot_class_size(size);
+        if (class_size < largest) {
+            ++class_events[class_size];
+        }
+    }
+    auto const max_classes =
+        std::min(kMax_slot_classes, sample_count > 0U ? sample_count - 1U : 0U);
+    while (class_events.size() > max_classes) {
+        auto const smallest = class_events.begin();
+        // The events of the largest class end up in the default class
+        auto const next = std::next(smallest);
+        if (next != class_events.end()) {
+            next->second += smallest->second;
+        }
+        class_events.erase(smallest);
+    }
+
+    // Each class including the default one gets a slot, the remaining ones are split by events
+    auto const shared_slots = sample_count - std::min(sample_count, class_events.size() + 1U);
+    std::size_t class_slots = 0U;
+    for (auto const& [class_size, event_count] : class_events) {
+        auto const slot_count = 1U + (shared_slots * event_count / event_slot_sizes.size());
+        metadata.slot_classes.data[metadata.slot_classes.size++] = {class_size, slot_count};
+        class_slots += slot_count;
+    }
+    metadata.slot_count = sample_count - class_slots;
+
+    for (auto const size : event_slot_sizes) {
+        metadata.event_slot_sizes.data[metadata.event_slot_sizes.size++] =
+            static_cast<std::uint32_t>(size);
+    }
+    return metadata;
 }
 
 bool operator==(Service_instance const& lhs, Service_instance const& rhs) noexcept {
@@ -13,15 +13,25 @@
 
 #include "score/gateway_ipc_binding/gateway_ipc_binding_client.hpp"
 
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <array>
 #include <atomic>
 #include <cassert>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <string_view>
-#include <thread>
 #include <utility>
 
 #include "binding_base.hpp"
+#include "compact_frame.hpp"
+#include "data_ring.hpp"
 #include "reply_channel.hpp"
 #include "score/gateway_ipc_binding/error.hpp"
 #include "score/gateway_ipc_binding/gateway_ipc_binding.hpp"
@@ -31,6 +41,22 @@ namespace score::gateway_ipc_binding {
 
 namespace {
 
+/// \brief Creates a pipe with both ends non-blocking and closed on exec
+/// \return Read and write end, both -1 on failure
+std::array<int, 2> create_state_pipe() noexcept {
+    std::array<int, 2> fds{-1, -1};
+    if (::pipe(fds.data()) != 0) {
+        std::cerr << __PRETTY_FUNCTION__ << ": Failed to create pipe: " << std::strerror(errno)
+                  << std::endl;
+        return {-1, -1};
+    }
+    for (auto const fd : fds) {
+        ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) | O_NONBLOCK);
+        ::fcntl(fd, F_SETFD, FD_CLOEXEC);
+    }
+    return fds;
+}
+
 /// \brief Implementation of Gateway_ipc_binding_client
 class Gateway_ipc_binding_client_impl : public Gateway_ipc_binding_client, public Reply_channel {
    public:
@@ -40,17 +66,36 @@ class Gateway_ipc_binding_client_impl : public Gateway_ipc_binding_client, publi
     /// \param slot_manager Unique pointer to shared memory slot manager
     /// \param find_service_elements Service elements to advertise
     /// \param server_shared_memory_configs Shared memory configuration to send to the server
+    /// \param batching Batching of messages sent to the server
+    /// \param data_ring Shared memory rings offered to the server for all further messages
+    /// \param dispatch Handling of messages received from the server
+    /// \param flow_control Credits granted for subscribed events and handling of exhausted credits
+    /// \param latency_tracing Recording of event update latencies
+    /// \param message_tracing Recording of the messages received from and sent to the server
+    /// \param busy_poll Reading of the data ring by a dedicated thread
     Gateway_ipc_binding_client_impl(
         score::socom::Runtime& runtime,
         score::cpp::pmr::unique_ptr<score::message_passing::IClientConnection> channel,
         Shared_memory_manager_factory::Sptr slot_manager,
         Find_service_elements find_service_elements, Client_identifier identifier,
-        Shared_memory_configs server_shared_memory_configs)
-        : m_binding_base{runtime, std::move(slot_manager)},
+        Shared_memory_configs server_shared_memory_configs, Message_batching batching,
+        Data_ring_config data_ring, Message_dispatch dispatch, Flow_control flow_control,
+        Latency_tracing latency_tracing, Message_tracing message_tracing, Busy_poll busy_poll)
+        : m_binding_base{runtime,      std::move(slot_manager), batching,       dispatch,
+                         flow_control, latency_tracing,         message_tracing},
           m_channel(std::move(channel)),
           m_find_service_elements(std::move(find_service_elements)),
           m_identifier(std::move(identifier)),
-          m_server_shared_memory_configs(std::move(server_shared_memory_configs)) {
+          m_server_shared_memory_configs(std::move(server_shared_memory_configs)),
+          m_data_ring_config(std::move(data_ring)),
+          m_data_ring(m_data_ring_config.full_ring_timeout),
+          m_state_pipe(create_state_pipe()) {
+        set_message_trace(m_binding_base.get_message_trace_recorder(), client_id);
+        if (!m_data_ring_config.path.empty()) {
+            m_data_ring.start_polling(busy_poll, [this](auto const message, auto const lane) {
+                on_data_ring_message(message, lane);
+            });
+        }
         m_channel->Start([this](auto const state) { on_state_change(state); },
                          [this](auto const data) { on_receive_message(data); });
     }
@@ -61,13 +106,27 @@ class Gateway_ipc_binding_client_impl : public Gateway_ipc_binding_client, publi
         // Stop() uses a CAS that only succeeds when stop_reason_ is kNone. During an active
         // reconnect cycle (disconnect → auto-restart), stop_reason_ is transiently non-kNone,
         // causing Stop() to be a no-op. Retry until the channel reaches the stopped state.
-        while (!m_stopped) {
+        std::unique_lock<std::mutex> lock{m_state_mutex};
+        while (m_state != Client_state::stopped) {
+            lock.unlock();
             m_channel->Stop();
-            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            lock.lock();
+            m_state_cv.wait_for(lock, std::chrono::milliseconds(10),
+                                [this]() { return m_state == Client_state::stopped; });
+        }
+        lock.unlock();
+        m_data_ring.stop_polling();
+        // Pending batches must not be flushed to m_channel, which is destroyed before
+        // m_binding_base
+        m_binding_base.remove_client(client_id);
+        for (auto const fd : m_state_pipe) {
+            if (fd >= 0) {
+                ::close(fd);
+            }
         }
     }
 
-    Result<void> send(score::cpp::span<std::uint8_t const> data) noexcept override {
+    Result<void> send_on_socket(score::cpp::span<std::uint8_t const> data) noexcept {
         if (m_channel == nullptr) {
             return MakeUnexpected(Bidirectional_channel_error::runtime_error_send_failed,
                                   "Channel is not available");
@@ -82,19 +141,32 @@ class Gateway_ipc_binding_client_impl : public Gateway_ipc_binding_client, publi
         return {};
     }
 
-    using Reply_channel::send;  // Bring template send() into scope
+    bool is_connected() const noexcept override { return m_state == Client_state::connected; }
+
+    Client_state get_state() const noexcept override { return m_state; }
+
+    bool wait_for_state(Client_state state,
+                        std::chrono::milliseconds timeout) const noexcept override {
+        std::unique_lock<std::mutex> lock{m_state_mutex};
+        return m_state_cv.wait_for(lock, timeout, [this, state]() { return m_state == state; });
+    }
+
+    int get_state_fd() const noexcept override { return m_state_pipe[0]; }
 
-    bool is_connected() const noexcept override { return m_connected; }
+    void flush_event_updates() noexcept override { m_binding_base.flush_event_updates(); }
+
+    Latency_histogram_summaries get_latency_histograms() noexcept override {
+        return m_binding_base.get_latency_histograms();
+    }
+
+    Message_trace_records get_message_trace() const noexcept override {
+        return m_binding_base.get_message_trace();
+    }
 
     void on_state_change(score::message_passing::IClientConnection::State const state) {
         switch (state) {
             case score::message_passing::IClientConnection::State::kReady: {
-                Message_frame<Connect> connect_msg;
-                connect_msg.payload.find_service_elements = m_find_service_elements;
-                connect_msg.payload.shared_memory_configs = m_server_shared_memory_configs;
-                connect_msg.payload.identifier = m_identifier;
-                (void)send(connect_msg);
-
+                send_connect();
                 break;
             }
             case score::message_passing::IClientConnection::State::kStopped: {
@@ -107,7 +179,7 @@ class Gateway_ipc_binding_client_impl : public Gateway_ipc_binding_client, publi
                         kShutdown:  // fall through
                         // Do not attempt to restart the channel in these cases as they indicate an
                         // intentional stop from either the client or server side.
-                        m_stopped = true;
+                        set_state(Client_state::stopped);
                         break;
                     default:
                         // For other stop reasons, attempt to restart the channel to allow recovery
@@ -120,10 +192,11 @@ class Gateway_ipc_binding_client_impl : public Gateway_ipc_binding_client, publi
             case score::message_passing::IClientConnection::State::kStarting:
             case score::message_passing::IClientConnection::State::kStopping:
             default:
-                m_connected = false;
+                set_state(Client_state::connecting);
                 // Remove client to prevent send() being called by m_binding_base and racing
                 // with the engine thread closing the underlying file descriptor.
                 m_binding_base.remove_client(client_id);
+                m_data_ring.detach();
                 break;
         }
     }
@@ -135,6 +208,19 @@ class Gateway_ipc_binding_client_impl : public Gateway_ipc_binding_client, publi
 
         auto message_type = get_message_type(data[0]);
 
+        auto const on_ring_message = [this](auto const message, auto const lane) {
+            on_data_ring_message(message, lane);
+        };
+        if (Message_type::Data_ring_doorbell == message_type) {
+            if (auto const doorbell = check_and_cast<Data_ring_doorbell>(data)) {
+                m_data_ring.drain(**doorbell, on_ring_message);
+            }
+            return;
+        }
+        if (m_data_ring.receive_detour(data, on_ring_message)) {
+            return;
+        }
+
         if (Message_type::Connect_reply == message_type) {
             auto msg_opt = check_and_cast<Connect_reply>(data);
             if (!msg_opt) {
@@ -147,18 +233,115 @@ class Gateway_ipc_binding_client_impl : public Gateway_ipc_binding_client, publi
         m_binding_base.on_receive_message(client_id, *this, data);
     }
 
+    void on_data_ring_message(score::cpp::span<std::uint8_t const> message,
+                              Data_ring::Lane lane) noexcept {
+        if (lane == Data_ring::Lane::control) {
+            m_binding_base.on_receive_control_message(client_id, *this, message);
+        } else {
+            m_binding_base.on_receive_message(client_id, *this, message);
+        }
+    }
+
+    /// \brief Sends Connect, followed by Connect_continuation messages if the find service
+    ///        elements or shared memory configs do not fit into one
+    void send_connect() noexcept {
+        auto const page_count = connect_page_count(m_find_service_elements.size(),
+                                                   m_server_shared_memory_configs.size());
+
+        Connect connect_msg{};
+        fill_connect_page(connect_msg.find_service_elements, m_find_service_elements, 0U);
+        fill_connect_page(connect_msg.shared_memory_configs, m_server_shared_memory_configs, 0U);
+        connect_msg.identifier = m_identifier;
+        connect_msg.complete = page_count == 1U;
+        offer_data_ring(connect_msg);
+        if (!send(encode_compact_frame(connect_msg))) {
+            return;
+        }
+
+        for (std::size_t page = 1U; page < page_count; ++page) {
+            Connect_continuation continuation{};
+            fill_connect_page(continuation.find_service_elements, m_find_service_elements, page);
+            fill_connect_page(continuation.shared_memory_configs, m_server_shared_memory_configs,
+                              page);
+            continuation.complete = page + 1U == page_count;
+            if (!send(encode_compact_frame(continuation))) {
+                return;
+            }
+        }
+
+        // Follows Connect, so the server applies it after the handshake. Its reply to the
+        // snapshot carries the offers of the requested services.
+        m_binding_base.add_client_with_service_snapshot(client_id, *this);
+    }
+
+    /// \brief Creates a fresh data ring for this connection attempt and offers it in msg
+    void offer_data_ring(Connect& msg) noexcept {
+        // The ring of a previous connection must be gone before its path is reused
+        m_data_ring.detach();
+        msg.data_ring_path = Shared_memory_path{};
+        msg.data_ring_capacity = 0U;
+        if (m_data_ring_config.path.empty()) {
+            return;
+        }
+
+        auto const path = fixed_string_from_string<Shared_memory_path>(m_data_ring_config.path);
+        if (!path) {
+            std::cerr << __PRETTY_FUNCTION__ << ": Data ring path is too long: "
+                      << m_data_ring_config.path << std::endl;
+            return;
+        }
+
+        auto ring = Data_ring::create(m_data_ring_config.path, m_data_ring_config.capacity);
+        if (!ring) {
+            std::cerr << __PRETTY_FUNCTION__ << ": Failed to create data ring "
+                      << m_data_ring_config.path << ": " << ring.error() << std::endl;
+            return;
+        }
+
+        msg.data_ring_path = *path;
+        msg.data_ring_capacity = static_cast<std::uint32_t>(m_data_ring_config.capacity);
+        m_data_ring.attach(std::move(*ring));
+    }
+
     void handle_connect_reply_message(Connect_reply const& msg) {
         assert(msg.status);
-        m_connected = msg.status;
+        set_state(Client_state::connected);
+
+        if (msg.data_ring) {
+            m_data_ring.activate();
+        } else {
+            m_data_ring.detach();
+        }
+    }
 
-        if (m_connected) {
-            m_binding_base.add_client(client_id, *this);
+   private:
+    /// \brief Publishes a state change to wait_for_state() and get_state_fd()
+    void set_state(Client_state state) noexcept {
+        // Notified under the lock, so the destructor cannot destroy m_state_cv in between
+        std::lock_guard<std::mutex> const lock{m_state_mutex};
+        if (m_state == state || m_state == Client_state::stopped) {
+            return;
         }
+        m_state = state;
+        m_state_cv.notify_all();
+        if (m_state_pipe[1] >= 0) {
+            // A full pipe is readable already, so a failed write loses no wake-up
+            std::uint8_t const wake_up{1U};
+            static_cast<void>(::write(m_state_pipe[1], &wake_up, sizeof(wake_up)));
+        }
+    }
+
+   protected:
+    Result<void> send_frame(score::cpp::span<std::uint8_t const> data) noexcept override {
+        return m_data_ring.send(data, [this](auto const socket_data) {
+            return send_on_socket(socket_data);
+        });
     }
 
    private:
-    std::atomic<bool> m_connected{false};
-    std::atomic<bool> m_stopped{false};
+    std::atomic<Client_state> m_state{Client_state::connecting};
+    mutable std::mutex m_state_mutex;
+    mutable std::condition_variable m_state_cv;
     // There is only ever one connection: from this instance to the server
     constexpr static Client_id client_id{0};
     Gateway_ipc_binding_base m_binding_base;
@@ -166,6 +349,10 @@ class Gateway_ipc_binding_client_impl : public Gateway_ipc_binding_client, publi
     Find_service_elements m_find_service_elements;
     Client_identifier m_identifier;
     Shared_memory_configs m_server_shared_memory_configs;
+    Data_ring_config m_data_ring_config;
+    Data_ring_endpoint m_data_ring;
+    // Read and write end
+    std::array<int, 2> m_state_pipe;
 };
 
 }  // namespace
@@ -174,7 +361,10 @@ std::unique_ptr<Gateway_ipc_binding_client> Gateway_ipc_binding_client::create(
     score::socom::Runtime& runtime,
     score::cpp::pmr::unique_ptr<score::message_passing::IClientConnection> connection,
     Shared_memory_manager_factory::Uptr slot_manager, Find_service_elements find_service_elements,
-    Shared_memory_configs server_shared_memory_configs, std::string_view identifier) noexcept {
+    Shared_memory_configs server_shared_memory_configs, std::string_view identifier,
+    Message_batching batching, Data_ring_config data_ring, Message_dispatch dispatch,
+    Flow_control flow_control, Latency_tracing latency_tracing, Message_tracing message_tracing,
+    Busy_poll busy_poll) noexcept {
     assert(connection && "Connection must not be null");
 
     auto identifier_opt = fixed_string_from_string<Client_identifier>(identifier);
@@ -182,7 +372,8 @@ std::unique_ptr<Gateway_ipc_binding_client> Gateway_ipc_binding_client::create(
 
     return std::make_unique<Gateway_ipc_binding_client_impl>(
         runtime, std::move(connection), std::move(slot_manager), std::move(find_service_elements),
-        *identifier_opt, std::move(server_shared_memory_configs));
+        *identifier_opt, std::move(server_shared_memory_configs), batching, std::move(data_ring),
+        dispatch, flow_control, latency_tracing, message_tracing, busy_poll);
 }
 
 }  // namespace score::gateway_ipc_binding
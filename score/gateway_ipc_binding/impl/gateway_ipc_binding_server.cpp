@@ -20,6 +20,8 @@
 #include <utility>
 
 #include "binding_base.hpp"
+#include "compact_frame.hpp"
+#include "data_ring.hpp"
 #include "reply_channel.hpp"
 #include "score/gateway_ipc_binding/error.hpp"
 #include "score/message_passing/i_server_connection.h"
@@ -31,12 +33,56 @@ namespace {
 
 class Server_reply_channel : public Reply_channel {
     score::message_passing::IServerConnection* m_conn;
+    Data_ring_endpoint m_data_ring{Data_ring_config{}.full_ring_timeout};
 
    public:
     explicit Server_reply_channel(score::message_passing::IServerConnection& conn)
         : m_conn{&conn} {}
 
-    Result<void> send(score::cpp::span<std::uint8_t const> data) noexcept override {
+    bool has_data_ring() const noexcept override { return m_data_ring.get_ring() != nullptr; }
+
+    void activate_data_ring() noexcept override { m_data_ring.activate(); }
+
+    /// \brief Opens the data ring offered by the client, if any
+    void open_data_ring(Shared_memory_path const& data_ring_path,
+                        std::uint32_t data_ring_capacity) noexcept {
+        if (data_ring_path.empty()) {
+            return;
+        }
+
+        auto const path = fixed_string_to_string(data_ring_path);
+        auto ring = Data_ring::open(path, data_ring_capacity);
+        if (!ring) {
+            std::cerr << __PRETTY_FUNCTION__ << ": Failed to open data ring " << path << ": "
+                      << ring.error() << std::endl;
+            return;
+        }
+        m_data_ring.attach(std::move(*ring));
+    }
+
+    /// \brief Passes all messages the client wrote to the data ring to on_message with their lane
+    template <typename On_message>
+    void drain_data_ring(Data_ring_doorbell const& doorbell, On_message&& on_message) {
+        m_data_ring.drain(doorbell, std::forward<On_message>(on_message));
+    }
+
+    /// \brief Passes a message the client sent around its lane of the data ring to on_message
+    ///        in order, see Data_ring_endpoint::receive_detour()
+    template <typename On_message>
+    bool receive_data_ring_detour(score::cpp::span<std::uint8_t const> data,
+                                  On_message&& on_message) {
+        return m_data_ring.receive_detour(data, std::forward<On_message>(on_message));
+    }
+
+    /// \brief Reads the data ring from a dedicated thread, see Busy_poll
+    void start_data_ring_polling(Busy_poll const& busy_poll,
+                                 Data_ring_endpoint::On_message on_message) {
+        m_data_ring.start_polling(busy_poll, std::move(on_message));
+    }
+
+    void stop_data_ring_polling() noexcept { m_data_ring.stop_polling(); }
+
+    Result<void> send_on_socket(score::cpp::span<std::uint8_t const> data) noexcept {
         auto const send_result = m_conn->Notify(data);
         if (!send_result) {
             std::cerr << __PRETTY_FUNCTION__
@@ -45,6 +91,13 @@ class Server_reply_channel : public Reply_channel {
         }
         return {};
     }
+
+   protected:
+    Result<void> send_frame(score::cpp::span<std::uint8_t const> data) noexcept override {
+        return m_data_ring.send(data, [this](auto const socket_data) {
+            return send_on_socket(socket_data);
+        });
+    }
 };
 
 /// \brief Implementation of Gateway_ipc_binding_server
@@ -54,13 +107,23 @@ class Gateway_ipc_binding_server_impl : public Gateway_ipc_binding_server {
     /// \param runtime SOCom runtime for service bridge registration
     /// \param slot_manager Factory for creating shared memory slot manager
     /// \param server Unique pointer to message_passing server
+    /// \param batching Batching of messages sent to the clients
+    /// \param dispatch Handling of messages received from the clients
+    /// \param flow_control Credits granted for subscribed events and handling of exhausted credits
+    /// \param latency_tracing Recording of event update latencies
+    /// \param message_tracing Recording of the messages received from and sent to the clients
+    /// \param busy_poll Reading of the data rings by dedicated threads
     explicit Gateway_ipc_binding_server_impl(
         score::socom::Runtime& runtime, Shared_memory_manager_factory::Sptr slot_manager,
         Gateway_ipc_binding_server::On_find_service_change on_find_service_change,
-        score::cpp::pmr::unique_ptr<score::message_passing::IServer> server)
+        score::cpp::pmr::unique_ptr<score::message_passing::IServer> server,
+        Message_batching batching, Message_dispatch dispatch, Flow_control flow_control,
+        Latency_tracing latency_tracing, Message_tracing message_tracing, Busy_poll busy_poll)
         : m_server(std::move(server)),
           m_on_find_service_change(std::move(on_find_service_change)),
-          m_binding_base{runtime, std::move(slot_manager)} {}
+          m_busy_poll(busy_poll),
+          m_binding_base{runtime,      std::move(slot_manager), batching,       dispatch,
+                         flow_control, latency_tracing,         message_tracing} {}
 
     ~Gateway_ipc_binding_server_impl() {
         // Stop the server before destroying member variables to ensure background threads
@@ -73,6 +136,11 @@ class Gateway_ipc_binding_server_impl : public Gateway_ipc_binding_server {
         if (m_server && listening) {
             m_server->StopListening();
         }
+        // No callbacks are running anymore. Polling threads pass messages to m_binding_base,
+        // which is destroyed before m_connections.
+        for (auto& [client_id, channel] : m_connections) {
+            channel.stop_data_ring_polling();
+        }
     }
 
     /// \brief Start listening for incoming connections
@@ -83,6 +151,8 @@ class Gateway_ipc_binding_server_impl : public Gateway_ipc_binding_server {
             std::lock_guard<std::mutex> const lock(m_mutex);
             Client_id const client_id = m_next_client_id.get_next_id();
             auto const inserted = m_connections.emplace(client_id, connection);
+            inserted.first->second.set_message_trace(m_binding_base.get_message_trace_recorder(),
+                                                     client_id);
             m_binding_base.add_client(client_id, inserted.first->second);
             return static_cast<std::uintptr_t>(client_id);
         };
@@ -92,10 +162,14 @@ class Gateway_ipc_binding_server_impl : public Gateway_ipc_binding_server {
                 assert(std::holds_alternative<std::uintptr_t>(connection.GetUserData()));
                 auto const user_data = std::get<std::uintptr_t>(connection.GetUserData());
                 Client_id const client_id = static_cast<Client_id>(user_data);
+                if (auto* const channel = find_connection(client_id)) {
+                    channel->stop_data_ring_polling();
+                }
                 m_binding_base.remove_client(client_id);
                 std::lock_guard<std::mutex> const lock(m_mutex);
                 m_connections.erase(client_id);
                 m_client_identifiers.erase(client_id);
+                m_connect_handshakes.erase(client_id);
 
                 auto const find_it = m_find_service_elements_by_client.find(client_id);
                 if (find_it != m_find_service_elements_by_client.end()) {
@@ -113,30 +187,42 @@ class Gateway_ipc_binding_server_impl : public Gateway_ipc_binding_server {
             Client_id const client_id = static_cast<Client_id>(user_data);
 
             auto message_type = get_message_type(payload[0]);
+            auto* const channel = find_connection(client_id);
 
-            if (Message_type::Connect == message_type) {
-                auto msg_opt = check_and_cast<Connect>(payload);
-                if (!msg_opt) {
-                    // Invalid message - log and ignore
-                    return {};
+            auto const on_ring_message = [this, client_id, channel](auto const message,
+                                                                    auto const lane) {
+                on_data_ring_message(client_id, *channel, message, lane);
+            };
+            if (Message_type::Data_ring_doorbell == message_type) {
+                auto const doorbell = check_and_cast<Data_ring_doorbell>(payload);
+                if (channel != nullptr && doorbell) {
+                    channel->drain_data_ring(**doorbell, on_ring_message);
                 }
+                return {};
+            }
+            if (channel != nullptr &&
+                channel->receive_data_ring_detour(payload, on_ring_message)) {
+                return {};
+            }
 
-                auto const& msg = **msg_opt;
-                std::lock_guard<std::mutex> const lock(m_mutex);
-
-                m_client_identifiers[client_id] =
-                    Client_info{msg.identifier, connection.GetClientIdentity()};
-
-                m_binding_base.register_shared_memory_configurations(msg.shared_memory_configs);
-
-                if (!msg.find_service_elements.empty()) {
-                    m_on_find_service_change(client_id, msg.find_service_elements, true);
-                    m_find_service_elements_by_client[client_id] = msg.find_service_elements;
+            if (Message_type::Connect == message_type ||
+                Message_type::Connect_continuation == message_type) {
+                if (!collect_connect(client_id, connection, channel, payload)) {
+                    // Invalid or not yet complete handshake
+                    return {};
                 }
             }
 
-            Server_reply_channel reply_channel{connection};
-            m_binding_base.on_receive_message(client_id, reply_channel, payload);
+            if (channel == nullptr) {
+                Server_reply_channel reply_channel{connection};
+                reply_channel.set_message_trace(m_binding_base.get_message_trace_recorder(),
+                                                 client_id);
+                m_binding_base.on_receive_message(client_id, reply_channel, payload);
+                return {};
+            }
+
+            // The persistent channel, so the Connect_reply switches it to the data ring
+            m_binding_base.on_receive_message(client_id, *channel, payload);
             return {};
         };
 
@@ -165,15 +251,118 @@ class Gateway_ipc_binding_server_impl : public Gateway_ipc_binding_server {
         return m_client_identifiers;
     }
 
+    void flush_event_updates() noexcept override { m_binding_base.flush_event_updates(); }
+
+    Latency_histogram_summaries get_latency_histograms() noexcept override {
+        return m_binding_base.get_latency_histograms();
+    }
+
+    Message_trace_records get_message_trace() const noexcept override {
+        return m_binding_base.get_message_trace();
+    }
+
    private:
+    /// \brief Connect of a client, for which Connect_continuation messages are outstanding
+    struct Connect_handshake {
+        Client_identifier identifier;
+        Shared_memory_path data_ring_path;
+        std::uint32_t data_ring_capacity;
+        Find_service_elements find_service_elements;
+        Shared_memory_configs shared_memory_configs;
+    };
+
+    /// \brief Collects Connect and Connect_continuation messages, applies the handshake once
+    ///        complete
+    /// \return true if the handshake is complete and the message has to be passed on to the
+    ///         binding, which replies to it
+    bool collect_connect(Client_id client_id, score::message_passing::IServerConnection& connection,
+                         Server_reply_channel* channel,
+                         score::cpp::span<std::uint8_t const> payload) {
+        std::lock_guard<std::mutex> const lock(m_mutex);
+        bool complete = false;
+        Connect_handshake* handshake = nullptr;
+        if (get_message_type(payload[0]) == Message_type::Connect) {
+            auto const msg_opt = decode_compact_frame<Connect>(payload);
+            if (!msg_opt) {
+                return false;
+            }
+
+            // A new Connect restarts the handshake, e.g. after a reconnect
+            handshake = &m_connect_handshakes[client_id];
+            *handshake = Connect_handshake{msg_opt->identifier, msg_opt->data_ring_path,
+                                           msg_opt->data_ring_capacity, {}, {}};
+            append_connect_page(handshake->find_service_elements, msg_opt->find_service_elements);
+            append_connect_page(handshake->shared_memory_configs, msg_opt->shared_memory_configs);
+            complete = msg_opt->complete;
+        } else {
+            auto const msg_opt = decode_compact_frame<Connect_continuation>(payload);
+            auto const it = m_connect_handshakes.find(client_id);
+            if (!msg_opt || it == m_connect_handshakes.end()) {
+                return false;
+            }
+
+            handshake = &it->second;
+            append_connect_page(handshake->find_service_elements, msg_opt->find_service_elements);
+            append_connect_page(handshake->shared_memory_configs, msg_opt->shared_memory_configs);
+            complete = msg_opt->complete;
+        }
+
+        if (!complete) {
+            return false;
+        }
+
+        m_client_identifiers[client_id] =
+            Client_info{handshake->identifier, connection.GetClientIdentity()};
+
+        // All configurations of the client at once
+        m_binding_base.register_shared_memory_configurations(handshake->shared_memory_configs);
+
+        if (!handshake->find_service_elements.empty()) {
+            m_on_find_service_change(client_id, handshake->find_service_elements, true);
+            m_find_service_elements_by_client[client_id] =
+                std::move(handshake->find_service_elements);
+        }
+
+        if (channel != nullptr) {
+            channel->open_data_ring(handshake->data_ring_path, handshake->data_ring_capacity);
+            if (channel->has_data_ring()) {
+                channel->start_data_ring_polling(
+                    m_busy_poll, [this, client_id, channel](auto const message, auto const lane) {
+                        on_data_ring_message(client_id, *channel, message, lane);
+                    });
+            }
+        }
+
+        m_connect_handshakes.erase(client_id);
+        return true;
+    }
+
+    void on_data_ring_message(Client_id client_id, Server_reply_channel& channel,
+                              score::cpp::span<std::uint8_t const> message,
+                              Data_ring::Lane lane) noexcept {
+        if (lane == Data_ring::Lane::control) {
+            m_binding_base.on_receive_control_message(client_id, channel, message);
+        } else {
+            m_binding_base.on_receive_message(client_id, channel, message);
+        }
+    }
+
+    Server_reply_channel* find_connection(Client_id client_id) {
+        std::lock_guard<std::mutex> const lock(m_mutex);
+        auto const it = m_connections.find(client_id);
+        return it != m_connections.end() ? &it->second : nullptr;
+    }
+
     Id_generator<Client_id> m_next_client_id{0};
     bool m_listening{false};
     score::cpp::pmr::unique_ptr<score::message_passing::IServer> m_server;
     std::unordered_map<Client_id, Server_reply_channel> m_connections;
     mutable std::mutex m_mutex;  // Protects m_listening, m_next_client_id, m_connections
     std::unordered_map<Client_id, Find_service_elements> m_find_service_elements_by_client;
+    std::unordered_map<Client_id, Connect_handshake> m_connect_handshakes;
     std::unordered_map<Client_id, Client_info> m_client_identifiers;
     Gateway_ipc_binding_server::On_find_service_change m_on_find_service_change;
+    Busy_poll m_busy_poll;
     Gateway_ipc_binding_base m_binding_base;
 };
 
@@ -183,11 +372,14 @@ std::unique_ptr<Gateway_ipc_binding_server> Gateway_ipc_binding_server::create(
     score::socom::Runtime& runtime,
     score::cpp::pmr::unique_ptr<score::message_passing::IServer> server,
     Shared_memory_manager_factory::Uptr slot_manager,
-    On_find_service_change on_find_service_change) noexcept {
+    On_find_service_change on_find_service_change, Message_batching batching,
+    Message_dispatch dispatch, Flow_control flow_control, Latency_tracing latency_tracing,
+    Message_tracing message_tracing, Busy_poll busy_poll) noexcept {
     assert(server && "Server must not be null");
 
     return std::make_unique<Gateway_ipc_binding_server_impl>(
-        runtime, std::move(slot_manager), std::move(on_find_service_change), std::move(server));
+        runtime, std::move(slot_manager), std::move(on_find_service_change), std::move(server),
+        batching, dispatch, flow_control, latency_tracing, message_tracing, busy_poll);
 }
 
 }  // namespace score::gateway_ipc_binding
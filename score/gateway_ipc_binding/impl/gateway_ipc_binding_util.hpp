@@ -14,6 +14,8 @@
 #ifndef SRC_GATEWAY_IPC_BINDING_SRC_GATEWAY_IPC_BINDING_UTIL
 #define SRC_GATEWAY_IPC_BINDING_SRC_GATEWAY_IPC_BINDING_UTIL
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <optional>
 
@@ -40,6 +42,29 @@ inline Message_type get_message_type(std::uint8_t data) noexcept {
     return static_cast<Message_type>(data);
 }
 
+/// \brief Messages of a single service connection, which may be handled in parallel to those of
+///        other connections, in contrast to the messages changing connections and services
+///
+/// Data messages are carried by the data lane of a Data_ring and dispatched to the workers of a
+/// Message_dispatcher, all other messages by the control lane and handled by the receiving thread.
+inline bool is_data_message(Message_type type) noexcept {
+    switch (type) {
+        case Message_type::Event_update:
+        case Message_type::Event_update_batch:
+        case Message_type::Traced_event_update:
+        case Message_type::Traced_event_update_batch:
+        case Message_type::Payload_consumed:
+        case Message_type::Payload_consumed_batch:
+        case Message_type::Call_method:
+        case Message_type::Call_method_reply:
+        case Message_type::Cancel_method_call:
+        case Message_type::Subscribe_event:
+            return true;
+        default:
+            return false;
+    }
+}
+
 /// \brief Check if the incoming message matches the expected type and can be safely cast to
 /// Msg_type
 /// \tparam Msg_type Expected message type to check and cast to
@@ -78,6 +103,85 @@ std::optional<Msg_type const*> check_and_cast(score::cpp::span<std::uint8_t cons
     return &connect->payload;
 }
 
+/// \brief Number of bytes of a batch frame (e.g. Event_update_batch) carrying entry_count entries
+template <typename Batch>
+constexpr std::size_t batch_frame_size(std::size_t entry_count) noexcept {
+    using Entries = decltype(Batch::entries);
+    using Entry = typename decltype(Entries::data)::value_type;
+    return offsetof(Message_frame<Batch>, payload) + offsetof(Batch, entries) +
+           offsetof(Entries, data) + entry_count * sizeof(Entry);
+}
+
+/// \brief Prepares the header of a batch frame for sending its first entries.size entries
+/// \return The bytes of frame to send
+template <typename Batch>
+score::cpp::span<std::uint8_t const> finalize_batch(Message_frame<Batch>& frame) noexcept {
+    auto const frame_size = batch_frame_size<Batch>(frame.payload.entries.size);
+    frame.header.payload_size =
+        static_cast<std::uint16_t>(frame_size - offsetof(Message_frame<Batch>, payload));
+    return {reinterpret_cast<std::uint8_t const*>(&frame), frame_size};
+}
+
+/// \brief Check and cast a batch message, which is transmitted without unused entries
+/// \param data Incoming message data (including framing)
+/// \return Pointer to the batch if type, sizes and alignment are valid, std::nullopt otherwise
+template <typename Batch>
+std::optional<Batch const*> check_and_cast_batch(
+    score::cpp::span<std::uint8_t const> data) noexcept {
+    using Frame = Message_frame<Batch>;
+
+    if (data.size() < batch_frame_size<Batch>(0U) || get_message_type(data[0]) != Batch::type) {
+        return std::nullopt;
+    }
+
+    if (reinterpret_cast<std::uintptr_t>(data.data()) % alignof(Frame) != 0) {
+        return std::nullopt;  // Invalid frame - unaligned data pointer
+    }
+
+    auto const* const frame = reinterpret_cast<Frame const*>(data.data());
+    auto const entry_count = frame->payload.entries.size;
+    if (entry_count > decltype(Batch::entries)::max_size ||
+        data.size() < batch_frame_size<Batch>(entry_count) ||
+        frame->header.payload_size !=
+            batch_frame_size<Batch>(entry_count) - offsetof(Frame, payload)) {
+        return std::nullopt;  // Invalid frame - sizes do not match
+    }
+
+    return &frame->payload;
+}
+
+/// \brief Number of slots of all slot classes of a shared memory
+inline std::size_t total_slot_count(Shared_memory_metadata const& metadata) noexcept {
+    std::size_t result = metadata.slot_count;
+    for (std::size_t i = 0U; i < metadata.slot_classes.size; ++i) {
+        result += metadata.slot_classes.data[i].slot_count;
+    }
+    return result;
+}
+
+/// \brief Number of Connect and Connect_continuation messages carrying all elements and configs
+inline std::size_t connect_page_count(std::size_t find_service_elements,
+                                      std::size_t shared_memory_configs) noexcept {
+    auto const entries = std::max(find_service_elements, shared_memory_configs);
+    return std::max<std::size_t>(1U,
+                                 (entries + kMax_connect_page_size - 1U) / kMax_connect_page_size);
+}
+
+/// \brief Copies the entries of elements belonging to page page_index into page
+template <typename Page, typename Elements>
+void fill_connect_page(Page& page, Elements const& elements, std::size_t page_index) noexcept {
+    auto const begin = std::min(elements.size(), page_index * Page::max_size);
+    auto const end = std::min(elements.size(), begin + Page::max_size);
+    page.size = end - begin;
+    std::copy(elements.begin() + begin, elements.begin() + end, page.data.begin());
+}
+
+/// \brief Appends the entries of a page received in Connect or Connect_continuation to elements
+template <typename Elements, typename Page>
+void append_connect_page(Elements& elements, Page const& page) {
+    elements.insert(elements.end(), page.data.begin(), page.data.begin() + page.size);
+}
+
 struct Service_counts {
     std::uint16_t num_methods{0U};
     std::uint16_t num_events{0U};
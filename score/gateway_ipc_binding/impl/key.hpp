@@ -14,6 +14,7 @@
 #ifndef SRC_GATEWAY_IPC_BINDING_SRC_KEY
 #define SRC_GATEWAY_IPC_BINDING_SRC_KEY
 
+#include <deque>
 #include <unordered_map>
 
 #include "gateway_ipc_binding_util.hpp"
@@ -24,6 +25,51 @@ namespace score::gateway_ipc_binding {
 
 using Key_t = std::size_t;
 
+/// \brief Values indexed directly by Key_t
+///
+/// Keys are handed out sequentially by Keys, so the values of all keys are stored densely and
+/// looked up without hashing. Values are never removed, only reset by their owner. Backed by a
+/// std::deque, so references to values stay valid when values for further keys are added and
+/// values do not need to be movable.
+template <typename T>
+class Key_map {
+   public:
+    /// \return The value of key, nullptr if it has not been created yet
+    T* find(Key_t const& key) noexcept { return key < m_values.size() ? &m_values[key] : nullptr; }
+
+    T const* find(Key_t const& key) const noexcept {
+        return key < m_values.size() ? &m_values[key] : nullptr;
+    }
+
+    /// \return The value of key, default constructed first if it does not exist yet
+    T& operator[](Key_t const& key) {
+        while (m_values.size() <= key) {
+            m_values.emplace_back();
+        }
+        return m_values[key];
+    }
+
+    /// \brief Calls function(key, value) for all values in order of their keys
+    template <typename Function>
+    void for_each(Function&& function) {
+        for (Key_t key = 0U; key < m_values.size(); ++key) {
+            function(key, m_values[key]);
+        }
+    }
+
+    template <typename Function>
+    void for_each(Function&& function) const {
+        for (Key_t key = 0U; key < m_values.size(); ++key) {
+            function(key, m_values[key]);
+        }
+    }
+
+    std::size_t size() const noexcept { return m_values.size(); }
+
+   private:
+    std::deque<T> m_values;
+};
+
 /// \brief Mapping of service/instance pairs to unique keys and back.
 ///
 /// A service is uniquely identified by the combination of its interface and instance, which are
@@ -31,13 +77,15 @@ using Key_t = std::size_t;
 /// service/instance pair.
 ///
 /// The keys are then used in IPC messages and internal data structures to refer to services without
-/// needing to copy large strings around.
+/// needing to copy large strings around. Only the resolution of strings to keys hashes, the service
+/// and instance of a key are found by index.
 class Keys {
     using Instance_to_key_map = std::unordered_map<Instance_id, Key_t, Fixed_size_container_hash>;
     using Service_to_instance_key_map =
         std::unordered_map<Service, Instance_to_key_map, Service_hash>;
 
     Service_to_instance_key_map m_keys;
+    Key_map<Service_instance> m_service_instances;
     Id_generator<Key_t> m_next_key{0};
 
    public:
@@ -55,7 +103,9 @@ class Keys {
             }
         }
 
-        return m_keys[service][instance] = m_next_key.get_next_id();
+        auto const key = m_next_key.get_next_id();
+        m_service_instances[key] = Service_instance{service, instance};
+        return m_keys[service][instance] = key;
     }
 
     /// \brief Get the unique key for a given service and instance, creating a new key if it doesn't
@@ -85,14 +135,11 @@ class Keys {
     std::optional<std::tuple<std::reference_wrapper<Service const>,
                              std::reference_wrapper<Instance_id const>>>
     get(Key_t const& key) const {
-        for (const auto& [service, instance_map] : m_keys) {
-            for (const auto& [instance, instance_key] : instance_map) {
-                if (instance_key == key) {
-                    return {{std::cref(service), std::cref(instance)}};
-                }
-            }
+        auto const* const service_instance = m_service_instances.find(key);
+        if (service_instance == nullptr) {
+            return std::nullopt;
         }
-        return std::nullopt;
+        return {{std::cref(service_instance->service), std::cref(service_instance->instance_id)}};
     }
 };
 
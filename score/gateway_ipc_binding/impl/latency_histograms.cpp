@@ -0,0 +1,146 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "latency_histograms.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace score::gateway_ipc_binding {
+
+void Latency_histogram::record(std::uint64_t nanoseconds) noexcept {
+    ++m_buckets[bucket_index(nanoseconds)];
+    ++m_count;
+    m_max = std::max(m_max, nanoseconds);
+}
+
+std::chrono::nanoseconds Latency_histogram::quantile(double q) const noexcept {
+    if (m_count == 0U) {
+        return std::chrono::nanoseconds{0};
+    }
+
+    // Rank of the value, starting at 1
+    auto const rank = std::max<std::uint64_t>(
+        1U, static_cast<std::uint64_t>(std::ceil(q * static_cast<double>(m_count))));
+    std::uint64_t seen{0U};
+    for (std::size_t index = 0U; index < m_buckets.size(); ++index) {
+        seen += m_buckets[index];
+        if (seen >= rank) {
+            // The bucket of the largest value is bounded by the value itself
+            return std::chrono::nanoseconds{std::min(bucket_upper_bound(index), m_max)};
+        }
+    }
+    return max();
+}
+
+std::size_t Latency_histogram::bucket_index(std::uint64_t nanoseconds) noexcept {
+    if (nanoseconds < 2U * k_sub_bucket_count) {
+        return static_cast<std::size_t>(nanoseconds);
+    }
+
+    // Keeps the k_sub_bucket_bits bits below the most significant one
+    std::size_t shift{0U};
+    auto value = nanoseconds;
+    while (value >= 2U * k_sub_bucket_count) {
+        value >>= 1U;
+        ++shift;
+    }
+    return (shift + 1U) * k_sub_bucket_count + static_cast<std::size_t>(value - k_sub_bucket_count);
+}
+
+std::uint64_t Latency_histogram::bucket_upper_bound(std::size_t index) noexcept {
+    if (index < 2U * k_sub_bucket_count) {
+        return index;
+    }
+
+    auto const shift = index / k_sub_bucket_count - 1U;
+    auto const lower = static_cast<std::uint64_t>(k_sub_bucket_count + index % k_sub_bucket_count)
+                       << shift;
+    return lower + ((std::uint64_t{1U} << shift) - 1U);
+}
+
+void Latency_histograms::allocated(Key_t key, Slot_handle slot, std::uint64_t allocated_ns) {
+    std::lock_guard<std::mutex> const lock{m_mutex};
+    auto& allocations = m_allocations[key];
+    if (slot >= allocations.size()) {
+        allocations.resize(slot + 1U, 0U);
+    }
+    allocations[slot] = allocated_ns;
+}
+
+std::uint64_t Latency_histograms::allocation_time(Key_t key, Slot_handle slot) const {
+    std::lock_guard<std::mutex> const lock{m_mutex};
+    auto const* const allocations = m_allocations.find(key);
+    if (allocations == nullptr || slot >= allocations->size()) {
+        return 0U;
+    }
+    return (*allocations)[slot];
+}
+
+void Latency_histograms::record(Key_t key, Event_id event_id, Latency_stage stage,
+                                std::uint64_t from_ns, std::uint64_t to_ns) {
+    std::lock_guard<std::mutex> const lock{m_mutex};
+    record_locked(key, event_id, stage, from_ns, to_ns);
+}
+
+void Latency_histograms::received(Client_id client_id, Remote_handle required_id,
+                                  Slot_handle slot, Received_update const& update) {
+    std::lock_guard<std::mutex> const lock{m_mutex};
+    m_received.insert_or_assign({client_id, required_id, slot}, update);
+}
+
+void Latency_histograms::consumed(Client_id client_id, Remote_handle required_id,
+                                  Slot_handle slot) {
+    auto const now_ns = now();
+    std::lock_guard<std::mutex> const lock{m_mutex};
+    auto const received = m_received.find({client_id, required_id, slot});
+    if (received == m_received.end()) {
+        return;
+    }
+
+    auto const& update = received->second;
+    record_locked(update.key, update.event_id, Latency_stage::receive_to_consume,
+                  update.received_ns, now_ns);
+    record_locked(update.key, update.event_id, Latency_stage::allocate_to_consume,
+                  update.timestamps.allocated_ns, now_ns);
+    m_received.erase(received);
+}
+
+Latency_histogram_summaries Latency_histograms::summarize(Keys const& keys) const {
+    Latency_histogram_summaries summaries;
+    std::lock_guard<std::mutex> const lock{m_mutex};
+    for (auto const& [id, histogram] : m_histograms) {
+        auto const& [key, event_id, stage] = id;
+        auto const service_instance = keys.get(key);
+        if (!service_instance) {
+            continue;
+        }
+
+        auto const& [service, instance_id] = *service_instance;
+        summaries.push_back({service.get(), instance_id.get(), event_id, stage, histogram.count(),
+                             histogram.quantile(0.5), histogram.quantile(0.99),
+                             histogram.quantile(0.999), histogram.max()});
+    }
+    return summaries;
+}
+
+void Latency_histograms::record_locked(Key_t key, Event_id event_id, Latency_stage stage,
+                                       std::uint64_t from_ns, std::uint64_t to_ns) {
+    // Clocks of both sides are the same, a negative latency can only stem from a bogus timestamp
+    if (from_ns == 0U || to_ns < from_ns) {
+        return;
+    }
+    m_histograms[{key, event_id, stage}].record(to_ns - from_ns);
+}
+
+}  // namespace score::gateway_ipc_binding
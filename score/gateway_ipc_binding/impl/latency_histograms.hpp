@@ -0,0 +1,125 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SRC_GATEWAY_IPC_BINDING_SRC_LATENCY_HISTOGRAMS
+#define SRC_GATEWAY_IPC_BINDING_SRC_LATENCY_HISTOGRAMS
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
+#include "key.hpp"
+#include "score/gateway_ipc_binding/gateway_ipc_binding.hpp"
+#include "score/gateway_ipc_binding/gateway_ipc_binding_server.hpp"
+#include "score/gateway_ipc_binding/shared_memory_slot_manager.hpp"
+
+namespace score::gateway_ipc_binding {
+
+/// \brief Log-linear histogram of latencies in nanoseconds
+///
+/// Values below 16 have a bucket each, larger ones fall into one of 8 buckets per power of two, so
+/// a bucket is at most 12.5% wide. Not thread-safe.
+class Latency_histogram {
+   public:
+    void record(std::uint64_t nanoseconds) noexcept;
+
+    std::uint64_t count() const noexcept { return m_count; }
+
+    /// \return Upper bound of the bucket holding the quantile q of all values, zero without values
+    std::chrono::nanoseconds quantile(double q) const noexcept;
+
+    std::chrono::nanoseconds max() const noexcept { return std::chrono::nanoseconds{m_max}; }
+
+   private:
+    static constexpr std::size_t k_sub_bucket_bits = 3U;
+    static constexpr std::size_t k_sub_bucket_count = std::size_t{1U} << k_sub_bucket_bits;
+    static constexpr std::size_t k_bucket_count =
+        (64U - k_sub_bucket_bits + 1U) * k_sub_bucket_count;
+
+    static std::size_t bucket_index(std::uint64_t nanoseconds) noexcept;
+    static std::uint64_t bucket_upper_bound(std::size_t index) noexcept;
+
+    std::array<std::uint64_t, k_bucket_count> m_buckets{};
+    std::uint64_t m_count{0U};
+    std::uint64_t m_max{0U};
+};
+
+/// \brief Latency histograms of the event updates of a binding, per service instance, event and
+///        Latency_stage
+///
+/// Recording takes m_mutex, the binding only calls it with Latency_tracing enabled.
+class Latency_histograms {
+   public:
+    /// \brief Update received from a peer whose payload has not been consumed yet
+    struct Received_update {
+        Key_t key;
+        Event_id event_id;
+        Event_timestamps timestamps;
+        std::uint64_t received_ns;
+    };
+
+    explicit Latency_histograms(Latency_tracing const& config) noexcept
+        : m_enabled(config.enabled) {}
+
+    bool is_enabled() const noexcept { return m_enabled; }
+
+    /// \return Nanoseconds of std::chrono::steady_clock
+    static std::uint64_t now() noexcept {
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                              std::chrono::steady_clock::now().time_since_epoch())
+                                              .count());
+    }
+
+    /// \brief Remembers when slot of the shared memory of key was allocated
+    void allocated(Key_t key, Slot_handle slot, std::uint64_t allocated_ns);
+
+    /// \return When slot of the shared memory of key was allocated last, zero if unknown
+    std::uint64_t allocation_time(Key_t key, Slot_handle slot) const;
+
+    /// \brief Records the latency from from_ns to to_ns, unless from_ns has not been recorded
+    void record(Key_t key, Event_id event_id, Latency_stage stage, std::uint64_t from_ns,
+                std::uint64_t to_ns);
+
+    /// \brief Remembers an update received from client_id until its payload is consumed
+    void received(Client_id client_id, Remote_handle required_id, Slot_handle slot,
+                  Received_update const& update);
+
+    /// \brief Records the stages of a received update which end with the consumption of its payload
+    void consumed(Client_id client_id, Remote_handle required_id, Slot_handle slot);
+
+    /// \param keys Resolves the service instances, the caller keeps it from being modified
+    Latency_histogram_summaries summarize(Keys const& keys) const;
+
+   private:
+    using Histogram_id = std::tuple<Key_t, Event_id, Latency_stage>;
+    using Received_id = std::tuple<Client_id, Remote_handle, Slot_handle>;
+
+    void record_locked(Key_t key, Event_id event_id, Latency_stage stage, std::uint64_t from_ns,
+                       std::uint64_t to_ns);
+
+    bool const m_enabled;
+    mutable std::mutex m_mutex;
+    /// \brief Allocation time per slot handle
+    Key_map<std::vector<std::uint64_t>> m_allocations;
+    std::map<Received_id, Received_update> m_received;
+    std::map<Histogram_id, Latency_histogram> m_histograms;
+};
+
+}  // namespace score::gateway_ipc_binding
+
+#endif  // SRC_GATEWAY_IPC_BINDING_SRC_LATENCY_HISTOGRAMS
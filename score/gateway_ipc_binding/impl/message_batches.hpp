@@ -0,0 +1,322 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SRC_GATEWAY_IPC_BINDING_SRC_MESSAGE_BATCHES
+#define SRC_GATEWAY_IPC_BINDING_SRC_MESSAGE_BATCHES
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
+#include "gateway_ipc_binding_util.hpp"
+#include "reply_channel.hpp"
+#include "score/gateway_ipc_binding/gateway_ipc_binding.hpp"
+#include "score/gateway_ipc_binding/gateway_ipc_binding_server.hpp"
+
+namespace score::gateway_ipc_binding {
+
+using Batch_clock = std::chrono::steady_clock;
+
+/// \brief Pending batch message (e.g. Event_update_batch) per peer, collected according to a
+/// Batching_policy
+///
+/// Thread-safe. The callbacks are called with the internal lock held and must not call back into
+/// the same Message_batches.
+template <typename Batch>
+class Message_batches {
+   public:
+    using Clock = Batch_clock;
+    using Entry = typename decltype(decltype(Batch::entries)::data)::value_type;
+    /// \brief Called for every queued entry which could not be sent
+    using On_entry_lost = std::function<void(Client_id, Entry const&)>;
+    /// \brief Called with the deadline of a batch when its first entry is queued
+    using On_batch_started = std::function<void(Clock::time_point)>;
+
+    Message_batches(Batching_policy policy, On_entry_lost on_entry_lost,
+                    On_batch_started on_batch_started = {})
+        : m_max_entries(std::min(policy.max_entries, decltype(Batch::entries)::max_size)),
+          m_max_delay(policy.max_delay),
+          m_on_entry_lost(std::move(on_entry_lost)),
+          m_on_batch_started(std::move(on_batch_started)) {}
+
+    bool is_enabled() const noexcept { return m_max_entries > 1U; }
+
+    bool has_deadline() const noexcept { return is_enabled() && m_max_delay.count() > 0; }
+
+    /// \brief Queues an entry for client_id and sends the batch once it is full
+    /// \param max_entries Sends the batch already when it holds this many entries
+    ///
+    /// If sending fails, on_entry_lost is called for the previously queued entries of the batch,
+    /// while the failure of entry itself is reported by the return value.
+    Result<void> add(Client_id client_id, Reply_channel& channel, Entry const& entry,
+                     std::size_t max_entries = std::numeric_limits<std::size_t>::max()) {
+        std::lock_guard<std::mutex> const lock{m_mutex};
+        auto& batch = m_batches[client_id];
+        batch.channel = &channel;
+        auto& entries = batch.frame.payload.entries;
+        if (entries.size == 0U && m_max_delay.count() > 0) {
+            batch.deadline = Clock::now() + m_max_delay;
+            if (m_on_batch_started) {
+                m_on_batch_started(batch.deadline);
+            }
+        }
+
+        entries.data[entries.size] = entry;
+        ++entries.size;
+        if (entries.size < std::min(m_max_entries, max_entries)) {
+            return {};
+        }
+
+        auto const result = send(batch);
+        if (!result) {
+            report_lost(client_id, batch, entries.size - 1U);
+        }
+        entries.size = 0U;
+        return result;
+    }
+
+    /// \brief Sends the pending entries of client_id
+    void flush(Client_id client_id) {
+        std::lock_guard<std::mutex> const lock{m_mutex};
+        auto it = m_batches.find(client_id);
+        if (it != m_batches.end()) {
+            flush(it->first, it->second);
+        }
+    }
+
+    /// \brief Sends the pending entries of all peers
+    void flush_all() {
+        std::lock_guard<std::mutex> const lock{m_mutex};
+        for (auto& [client_id, batch] : m_batches) {
+            flush(client_id, batch);
+        }
+    }
+
+    /// \brief Sends all batches whose deadline has passed
+    /// \return Earliest deadline of the batches still pending
+    std::optional<Clock::time_point> flush_expired(Clock::time_point now) {
+        std::lock_guard<std::mutex> const lock{m_mutex};
+        std::optional<Clock::time_point> next_deadline;
+        for (auto& [client_id, batch] : m_batches) {
+            if (batch.frame.payload.entries.size == 0U) {
+                continue;
+            }
+            if (batch.deadline <= now) {
+                flush(client_id, batch);
+            } else if (!next_deadline || batch.deadline < *next_deadline) {
+                next_deadline = batch.deadline;
+            }
+        }
+        return next_deadline;
+    }
+
+    /// \brief Drops the pending entries of a disconnected peer, reporting them as lost
+    void remove_client(Client_id client_id) {
+        std::lock_guard<std::mutex> const lock{m_mutex};
+        auto it = m_batches.find(client_id);
+        if (it == m_batches.end()) {
+            return;
+        }
+        report_lost(client_id, it->second, it->second.frame.payload.entries.size);
+        m_batches.erase(it);
+    }
+
+   private:
+    struct Pending_batch {
+        Reply_channel* channel{nullptr};
+        Clock::time_point deadline{};
+        Message_frame<Batch> frame{};
+    };
+
+    static Result<void> send(Pending_batch& batch) noexcept {
+        auto const& entries = batch.frame.payload.entries;
+        if (entries.size == 1U) {
+            // Not worth the batch framing for the receiver
+            Message_frame<Entry> single;
+            single.payload = entries.data[0];
+            return batch.channel->send(single);
+        }
+        return batch.channel->send(finalize_batch(batch.frame));
+    }
+
+    void flush(Client_id client_id, Pending_batch& batch) {
+        auto& entries = batch.frame.payload.entries;
+        if (entries.size == 0U) {
+            return;
+        }
+        if (!send(batch)) {
+            report_lost(client_id, batch, entries.size);
+        }
+        entries.size = 0U;
+    }
+
+    void report_lost(Client_id client_id, Pending_batch const& batch, std::size_t count) {
+        for (std::size_t i = 0U; i < count; ++i) {
+            m_on_entry_lost(client_id, batch.frame.payload.entries.data[i]);
+        }
+    }
+
+    std::size_t m_max_entries;
+    std::chrono::microseconds m_max_delay;
+    On_entry_lost m_on_entry_lost;
+    On_batch_started m_on_batch_started;
+    std::mutex m_mutex;
+    std::unordered_map<Client_id, Pending_batch> m_batches;
+};
+
+using Payload_consumed_batches = Message_batches<Payload_consumed_batch>;
+
+/// \brief Event_update_batch per peer, or Traced_event_update_batch if the updates carry
+///        timestamps
+///
+/// Thread-safe like Message_batches. Whether updates are traced is fixed, only the batches of one
+/// kind are ever used.
+class Event_update_batches {
+    bool const m_traced;
+    Message_batches<Event_update_batch> m_updates;
+    Message_batches<Traced_event_update_batch> m_traced_updates;
+
+    template <typename Function>
+    decltype(auto) visit(Function function) {
+        return m_traced ? function(m_traced_updates) : function(m_updates);
+    }
+
+   public:
+    using Clock = Batch_clock;
+    using On_entry_lost = std::function<void(Client_id, Event_update const&)>;
+    using On_batch_started = std::function<void(Clock::time_point)>;
+
+    Event_update_batches(Batching_policy policy, bool traced, On_entry_lost on_entry_lost,
+                         On_batch_started on_batch_started = {})
+        : m_traced(traced),
+          m_updates(policy, on_entry_lost, on_batch_started),
+          m_traced_updates(
+              policy,
+              [on_entry_lost](Client_id client_id, Traced_event_update const& traced_update) {
+                  on_entry_lost(client_id, traced_update.update);
+              },
+              on_batch_started) {}
+
+    bool is_enabled() const noexcept { return m_updates.is_enabled(); }
+
+    bool has_deadline() const noexcept { return m_updates.has_deadline(); }
+
+    /// \see Message_batches::add
+    Result<void> add(Client_id client_id, Reply_channel& channel, Event_update const& update) {
+        assert(!m_traced && "Traced event updates should carry timestamps");
+        return m_updates.add(client_id, channel, update);
+    }
+
+    /// \see Message_batches::add
+    Result<void> add(Client_id client_id, Reply_channel& channel,
+                     Traced_event_update const& update) {
+        assert(m_traced && "Event updates should not carry timestamps");
+        return m_traced_updates.add(client_id, channel, update);
+    }
+
+    void flush(Client_id client_id) {
+        visit([client_id](auto& batches) { batches.flush(client_id); });
+    }
+
+    void flush_all() {
+        visit([](auto& batches) { batches.flush_all(); });
+    }
+
+    std::optional<Clock::time_point> flush_expired(Clock::time_point now) {
+        return visit([now](auto& batches) { return batches.flush_expired(now); });
+    }
+
+    void remove_client(Client_id client_id) {
+        visit([client_id](auto& batches) { batches.remove_client(client_id); });
+    }
+};
+
+/// \brief Background thread which calls back once the earliest armed deadline has passed
+class Batch_flush_timer {
+   public:
+    using Clock = Batch_clock;
+    /// \brief Called without internal lock once a deadline passed, returns the next deadline
+    using On_expired = std::function<std::optional<Clock::time_point>(Clock::time_point)>;
+
+    explicit Batch_flush_timer(On_expired on_expired)
+        : m_on_expired(std::move(on_expired)), m_thread([this]() { run(); }) {}
+
+    ~Batch_flush_timer() {
+        {
+            std::lock_guard<std::mutex> const lock{m_mutex};
+            m_stop = true;
+        }
+        m_condition.notify_one();
+        m_thread.join();
+    }
+
+    Batch_flush_timer(Batch_flush_timer const&) = delete;
+    Batch_flush_timer& operator=(Batch_flush_timer const&) = delete;
+    Batch_flush_timer(Batch_flush_timer&&) = delete;
+    Batch_flush_timer& operator=(Batch_flush_timer&&) = delete;
+
+    /// \brief Makes sure the callback runs no later than shortly after deadline
+    void arm(Clock::time_point deadline) {
+        std::lock_guard<std::mutex> const lock{m_mutex};
+        if (!m_deadline || deadline < *m_deadline) {
+            m_deadline = deadline;
+            m_condition.notify_one();
+        }
+    }
+
+   private:
+    void run() {
+        std::unique_lock<std::mutex> lock{m_mutex};
+        while (!m_stop) {
+            if (!m_deadline) {
+                m_condition.wait(lock);
+                continue;
+            }
+
+            auto const now = Clock::now();
+            if (now < *m_deadline) {
+                m_condition.wait_until(lock, *m_deadline);
+                continue;
+            }
+
+            m_deadline.reset();
+            lock.unlock();
+            auto const next_deadline = m_on_expired(now);
+            lock.lock();
+            if (next_deadline && (!m_deadline || *next_deadline < *m_deadline)) {
+                m_deadline = next_deadline;
+            }
+        }
+    }
+
+    On_expired m_on_expired;
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    std::optional<Clock::time_point> m_deadline;
+    bool m_stop{false};
+    // Started last, after all members used by run() are initialized
+    std::thread m_thread;
+};
+
+}  // namespace score::gateway_ipc_binding
+
+#endif  // SRC_GATEWAY_IPC_BINDING_SRC_MESSAGE_BATCHES
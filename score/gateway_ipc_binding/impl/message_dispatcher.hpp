@@ -0,0 +1,171 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SRC_GATEWAY_IPC_BINDING_SRC_MESSAGE_DISPATCHER
+#define SRC_GATEWAY_IPC_BINDING_SRC_MESSAGE_DISPATCHER
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <score/span.hpp>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "score/gateway_ipc_binding/gateway_ipc_binding_server.hpp"
+
+namespace score::gateway_ipc_binding {
+
+/// \brief Worker threads handling received messages
+///
+/// Each message is assigned to a worker by its partition, e.g. the handle of the service
+/// connection it belongs to. Messages of the same partition are handled one after another in the
+/// order they were dispatched, messages of other partitions in parallel by the other workers.
+///
+/// Messages are copied into the queue of their worker, a byte buffer which the worker swaps with
+/// its previous one once it takes the queued messages. Each message starts at a multiple of
+/// alignof(std::max_align_t), so handlers can cast it like a message received from the socket.
+class Message_dispatcher {
+   public:
+    /// \brief Called by a worker thread for each dispatched message
+    using Handler = std::function<void(Client_id, score::cpp::span<std::uint8_t const>)>;
+
+    Message_dispatcher(std::size_t worker_count, Handler handler) : m_handler(std::move(handler)) {
+        m_workers.reserve(worker_count);
+        for (std::size_t i = 0U; i < worker_count; ++i) {
+            m_workers.push_back(std::make_unique<Worker>());
+        }
+        // Started after all workers exist, none of them is moved anymore
+        for (auto& worker : m_workers) {
+            worker->thread = std::thread([this, &worker = *worker]() { run(worker); });
+        }
+    }
+
+    /// \brief Handles all dispatched messages, then stops the workers
+    ~Message_dispatcher() {
+        for (auto& worker : m_workers) {
+            {
+                std::lock_guard<std::mutex> const lock{worker->mutex};
+                worker->stop = true;
+            }
+            worker->wake.notify_one();
+        }
+        for (auto& worker : m_workers) {
+            worker->thread.join();
+        }
+    }
+
+    Message_dispatcher(Message_dispatcher const&) = delete;
+    Message_dispatcher& operator=(Message_dispatcher const&) = delete;
+    Message_dispatcher(Message_dispatcher&&) = delete;
+    Message_dispatcher& operator=(Message_dispatcher&&) = delete;
+
+    /// \brief Queues a copy of message for the worker of partition
+    void dispatch(std::size_t partition, Client_id client_id,
+                  score::cpp::span<std::uint8_t const> message) {
+        auto& worker = *m_workers[partition % m_workers.size()];
+        bool was_empty = false;
+        {
+            std::lock_guard<std::mutex> const lock{worker.mutex};
+            auto& queued = worker.queued;
+            was_empty = queued.empty();
+
+            Entry_header const header{client_id, message.size()};
+            auto const offset = queued.size();
+            queued.resize(offset + kEntry_header_size + aligned_size(message.size()));
+            std::memcpy(&queued[offset], &header, sizeof(header));
+            std::memcpy(&queued[offset + kEntry_header_size], message.data(), message.size());
+        }
+        if (was_empty) {
+            worker.wake.notify_one();
+        }
+    }
+
+    /// \brief Returns once all messages dispatched before the call have been handled
+    ///
+    /// Must not be called by a handler.
+    void wait_idle() {
+        for (auto& worker : m_workers) {
+            std::unique_lock<std::mutex> lock{worker->mutex};
+            worker->idle.wait(lock, [&worker]() {
+                return worker->queued.empty() && !worker->handling;
+            });
+        }
+    }
+
+   private:
+    struct Entry_header {
+        Client_id client_id;
+        std::size_t size;
+    };
+
+    static constexpr std::size_t kEntry_alignment = alignof(std::max_align_t);
+
+    static constexpr std::size_t aligned_size(std::size_t size) noexcept {
+        return (size + kEntry_alignment - 1U) / kEntry_alignment * kEntry_alignment;
+    }
+
+    static constexpr std::size_t kEntry_header_size =
+        (sizeof(Entry_header) + kEntry_alignment - 1U) / kEntry_alignment * kEntry_alignment;
+
+    struct Worker {
+        std::mutex mutex;
+        std::condition_variable wake;
+        std::condition_variable idle;
+        std::vector<std::uint8_t> queued;
+        bool handling{false};
+        bool stop{false};
+        std::thread thread;
+    };
+
+    void run(Worker& worker) {
+        std::vector<std::uint8_t> taken;
+        std::unique_lock<std::mutex> lock{worker.mutex};
+        while (true) {
+            worker.wake.wait(lock, [&worker]() { return worker.stop || !worker.queued.empty(); });
+            if (worker.queued.empty()) {
+                return;  // Stopped, all messages have been handled
+            }
+
+            taken.clear();
+            std::swap(taken, worker.queued);
+            worker.handling = true;
+            lock.unlock();
+
+            for (std::size_t offset = 0U; offset < taken.size();) {
+                Entry_header header{};
+                std::memcpy(&header, &taken[offset], sizeof(header));
+                offset += kEntry_header_size;
+                m_handler(header.client_id, {&taken[offset], header.size});
+                offset += aligned_size(header.size);
+            }
+
+            lock.lock();
+            worker.handling = false;
+            if (worker.queued.empty()) {
+                worker.idle.notify_all();
+            }
+        }
+    }
+
+    Handler m_handler;
+    std::vector<std::unique_ptr<Worker>> m_workers;
+};
+
+}  // namespace score::gateway_ipc_binding
+
+#endif  // SRC_GATEWAY_IPC_BINDING_SRC_MESSAGE_DISPATCHER
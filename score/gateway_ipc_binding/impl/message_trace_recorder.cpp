@@ -0,0 +1,318 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "message_trace_recorder.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstring>
+
+#include "gateway_ipc_binding_util.hpp"
+#include "score/gateway_ipc_binding/error.hpp"
+
+namespace score::gateway_ipc_binding {
+
+namespace {
+
+/// \brief Header of the binary trace format
+struct Message_trace_header {
+    std::array<char, 8> magic;
+    std::uint32_t version;
+    std::uint32_t record_size;
+    std::uint64_t record_count;
+};
+
+constexpr std::array<char, 8> k_trace_magic{'G', 'W', 'I', 'P', 'C', 'T', 'R', 'C'};
+constexpr std::uint32_t k_trace_version{1U};
+
+std::atomic<std::uint64_t> next_recorder_id{1U};
+
+std::uint32_t to_trace_slot(std::size_t slot_index) noexcept {
+    return slot_index == kNo_payload_slot ? kNo_trace_slot
+                                          : static_cast<std::uint32_t>(slot_index);
+}
+
+void set_payload(Message_trace_record& record, Shared_memory_handle const& payload) noexcept {
+    record.slot_index = to_trace_slot(payload.slot_index);
+    record.payload_bytes = static_cast<std::uint32_t>(payload.used_bytes);
+}
+
+void describe(Message_trace_record& record, Event_update const& msg) noexcept {
+    record.handle = msg.required_id;
+    record.element_id = msg.event_id;
+    set_payload(record, msg.payload);
+}
+
+void describe(Message_trace_record& record, Traced_event_update const& msg) noexcept {
+    describe(record, msg.update);
+}
+
+void describe(Message_trace_record& record, Payload_consumed const& msg) noexcept {
+    record.handle = msg.required_id;
+    set_payload(record, msg.handle);
+}
+
+void describe(Message_trace_record& record, Call_method const& msg) noexcept {
+    record.handle = msg.provided_id;
+    record.element_id = msg.method_id;
+    set_payload(record, msg.payload);
+}
+
+void describe(Message_trace_record& record, Call_method_reply const& msg) noexcept {
+    record.handle = msg.required_id;
+    set_payload(record, msg.payload);
+}
+
+void describe(Message_trace_record& record, Cancel_method_call const& msg) noexcept {
+    record.handle = msg.provided_id;
+    record.element_id = msg.method_id;
+}
+
+void describe(Message_trace_record& record, Subscribe_event const& msg) noexcept {
+    record.handle = msg.provided_id;
+    record.element_id = msg.event_id;
+}
+
+template <typename Msg>
+void describe_message(Message_trace_record& record,
+                      score::cpp::span<std::uint8_t const> frame) noexcept {
+    auto const msg = check_and_cast<Msg>(frame);
+    if (msg) {
+        describe(record, **msg);
+    }
+}
+
+}  // namespace
+
+Message_trace_recorder::Message_trace_recorder(Message_tracing const& config)
+    : m_capacity(config.records_per_thread), m_id(next_recorder_id++) {}
+
+void Message_trace_recorder::record(Client_id client_id, Message_direction direction,
+                                    score::cpp::span<std::uint8_t const> frame) noexcept {
+    if (m_capacity == 0U || frame.empty()) {
+        return;
+    }
+
+    auto* const ring = get_ring();
+
+    Message_trace_record record{};
+    record.timestamp_ns = static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+    record.client_id = static_cast<std::uint32_t>(client_id);
+    record.slot_index = kNo_trace_slot;
+    record.frame_bytes = static_cast<std::uint32_t>(frame.size());
+    record.type = get_message_type(frame[0]);
+    record.direction = direction;
+
+    switch (record.type) {
+        case Message_type::Event_update:
+            describe_message<Event_update>(record, frame);
+            break;
+        case Message_type::Traced_event_update:
+            describe_message<Traced_event_update>(record, frame);
+            break;
+        case Message_type::Payload_consumed:
+            describe_message<Payload_consumed>(record, frame);
+            break;
+        case Message_type::Call_method:
+            describe_message<Call_method>(record, frame);
+            break;
+        case Message_type::Call_method_reply:
+            describe_message<Call_method_reply>(record, frame);
+            break;
+        case Message_type::Cancel_method_call:
+            describe_message<Cancel_method_call>(record, frame);
+            break;
+        case Message_type::Subscribe_event:
+            describe_message<Subscribe_event>(record, frame);
+            break;
+        case Message_type::Event_update_batch: {
+            ring->push(record);
+            auto const batch = check_and_cast_batch<Event_update_batch>(frame);
+            if (batch) {
+                push_entries(*ring, record, (*batch)->entries);
+            }
+            return;
+        }
+        case Message_type::Traced_event_update_batch: {
+            ring->push(record);
+            auto const batch = check_and_cast_batch<Traced_event_update_batch>(frame);
+            if (batch) {
+                push_entries(*ring, record, (*batch)->entries);
+            }
+            return;
+        }
+        case Message_type::Payload_consumed_batch: {
+            ring->push(record);
+            auto const batch = check_and_cast_batch<Payload_consumed_batch>(frame);
+            if (batch) {
+                push_entries(*ring, record, (*batch)->entries);
+            }
+            return;
+        }
+        default:
+            break;
+    }
+    ring->push(record);
+}
+
+Message_trace_records Message_trace_recorder::snapshot() const {
+    Message_trace_records records;
+    {
+        std::lock_guard<std::mutex> const lock{m_mutex};
+        for (auto const& [thread_id, ring] : m_rings) {
+            ring->append_to(records);
+        }
+    }
+    std::stable_sort(records.begin(), records.end(), [](auto const& lhs, auto const& rhs) {
+        return lhs.timestamp_ns < rhs.timestamp_ns;
+    });
+    return records;
+}
+
+template <typename Entries>
+void Message_trace_recorder::push_entries(Ring& ring, Message_trace_record const& batch_record,
+                                          Entries const& entries) noexcept {
+    for (std::size_t i = 0U; i < entries.size; ++i) {
+        auto record = batch_record;
+        record.frame_bytes = 0U;
+        record.type = std::decay_t<decltype(entries.data[i])>::type;
+        describe(record, entries.data[i]);
+        ring.push(record);
+    }
+}
+
+void Message_trace_recorder::Ring::push(Message_trace_record const& record) noexcept {
+    std::array<std::uint64_t, k_record_words> words{};
+    std::memcpy(words.data(), &record, sizeof(record));
+
+    auto const position = m_head.load(std::memory_order_relaxed);
+    auto& entry = m_entries[position % m_entries.size()];
+    entry.sequence.store(2U * position + 1U, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    for (std::size_t i = 0U; i < k_record_words; ++i) {
+        entry.words[i].store(words[i], std::memory_order_relaxed);
+    }
+    entry.sequence.store(2U * position + 2U, std::memory_order_release);
+    m_head.store(position + 1U, std::memory_order_release);
+}
+
+void Message_trace_recorder::Ring::append_to(Message_trace_records& records) const {
+    auto const head = m_head.load(std::memory_order_acquire);
+    auto const first = head - std::min<std::uint64_t>(head, m_entries.size());
+    for (auto position = first; position < head; ++position) {
+        auto const& entry = m_entries[position % m_entries.size()];
+        auto const sequence = entry.sequence.load(std::memory_order_acquire);
+        std::array<std::uint64_t, k_record_words> words{};
+        for (std::size_t i = 0U; i < k_record_words; ++i) {
+            words[i] = entry.words[i].load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        // Overwritten by the writer while copying, or already before
+        if (sequence != 2U * position + 2U ||
+            entry.sequence.load(std::memory_order_relaxed) != sequence) {
+            continue;
+        }
+
+        Message_trace_record record{};
+        std::memcpy(&record, words.data(), sizeof(record));
+        records.push_back(record);
+    }
+}
+
+Message_trace_recorder::Ring* Message_trace_recorder::get_ring() {
+    struct Cached_ring {
+        std::uint64_t recorder_id;
+        Ring* ring;
+    };
+    // Recorder ids are never reused, so entries of destroyed recorders never match
+    static constexpr std::size_t k_cached_rings = 4U;
+    thread_local std::array<Cached_ring, k_cached_rings> cached_rings{};
+    thread_local std::size_t next_cached_ring{0U};
+
+    for (auto const& cached : cached_rings) {
+        if (cached.recorder_id == m_id) {
+            return cached.ring;
+        }
+    }
+
+    Ring* ring = nullptr;
+    {
+        std::lock_guard<std::mutex> const lock{m_mutex};
+        auto& owned = m_rings[std::this_thread::get_id()];
+        if (owned == nullptr) {
+            owned = std::make_unique<Ring>(m_capacity);
+        }
+        ring = owned.get();
+    }
+
+    cached_rings[next_cached_ring] = {m_id, ring};
+    next_cached_ring = (next_cached_ring + 1U) % k_cached_rings;
+    return ring;
+}
+
+bool operator==(Message_trace_record const& lhs, Message_trace_record const& rhs) noexcept {
+    return lhs.timestamp_ns == rhs.timestamp_ns && lhs.handle == rhs.handle &&
+           lhs.client_id == rhs.client_id && lhs.slot_index == rhs.slot_index &&
+           lhs.payload_bytes == rhs.payload_bytes && lhs.frame_bytes == rhs.frame_bytes &&
+           lhs.element_id == rhs.element_id && lhs.type == rhs.type &&
+           lhs.direction == rhs.direction;
+}
+
+Result<void> write_message_trace(std::ostream& stream, Message_trace_records const& records) {
+    Message_trace_header const header{k_trace_magic, k_trace_version,
+                                      static_cast<std::uint32_t>(sizeof(Message_trace_record)),
+                                      records.size()};
+    stream.write(reinterpret_cast<char const*>(&header), sizeof(header));
+    stream.write(reinterpret_cast<char const*>(records.data()),
+                 static_cast<std::streamsize>(records.size() * sizeof(Message_trace_record)));
+    stream.flush();
+    if (!stream) {
+        return MakeUnexpected(Gateway_ipc_binding_error::runtime_error_message_trace_io_failed);
+    }
+    return {};
+}
+
+Result<Message_trace_records> read_message_trace(std::istream& stream) {
+    Message_trace_header header{};
+    stream.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!stream) {
+        return MakeUnexpected(Gateway_ipc_binding_error::runtime_error_message_trace_io_failed);
+    }
+    if (header.magic != k_trace_magic || header.version != k_trace_version ||
+        header.record_size != sizeof(Message_trace_record)) {
+        return MakeUnexpected(Gateway_ipc_binding_error::runtime_error_invalid_message_trace);
+    }
+
+    // Read in chunks, so a corrupt record_count cannot allocate more than the stream holds
+    static constexpr std::size_t k_chunk_records = 4096U;
+    Message_trace_records records;
+    while (records.size() < header.record_count) {
+        auto const offset = records.size();
+        auto const count =
+            std::min<std::uint64_t>(k_chunk_records, header.record_count - records.size());
+        records.resize(offset + count);
+        stream.read(reinterpret_cast<char*>(&records[offset]),
+                    static_cast<std::streamsize>(count * sizeof(Message_trace_record)));
+        if (!stream) {
+            return MakeUnexpected(
+                Gateway_ipc_binding_error::runtime_error_message_trace_io_failed);
+        }
+    }
+    return records;
+}
+
+}  // namespace score::gateway_ipc_binding
@@ -0,0 +1,93 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SRC_GATEWAY_IPC_BINDING_SRC_MESSAGE_TRACE_RECORDER
+#define SRC_GATEWAY_IPC_BINDING_SRC_MESSAGE_TRACE_RECORDER
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <score/span.hpp>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "score/gateway_ipc_binding/gateway_ipc_binding_server.hpp"
+#include "score/gateway_ipc_binding/message_trace.hpp"
+
+namespace score::gateway_ipc_binding {
+
+/// \brief Records the messages of a binding into one ring per thread
+///
+/// A thread only takes m_mutex to create its ring on its first record. Afterwards it writes its
+/// ring without locks: each entry is guarded by a sequence number, so snapshot() skips entries
+/// overwritten while it copies them.
+class Message_trace_recorder {
+   public:
+    explicit Message_trace_recorder(Message_tracing const& config);
+
+    Message_trace_recorder(Message_trace_recorder const&) = delete;
+    Message_trace_recorder& operator=(Message_trace_recorder const&) = delete;
+
+    /// \brief Records frame, plus each entry if it is a batch
+    void record(Client_id client_id, Message_direction direction,
+                score::cpp::span<std::uint8_t const> frame) noexcept;
+
+    /// \return The records of all threads, ordered by timestamp
+    Message_trace_records snapshot() const;
+
+   private:
+    static constexpr std::size_t k_record_words =
+        sizeof(Message_trace_record) / sizeof(std::uint64_t);
+
+    struct Entry {
+        /// \brief Odd while the entry is written, 2 * (position + 1) once written
+        std::atomic<std::uint64_t> sequence{0U};
+        std::array<std::atomic<std::uint64_t>, k_record_words> words{};
+    };
+
+    /// \brief Ring of a single writing thread
+    class Ring {
+       public:
+        explicit Ring(std::size_t capacity) : m_entries(capacity) {}
+
+        void push(Message_trace_record const& record) noexcept;
+
+        void append_to(Message_trace_records& records) const;
+
+       private:
+        std::vector<Entry> m_entries;
+        std::atomic<std::uint64_t> m_head{0U};
+    };
+
+    /// \brief Pushes a record for each entry of a batch, based on the record of the batch
+    template <typename Entries>
+    static void push_entries(Ring& ring, Message_trace_record const& batch_record,
+                             Entries const& entries) noexcept;
+
+    /// \return The ring of the calling thread, created on its first call
+    Ring* get_ring();
+
+    std::size_t const m_capacity;
+    /// \brief Identifies this recorder in the ring cache of each thread
+    std::uint64_t const m_id;
+    mutable std::mutex m_mutex;
+    std::unordered_map<std::thread::id, std::unique_ptr<Ring>> m_rings;
+};
+
+}  // namespace score::gateway_ipc_binding
+
+#endif  // SRC_GATEWAY_IPC_BINDING_SRC_MESSAGE_TRACE_RECORDER
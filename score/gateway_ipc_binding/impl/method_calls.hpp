@@ -0,0 +1,242 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SRC_GATEWAY_IPC_BINDING_SRC_METHOD_CALLS
+#define SRC_GATEWAY_IPC_BINDING_SRC_METHOD_CALLS
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "gateway_ipc_binding_util.hpp"
+#include "key.hpp"
+#include "score/gateway_ipc_binding/gateway_ipc_binding_server.hpp"
+#include "score/socom/method.hpp"
+
+namespace score::gateway_ipc_binding {
+
+/// \brief Method calls sent to a peer which wait for its Call_method_reply
+///
+/// Invocation ids are unique per binding, so a reply is found in O(1) by its id alone. Thread-safe,
+/// replies of different services are handled under different stripes of the binding.
+class Pending_method_calls {
+   public:
+    struct Pending_method_call {
+        Client_id client_id;
+        Key_t key;
+        Remote_handle provided_id;
+        Remote_handle required_id;
+        Method_id method_id;
+        /// \brief std::nullopt for fire and forget calls
+        socom::Method_call_reply_data_opt reply_data;
+    };
+
+    Method_invocation add(Pending_method_call call) {
+        std::lock_guard<std::mutex> const lock{m_mutex};
+        auto const invocation_id = m_next_invocation_id.get_next_id();
+        m_calls.emplace(invocation_id, std::move(call));
+        return invocation_id;
+    }
+
+    std::optional<Pending_method_call> take(Method_invocation invocation_id) noexcept {
+        std::lock_guard<std::mutex> const lock{m_mutex};
+        auto it = m_calls.find(invocation_id);
+        if (it == m_calls.end()) {
+            return std::nullopt;
+        }
+        return take(it);
+    }
+
+    /// \brief Removes the call invocation_id if it was sent to client_id
+    std::optional<Pending_method_call> take(Client_id client_id,
+                                            Method_invocation invocation_id) noexcept {
+        std::lock_guard<std::mutex> const lock{m_mutex};
+        auto it = m_calls.find(invocation_id);
+        if (it == m_calls.end() || it->second.client_id != client_id) {
+            return std::nullopt;
+        }
+        return take(it);
+    }
+
+    /// \brief Removes all calls for which checker returns true
+    template <typename Value_checker>
+    std::vector<Pending_method_call> take_if(Value_checker checker) {
+        std::lock_guard<std::mutex> const lock{m_mutex};
+        std::vector<Pending_method_call> taken;
+        for (auto it = m_calls.begin(); it != m_calls.end();) {
+            if (checker(it->second)) {
+                taken.push_back(std::move(it->second));
+                it = m_calls.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        return taken;
+    }
+
+   private:
+    using Calls = std::unordered_map<Method_invocation, Pending_method_call>;
+
+    Pending_method_call take(Calls::iterator it) noexcept {
+        auto call = std::move(it->second);
+        m_calls.erase(it);
+        return call;
+    }
+
+    std::mutex m_mutex;
+    Id_generator<Method_invocation> m_next_invocation_id{1};
+    Calls m_calls;
+};
+
+/// \brief Method calls received from peers which are executed by a local service
+///
+/// An entry is added before the local service is called, so a reply given during the call finds
+/// it. The socom invocation is stored afterwards, unless the call already finished. Thread-safe,
+/// like Pending_method_calls.
+class Active_method_calls {
+   public:
+    struct Active_method_call {
+        Key_t key;
+        Remote_handle required_id;
+        socom::Method_invocation::Uptr invocation;
+    };
+
+    void add(Client_id client_id, Method_invocation invocation_id, Key_t const& key,
+             Remote_handle required_id) {
+        std::lock_guard<std::mutex> const lock{m_mutex};
+        m_calls.insert_or_assign(Id{client_id, invocation_id},
+                                 Active_method_call{key, required_id, nullptr});
+    }
+
+    /// \brief Stores the invocation returned by the local service
+    /// \return invocation if the call already finished, the caller has to destroy it
+    socom::Method_invocation::Uptr set_invocation(Client_id client_id,
+                                                  Method_invocation invocation_id,
+                                                  socom::Method_invocation::Uptr invocation) {
+        std::lock_guard<std::mutex> const lock{m_mutex};
+        auto it = m_calls.find(Id{client_id, invocation_id});
+        if (it == m_calls.end()) {
+            return invocation;
+        }
+        it->second.invocation = std::move(invocation);
+        return nullptr;
+    }
+
+    std::optional<Active_method_call> take(Client_id client_id,
+                                           Method_invocation invocation_id) noexcept {
+        std::lock_guard<std::mutex> const lock{m_mutex};
+        auto it = m_calls.find(Id{client_id, invocation_id});
+        if (it == m_calls.end()) {
+            return std::nullopt;
+        }
+
+        auto call = std::move(it->second);
+        m_calls.erase(it);
+        return call;
+    }
+
+    /// \brief Removes all calls for which checker, called with client id and call, returns true
+    /// \return Invocations of the removed calls, destroying them cancels the calls
+    template <typename Value_checker>
+    std::vector<socom::Method_invocation::Uptr> take_if(Value_checker checker) {
+        std::lock_guard<std::mutex> const lock{m_mutex};
+        std::vector<socom::Method_invocation::Uptr> taken;
+        for (auto it = m_calls.begin(); it != m_calls.end();) {
+            if (checker(it->first.client_id, it->second)) {
+                taken.push_back(std::move(it->second.invocation));
+                it = m_calls.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        return taken;
+    }
+
+   private:
+    struct Id {
+        Client_id client_id;
+        Method_invocation invocation_id;
+
+        bool operator==(Id const& other) const noexcept {
+            return client_id == other.client_id && invocation_id == other.invocation_id;
+        }
+    };
+
+    struct Id_hash {
+        std::size_t operator()(Id const& id) const noexcept {
+            return std::hash<Client_id>{}(id.client_id) ^
+                   (std::hash<Method_invocation>{}(id.invocation_id) << 1U);
+        }
+    };
+
+    std::mutex m_mutex;
+    std::unordered_map<Id, Active_method_call, Id_hash> m_calls;
+};
+
+/// \brief Forwards the cancellation of method calls to the binding, as long as it exists
+///
+/// Invocations returned to local clients may outlive the binding, they share this object with it.
+class Method_call_canceller {
+   public:
+    using Cancel = std::function<void(Method_invocation)>;
+
+    explicit Method_call_canceller(Cancel cancel) : m_cancel(std::move(cancel)) {}
+
+    void cancel(Method_invocation invocation_id) {
+        // Shared, cancellations must not wait for each other while the binding is locked
+        std::shared_lock<std::shared_mutex> const lock{m_mutex};
+        if (m_cancel) {
+            m_cancel(invocation_id);
+        }
+    }
+
+    /// \brief Stops forwarding, waits for cancellations in progress
+    void detach() {
+        std::unique_lock<std::shared_mutex> const lock{m_mutex};
+        m_cancel = nullptr;
+    }
+
+   private:
+    std::shared_mutex m_mutex;
+    Cancel m_cancel;
+};
+
+/// \brief Method invocation handed to a local client for a call forwarded to a peer
+///
+/// Destroying it cancels the call if it is still pending.
+class Forwarded_method_invocation final : public socom::Method_invocation {
+   public:
+    Forwarded_method_invocation(std::shared_ptr<Method_call_canceller> canceller,
+                                gateway_ipc_binding::Method_invocation invocation_id) noexcept
+        : m_canceller(std::move(canceller)), m_invocation_id(invocation_id) {}
+
+    ~Forwarded_method_invocation() override { m_canceller->cancel(m_invocation_id); }
+
+    Forwarded_method_invocation(Forwarded_method_invocation const&) = delete;
+    Forwarded_method_invocation(Forwarded_method_invocation&&) = delete;
+    Forwarded_method_invocation& operator=(Forwarded_method_invocation const&) = delete;
+    Forwarded_method_invocation& operator=(Forwarded_method_invocation&&) = delete;
+
+   private:
+    std::shared_ptr<Method_call_canceller> m_canceller;
+    gateway_ipc_binding::Method_invocation m_invocation_id;
+};
+
+}  // namespace score::gateway_ipc_binding
+
+#endif  // SRC_GATEWAY_IPC_BINDING_SRC_METHOD_CALLS
@@ -0,0 +1,83 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SRC_GATEWAY_IPC_BINDING_SRC_PEER_SERVICE_KEYS
+#define SRC_GATEWAY_IPC_BINDING_SRC_PEER_SERVICE_KEYS
+
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "key.hpp"
+#include "score/gateway_ipc_binding/gateway_ipc_binding.hpp"
+#include "score/gateway_ipc_binding/gateway_ipc_binding_server.hpp"
+
+namespace score::gateway_ipc_binding {
+
+/// \brief Service keys exchanged with each peer
+///
+/// Both sides declare their own Key_t of a service instance to a peer once with Declare_service,
+/// before the first message referring to it. Afterwards, Request_service, Offer_service and
+/// Connect_service only carry the numeric key, which is translated back to the local key here.
+/// The exchanged keys are valid as long as the connection to the peer.
+class Peer_service_keys {
+   public:
+    /// \brief Marks key as declared to client_id
+    /// \return true if key has not been declared to client_id before
+    bool mark_declared(Client_id client_id, Key_t key) {
+        auto& declared = m_peers[client_id].declared;
+        if (key < declared.size() && declared[key]) {
+            return false;
+        }
+
+        if (key >= declared.size()) {
+            declared.resize(key + 1U, false);
+        }
+        declared[key] = true;
+        return true;
+    }
+
+    /// \brief Stores the local key of a service instance declared by client_id
+    void add_remote(Client_id client_id, Service_key remote_key, Key_t key) {
+        m_peers[client_id].remote_keys.insert_or_assign(remote_key, key);
+    }
+
+    /// \return The local key of a service instance declared by client_id as remote_key
+    std::optional<Key_t> find_remote(Client_id client_id, Service_key remote_key) const noexcept {
+        auto const peer = m_peers.find(client_id);
+        if (peer == m_peers.end()) {
+            return std::nullopt;
+        }
+
+        auto const key = peer->second.remote_keys.find(remote_key);
+        if (key == peer->second.remote_keys.end()) {
+            return std::nullopt;
+        }
+        return key->second;
+    }
+
+    void remove_client(Client_id client_id) noexcept { m_peers.erase(client_id); }
+
+   private:
+    struct Peer {
+        /// \brief Indexed by local Key_t
+        std::vector<bool> declared;
+        std::unordered_map<Service_key, Key_t> remote_keys;
+    };
+
+    std::unordered_map<Client_id, Peer> m_peers;
+};
+
+}  // namespace score::gateway_ipc_binding
+
+#endif  // SRC_GATEWAY_IPC_BINDING_SRC_PEER_SERVICE_KEYS
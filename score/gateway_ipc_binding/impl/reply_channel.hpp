@@ -16,7 +16,9 @@
 
 #include <cstdint>
 #include <score/span.hpp>
+#include <vector>
 
+#include "message_trace_recorder.hpp"
 #include "score/result/result.h"
 
 namespace score::gateway_ipc_binding {
@@ -26,10 +28,15 @@ class Reply_channel {
     /// \brief Virtual destructor
     virtual ~Reply_channel() = default;
 
-    /// \brief Send a message through this connection
+    /// \brief Send a message through this connection, recorded in the message trace if set
     /// \param data Message payload to send
     /// \return Success or error
-    virtual Result<void> send(score::cpp::span<std::uint8_t const> data) noexcept = 0;
+    Result<void> send(score::cpp::span<std::uint8_t const> data) noexcept {
+        if (m_message_trace != nullptr) {
+            m_message_trace->record(m_trace_client_id, Message_direction::sent, data);
+        }
+        return send_frame(data);
+    }
 
     /// \brief Send a message through this connection
     /// \param msg Message to send
@@ -42,12 +49,38 @@ class Reply_channel {
             reinterpret_cast<std::uint8_t const*>(&msg), sizeof(Msg_frame)));
     }
 
+    /// \brief Returns true if the peer offered a data ring in Connect which could be opened
+    virtual bool has_data_ring() const noexcept { return false; }
+
+    /// \brief Sends all further messages through the data ring, called after Connect_reply
+    virtual void activate_data_ring() noexcept {}
+
+    /// \brief Send a message of variable length, e.g. a Compact_frame, through this connection
+    /// \param frame Message to send, including framing
+    /// \return Success or error
+    Result<void> send(std::vector<std::uint8_t> const& frame) noexcept {
+        return send(score::cpp::span<std::uint8_t const>(frame.data(), frame.size()));
+    }
+
+    /// \brief Records all further messages sent through this connection as sent to client_id
+    void set_message_trace(Message_trace_recorder& recorder, Client_id client_id) noexcept {
+        m_message_trace = &recorder;
+        m_trace_client_id = client_id;
+    }
+
    protected:
     Reply_channel() = default;
     Reply_channel(Reply_channel const&) = delete;
     Reply_channel& operator=(Reply_channel const&) = delete;
     Reply_channel(Reply_channel&&) = delete;
     Reply_channel& operator=(Reply_channel&&) = delete;
+
+    /// \brief Sends a message, without recording it
+    virtual Result<void> send_frame(score::cpp::span<std::uint8_t const> data) noexcept = 0;
+
+   private:
+    Message_trace_recorder* m_message_trace{nullptr};
+    Client_id m_trace_client_id{0U};
 };
 
 }  // namespace score::gateway_ipc_binding
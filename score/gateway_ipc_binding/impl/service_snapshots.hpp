@@ -0,0 +1,77 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SRC_GATEWAY_IPC_BINDING_SRC_SERVICE_SNAPSHOTS
+#define SRC_GATEWAY_IPC_BINDING_SRC_SERVICE_SNAPSHOTS
+
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "key.hpp"
+#include "score/gateway_ipc_binding/gateway_ipc_binding_server.hpp"
+
+namespace score::gateway_ipc_binding {
+
+/// \brief Service_snapshot exchange with each peer
+///
+/// Each side sends its snapshot once per connection. A received snapshot may span several
+/// messages, its entries are collected until the message with complete set arrived.
+class Service_snapshots {
+   public:
+    /// \brief Service instance of a received snapshot, by local key
+    struct Entry {
+        Key_t key;
+        bool requested;
+        bool offered;
+    };
+
+    /// \brief Marks the snapshot as sent to client_id
+    /// \return true if no snapshot has been sent to client_id before
+    bool mark_sent(Client_id client_id) {
+        auto& sent = m_peers[client_id].sent;
+        return !std::exchange(sent, true);
+    }
+
+    bool is_sent(Client_id client_id) const noexcept {
+        auto const peer = m_peers.find(client_id);
+        return peer != m_peers.end() && peer->second.sent;
+    }
+
+    void add_received(Client_id client_id, Entry const& entry) {
+        m_peers[client_id].received.push_back(entry);
+    }
+
+    /// \return All entries received from client_id so far, which are removed
+    std::vector<Entry> take_received(Client_id client_id) {
+        auto const peer = m_peers.find(client_id);
+        if (peer == m_peers.end()) {
+            return {};
+        }
+        return std::exchange(peer->second.received, {});
+    }
+
+    void remove_client(Client_id client_id) noexcept { m_peers.erase(client_id); }
+
+   private:
+    struct Peer {
+        bool sent{false};
+        std::vector<Entry> received;
+    };
+
+    std::unordered_map<Client_id, Peer> m_peers;
+};
+
+}  // namespace score::gateway_ipc_binding
+
+#endif  // SRC_GATEWAY_IPC_BINDING_SRC_SERVICE_SNAPSHOTS
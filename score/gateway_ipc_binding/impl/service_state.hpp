@@ -16,6 +16,8 @@
 
 #include <cassert>
 #include <cerrno>
+#include <memory>
+#include <optional>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -61,9 +63,11 @@ struct Service_state {
     Service_counts counts{};
     bool requested{false};
     std::unordered_map<Client_id, Offer_state> offers;
-    score::socom::Client_connector::Uptr client_connector{};
+    // Shared with workers calling methods of the service outside of the binding lock
+    std::shared_ptr<score::socom::Client_connector> client_connector{};
     bool client_connector_pending{false};
-    score::socom::Enabled_server_connector::Uptr enabled_connector{};
+    // Shared with workers updating events of the service outside of the binding lock
+    std::shared_ptr<score::socom::Enabled_server_connector> enabled_connector{};
     Event_subscribers event_subscriptions;
 
     Service_state(socom::Service_interface_identifier service, socom::Service_instance instance)
@@ -74,7 +78,7 @@ struct Service_state {
         Id_generator<Remote_handle>& next_local_id, Keys& keys,
         Shared_memory_managers& slot_managers,
         std::function<bool(Client_id const&, Remote_handle const& remote_handle,
-                           Message_frame<Connect_service>&)>
+                           Connect_service const&)>
             send_func) {
         if (!requested) {
             return;
@@ -92,15 +96,12 @@ struct Service_state {
                     offer.required_id = next_local_id.get_next_id();
                 }
 
-                Message_frame<Connect_service> msg;
-                msg.payload.service_id = make_service(service);
-                auto result = fixed_string_from_string<Instance_id>(instance.id.string_view());
-                assert(result && "String exceeds maximum size for fixed string");
-                msg.payload.instance_id = *result;
-                msg.payload.required_id = offer.required_id;
-                msg.payload.metadata =
-                    slot_managers.get_shared_memory_metadata(keys.get(service, instance));
-                msg.payload.in_use = true;
+                auto const key = keys.get(service, instance);
+                Connect_service msg{};
+                msg.service_key = static_cast<Service_key>(key);
+                msg.required_id = offer.required_id;
+                msg.metadata = slot_managers.get_shared_memory_metadata(key);
+                msg.in_use = true;
                 auto const send_result = send_func(client_id, offer.required_id, msg);
                 if (send_result) {
                     // Keep connect_sent=false so a later reconnect can retry this handshake.
@@ -155,13 +156,14 @@ struct Service_state {
 
 class Service_states {
    public:
-    using Service_state_map = std::unordered_map<Key_t, Service_state>;
+    /// \brief Indexed by key, references stay valid until the state of their key is removed
+    using Service_state_map = Key_map<std::optional<Service_state>>;
 
     // Used for delayed destruction of Enabled_server_connector
     template <typename T>
     struct Delayed_destruction {
         T service_state;
-        score::socom::Enabled_server_connector::Uptr connector;
+        std::shared_ptr<score::socom::Enabled_server_connector> connector;
     };
 
     Service_state& add_service(Key_t const& key, Service const& interface,
@@ -175,12 +177,13 @@ class Service_states {
         return insert_result;
     }
 
-    Delayed_destruction<Service_state&> process_offer(Key_t const& key, Client_id const& client_id,
-                                                      Offer_service const& msg) {
-        auto& state = get_or_create(key, msg.service_id, msg.instance_id);
+    Delayed_destruction<Service_state&> process_offer(Key_t const& key, Service const& interface,
+                                                      Instance_id const& instance,
+                                                      Client_id const& client_id, bool offered) {
+        auto& state = get_or_create(key, interface, instance);
 
         Delayed_destruction<Service_state&> result{state, nullptr};
-        if (!msg.offered) {
+        if (!offered) {
             state.offers.erase(client_id);
             result.connector = std::move(state.enabled_connector);
         } else {
@@ -193,21 +196,20 @@ class Service_states {
     Delayed_destruction<std::optional<std::reference_wrapper<Service_state>>>
     process_request_service(Key_t const& key,
                             socom::Service_interface_definition const& configuration,
-                            Request_service const& msg) {
+                            Service const& interface, Instance_id const& instance, bool in_use) {
         Delayed_destruction<std::optional<std::reference_wrapper<Service_state>>> result{
             std::nullopt, nullptr};
-        auto& state = get_or_create(key, msg.service_id, msg.instance_id);
+        auto& state = get_or_create(key, interface, instance);
 
-        if (!msg.in_use) {
+        if (!in_use) {
             result.connector = std::move(state.enabled_connector);
             state.client_connector_pending = false;
-            m_service_states.erase(key);
+            m_service_states[key].reset();
             return result;
         }
 
-        assert(msg.in_use);
         state.counts = {configuration.num_methods, configuration.num_events};
-        state.requested = msg.in_use;
+        state.requested = true;
         result.service_state = state;
         return result;
     }
@@ -246,7 +248,7 @@ class Service_states {
         state_ref->get().client_connector_pending = false;
     }
 
-    socom::Client_connector::Uptr remove_client_connector(Key_t const& key) {
+    std::shared_ptr<socom::Client_connector> remove_client_connector(Key_t const& key) {
         auto state_ref = get(key);
         if (!state_ref) {
             return nullptr;
@@ -257,56 +259,48 @@ class Service_states {
         return std::move(state.client_connector);
     }
 
-    std::vector<score::socom::Enabled_server_connector::Uptr> remove_offers(
+    std::vector<std::shared_ptr<score::socom::Enabled_server_connector>> remove_offers(
         Client_id const& client_id) {
-        std::vector<score::socom::Enabled_server_connector::Uptr> removed_connectors;
+        std::vector<std::shared_ptr<score::socom::Enabled_server_connector>> removed_connectors;
 
-        for (auto& [key, state] : m_service_states) {
-            (void)key;
-            if (state.offers.erase(client_id) == 0U) {
-                continue;
-            }
-
-            if (!state.offers.empty()) {
-                continue;
+        for_each([client_id, &removed_connectors](Key_t const&, Service_state& state) {
+            if (state.offers.erase(client_id) == 0U || !state.offers.empty()) {
+                return;
             }
 
             state.event_subscriptions.clear();
             if (state.enabled_connector != nullptr) {
                 removed_connectors.push_back(std::move(state.enabled_connector));
             }
-        }
+        });
 
         return removed_connectors;
     }
 
-    std::vector<score::socom::Client_connector::Uptr> release_client_connectors() {
-        std::vector<score::socom::Client_connector::Uptr> released_connectors;
-        released_connectors.reserve(m_service_states.size());
-
-        for (auto& [key, state] : m_service_states) {
-            (void)key;
+    std::vector<std::shared_ptr<score::socom::Client_connector>> release_client_connectors() {
+        std::vector<std::shared_ptr<score::socom::Client_connector>> released_connectors;
+        for_each([&released_connectors](Key_t const&, Service_state& state) {
             state.client_connector_pending = false;
             if (state.client_connector != nullptr) {
                 released_connectors.push_back(std::move(state.client_connector));
             }
-        }
+        });
 
         return released_connectors;
     }
 
     std::optional<std::reference_wrapper<Service_state const>> get(Key_t const& key) const {
-        auto it = m_service_states.find(key);
-        if (it != m_service_states.end()) {
-            return std::cref(it->second);
+        auto const* const state = m_service_states.find(key);
+        if (state != nullptr && state->has_value()) {
+            return std::cref(**state);
         }
         return std::nullopt;
     }
 
     std::optional<std::reference_wrapper<Service_state>> get(Key_t const& key) {
-        auto it = m_service_states.find(key);
-        if (it != m_service_states.end()) {
-            return std::ref(it->second);
+        auto* const state = m_service_states.find(key);
+        if (state != nullptr && state->has_value()) {
+            return std::ref(**state);
         }
         return std::nullopt;
     }
@@ -322,10 +316,13 @@ class Service_states {
                (state->get().client_connector_pending || state->get().client_connector != nullptr);
     }
 
-    void for_each(std::function<void(Key_t const&, Service_state&)> func) {
-        for (auto& entry : m_service_states) {
-            func(entry.first, entry.second);
-        }
+    template <typename Function>
+    void for_each(Function&& func) {
+        m_service_states.for_each([&func](Key_t const& key, std::optional<Service_state>& state) {
+            if (state.has_value()) {
+                func(key, *state);
+            }
+        });
     }
 
     void update_event_subscription(Key_t const& key, Event_subscription_endpoint const& endpoint,
@@ -365,10 +362,9 @@ class Service_states {
     }
 
     void remove_event_subscriptions_for_client(Client_id client_id) {
-        for (auto& [key, state] : m_service_states) {
-            (void)key;
+        for_each([client_id](Key_t const&, Service_state& state) {
             state.remove_event_subscriptions(client_id, state.client_connector.get());
-        }
+        });
     }
 
     void remove_event_subscriptions_for_connection(Key_t const& key, Client_id client_id,
@@ -393,10 +389,12 @@ class Service_states {
    private:
     Service_state& get_or_create(Key_t const& key, Service const& interface,
                                  Instance_id const& instance) {
-        auto const insert_result = m_service_states.emplace(
-            key, Service_state{interface.to_socom_identifier(),
-                               socom::Service_instance{fixed_string_to_string(instance)}});
-        return insert_result.first->second;
+        auto& state = m_service_states[key];
+        if (!state.has_value()) {
+            state.emplace(interface.to_socom_identifier(),
+                          socom::Service_instance{fixed_string_to_string(instance)});
+        }
+        return *state;
     }
 
     Service_state_map m_service_states;
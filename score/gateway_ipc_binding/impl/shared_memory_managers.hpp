@@ -15,35 +15,211 @@
 #define SRC_GATEWAY_IPC_BINDING_SRC_SHARED_MEMORY_MANAGERS
 
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <new>
 #include <optional>
+#include <shared_mutex>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
+#include "gateway_ipc_binding_util.hpp"
 #include "key.hpp"
 #include "score/gateway_ipc_binding/gateway_ipc_binding.hpp"
 #include "score/gateway_ipc_binding/shared_memory_slot_manager.hpp"
+#include "shared_memory_payload.hpp"
 
 namespace score::gateway_ipc_binding {
+
+/// \brief Payloads kept for peer consumers, one entry per slot of a shared memory
+///
+/// Sized once for all slots, so keeping and releasing a payload never allocates. The counters of
+/// pending consumers are stored densely apart from the payloads, which are only touched when a
+/// slot is first kept and when it is finally released. A slot keeps a payload while it has
+/// pending consumers.
+///
+/// Not thread-safe.
+class Slot_allocations {
+   public:
+    Slot_allocations() = default;
+
+    Slot_allocations(Slot_allocations const&) = delete;
+    Slot_allocations& operator=(Slot_allocations const&) = delete;
+
+    ~Slot_allocations() {
+        for (Slot_handle handle = 0U; handle < m_slot_count; ++handle) {
+            if (m_pending_consumers[handle] != 0U) {
+                get_payload(handle).~Payload();
+            }
+        }
+    }
+
+    /// \brief Creates the entries of slot_count slots, has to be called once before any other call
+    void create(std::size_t slot_count) {
+        assert(m_slot_count == 0U && "Slot allocations should only be created once");
+        m_pending_consumers = std::make_unique<std::uint32_t[]>(slot_count);
+        m_payloads = std::make_unique<Payload_storage[]>(slot_count);
+        m_slot_count = slot_count;
+    }
+
+    std::size_t size() const noexcept { return m_slot_count; }
+
+    /// \return true if handle keeps a payload
+    bool is_kept(Slot_handle handle) const noexcept {
+        return handle < m_slot_count && m_pending_consumers[handle] != 0U;
+    }
+
+    /// \brief Keeps payload for consumer_count more consumers
+    ///
+    /// A slot which already keeps a payload keeps the new one instead. The consumers still pending
+    /// for the old payload read the same slot, they stay pending.
+    /// \return The replaced payload, the caller has to destroy it
+    std::optional<socom::Payload> keep(Slot_handle handle, socom::Payload payload,
+                                       std::size_t consumer_count) noexcept {
+        assert(handle < m_slot_count && "Kept payload should be located in the shared memory");
+        if (handle >= m_slot_count || consumer_count == 0U) {
+            return std::nullopt;
+        }
+
+        std::optional<socom::Payload> replaced;
+        if (m_pending_consumers[handle] == 0U) {
+            new (&m_payloads[handle]) socom::Payload{std::move(payload)};
+        } else {
+            replaced = std::exchange(get_payload(handle), std::move(payload));
+        }
+        m_pending_consumers[handle] += static_cast<std::uint32_t>(consumer_count);
+        return replaced;
+    }
+
+    /// \brief Counts one pending consumer of handle as done
+    /// \return The payload of handle once no consumer is pending anymore
+    std::optional<socom::Payload> consume(Slot_handle handle) noexcept {
+        if (!is_kept(handle)) {
+            return std::nullopt;
+        }
+        if (m_pending_consumers[handle] > 1U) {
+            --m_pending_consumers[handle];
+            return std::nullopt;
+        }
+        return release(handle);
+    }
+
+    /// \brief Stops keeping the payload of handle, regardless of pending consumers
+    /// \return The payload of handle, if it kept one
+    std::optional<socom::Payload> release(Slot_handle handle) noexcept {
+        if (!is_kept(handle)) {
+            return std::nullopt;
+        }
+        auto& payload = get_payload(handle);
+        std::optional<socom::Payload> released{std::move(payload)};
+        payload.~Payload();
+        m_pending_consumers[handle] = 0U;
+        return released;
+    }
+
+   private:
+    struct alignas(socom::Payload) Payload_storage {
+        std::byte bytes[sizeof(socom::Payload)];
+    };
+
+    socom::Payload& get_payload(Slot_handle handle) noexcept {
+        return *std::launder(reinterpret_cast<socom::Payload*>(&m_payloads[handle]));
+    }
+
+    std::size_t m_slot_count{0U};
+    std::unique_ptr<std::uint32_t[]> m_pending_consumers;
+    std::unique_ptr<Payload_storage[]> m_payloads;
+};
+
+/// \brief Shared memory slot managers and the payloads kept for peers, per service instance
+///
+/// Thread-safe. Calls for the same key have to be serialized by the caller where noted.
 class Shared_memory_managers {
     Shared_memory_manager_factory::Sptr m_slot_manager_factory;
     Keys* m_keys;
 
-    struct Shared_memory_allocation {
-        std::optional<socom::Payload> payload;
-        std::size_t pending_consumers{0U};
+    struct Key_state {
+        /// \brief Set once, when the shared memory of the key is first used
+        Shared_memory_slot_manager::Uptr slot_manager;
+        std::mutex allocations_mutex;
+        /// \brief Sized together with slot_manager, empty before
+        Slot_allocations allocations;
     };
 
-    std::unordered_map<Key_t, Shared_memory_slot_manager::Uptr> m_slot_managers;
-    std::unordered_map<Key_t, std::vector<Shared_memory_allocation>> m_shared_memory_allocations;
+    // Protects the set of keys and the slot_manager pointers. Entries are never removed, so a
+    // Key_state stays valid after the lock is released.
+    mutable std::shared_mutex m_key_states_mutex;
+    Key_map<Key_state> m_key_states;
+
+    Key_state* find_key_state(Key_t const& key) noexcept {
+        std::shared_lock<std::shared_mutex> const lock{m_key_states_mutex};
+        return m_key_states.find(key);
+    }
+
+    Shared_memory_slot_manager* find_slot_manager(Key_t const& key) const noexcept {
+        std::shared_lock<std::shared_mutex> const lock{m_key_states_mutex};
+        auto const* const state = m_key_states.find(key);
+        return state == nullptr ? nullptr : state->slot_manager.get();
+    }
+
+    Shared_memory_slot_manager* find_slot_manager_with_consumer_counts(Key_t const& key) noexcept {
+        auto* const slot_manager = find_slot_manager(key);
+        if (slot_manager == nullptr || slot_manager->get_consumer_release() !=
+                                           Consumer_release::shared_memory_consumer_count) {
+            return nullptr;
+        }
+        return slot_manager;
+    }
+
+    static Result<Shared_memory_slot_guard> allocate_slot(Shared_memory_slot_manager& slot_manager,
+                                                          Event_id event_id) noexcept {
+        auto const event_slot_sizes = slot_manager.get_event_slot_sizes();
+        if (event_id < event_slot_sizes.size && event_slot_sizes.data[event_id] != 0U) {
+            return slot_manager.allocate_slot(event_slot_sizes.data[event_id]);
+        }
+        return slot_manager.allocate_slot();
+    }
+
+    /// \brief Takes another reference to the slot of slot_manager holding payload, if any
+    static std::optional<socom::Payload> share_slot(Shared_memory_slot_manager& slot_manager,
+                                                    socom::Payload const& payload) noexcept {
+        auto const handle = payload.get_slot_handle();
+        if (handle == socom::kNoSlotHandle) {
+            return std::nullopt;
+        }
+
+        auto const memory = slot_manager.get_memory(handle);
+        if (!memory || memory->data() != payload.data().data() ||
+            !slot_manager.add_consumer(handle)) {
+            return std::nullopt;
+        }
+
+        return socom::Payload{*memory, handle, [&slot_manager, handle]() {
+                                  static_cast<void>(slot_manager.release_slot(handle));
+                              }};
+    }
 
    public:
     Shared_memory_managers(Shared_memory_manager_factory::Sptr slot_manager_factory, Keys& keys)
         : m_slot_manager_factory(std::move(slot_manager_factory)), m_keys(&keys) {}
 
+    /// \brief Returns the slot manager of key, creating it on first use
+    ///
+    /// Creating a slot manager reads the service and instance of key, so the caller has to keep
+    /// the Keys from being modified concurrently.
     Shared_memory_slot_manager& get_shared_memory_slot_manager(Key_t const& key) noexcept {
-        auto it = m_slot_managers.find(key);
-        if (it != m_slot_managers.end()) {
-            return *(it->second);
+        if (auto* const slot_manager = find_slot_manager(key)) {
+            return *slot_manager;
+        }
+
+        std::unique_lock<std::shared_mutex> const lock{m_key_states_mutex};
+        auto& state = m_key_states[key];
+        if (state.slot_manager != nullptr) {
+            return *state.slot_manager;
         }
 
         auto const interface_instance_opt = m_keys->get(key);
@@ -55,9 +231,11 @@ class Shared_memory_managers {
             interface.get().to_socom_identifier(),
             socom::Service_instance{fixed_string_to_string(instance.get())});
         assert(slot_manager_result && "Failed to create shared memory slot manager");
-        auto& slot_manager = **slot_manager_result;
-        m_slot_managers.emplace(key, std::move(*slot_manager_result));
-        return slot_manager;
+        state.slot_manager = std::move(*slot_manager_result);
+        // Not yet visible to other threads, they only see the state with a slot manager
+        state.allocations.create(
+            total_slot_count(get_shared_memory_metadata(*state.slot_manager)));
+        return *state.slot_manager;
     }
 
     Shared_memory_metadata get_shared_memory_metadata(
@@ -66,7 +244,11 @@ class Shared_memory_managers {
         assert(result && "Path should fit into fixed-size metadata path");
 
         return Shared_memory_metadata{*result, slot_manager.get_slot_size(),
-                                      slot_manager.get_slot_count()};
+                                      slot_manager.get_slot_count(),
+                                      slot_manager.get_slot_classes(),
+                                      slot_manager.get_event_slot_sizes(),
+                                      slot_manager.get_consumer_release(),
+                                      slot_manager.get_conflated_events()};
     }
 
     Shared_memory_metadata get_shared_memory_metadata(Key_t const& key) noexcept {
@@ -74,55 +256,183 @@ class Shared_memory_managers {
         return get_shared_memory_metadata(slot_manager);
     }
 
-    void register_configuration(Shared_memory_configs const& configs) noexcept {
-        auto result = m_slot_manager_factory->register_configuration(configs);
-        assert(result && "Failed to register shared memory configuration");
+    /// \return true if peers acknowledge each consumed slot of key with Payload_consumed
+    bool is_consumption_acknowledged(Key_t const& key) const noexcept {
+        auto const* const slot_manager = find_slot_manager(key);
+        return slot_manager != nullptr &&
+               slot_manager->get_consumer_release() == Consumer_release::payload_consumed_message;
     }
 
-    void insert_allocation(Key_t const& key, socom::Payload payload, std::size_t consumer_count) {
-        if (consumer_count == 0U) {
-            return;
+    /// \return true if peers only get the latest update of event_id of key
+    bool is_conflated(Key_t const& key, Event_id event_id) const noexcept {
+        if (!is_consumption_acknowledged(key)) {
+            return false;
         }
 
-        auto& allocations = m_shared_memory_allocations[key];
-        auto const slot_handle = payload.get_slot_handle();
-        if (slot_handle >= allocations.size()) {
-            allocations.resize(slot_handle + 1);
+        auto const conflated_events = find_slot_manager(key)->get_conflated_events();
+        return event_id < conflated_events.size && conflated_events.data[event_id];
+    }
+
+    /// \brief Allocates a slot sized for the largest configured payload of event_id
+    ///
+    /// Events without a configured size get a slot of the default slot class. With
+    /// Consumer_release::shared_memory_consumer_count, slots consumed by all peers are reclaimed
+    /// lazily once no slot is available, so calls for the same key have to be serialized with
+    /// the sending of its payloads.
+    Result<Shared_memory_slot_guard> allocate_slot(Key_t const& key, Event_id event_id) noexcept {
+        auto& slot_manager = get_shared_memory_slot_manager(key);
+        auto result = allocate_slot(slot_manager, event_id);
+        if (!result && reclaim_consumed_allocations(key) > 0U) {
+            result = allocate_slot(slot_manager, event_id);
         }
-        auto& allocation = allocations[slot_handle];
-        if (!allocation.payload.has_value()) {
-            allocation.payload = std::move(payload);
+        return result;
+    }
+
+    /// \brief Allocates a slot of the default slot class, e.g. for a method call or reply
+    Result<Shared_memory_slot_guard> allocate_slot(Key_t const& key) noexcept {
+        auto& slot_manager = get_shared_memory_slot_manager(key);
+        auto result = slot_manager.allocate_slot();
+        if (!result && reclaim_consumed_allocations(key) > 0U) {
+            result = slot_manager.allocate_slot();
         }
-        allocation.pending_consumers += consumer_count;
+        return result;
     }
 
-    void payload_consumed(Key_t const& key, Payload_consumed const& msg) {
-        auto allocations_it = m_shared_memory_allocations.find(key);
-        if (allocations_it == m_shared_memory_allocations.end()) {
+    /// \brief Keeps payload available for one peer consumer until it is released
+    ///
+    /// A payload located in a slot of the shared memory of key is shared without copying, any other
+    /// payload is copied into a newly allocated slot. Empty payloads need no slot. If the returned
+    /// handle cannot be sent to the peer, consumer_lost() has to be called for it.
+    /// \return Handle for the peer, or an error if no slot is available for a copy
+    Result<Shared_memory_handle> share_payload(Key_t const& key,
+                                               socom::Payload const& payload) noexcept {
+        auto const data = payload.data();
+        if (data.empty()) {
+            return Shared_memory_handle{kNo_payload_slot, 0U};
+        }
+
+        auto& slot_manager = get_shared_memory_slot_manager(key);
+        auto shared = share_slot(slot_manager, payload);
+        if (!shared) {
+            auto guard = slot_manager.allocate_slot(data.size());
+            if (!guard && reclaim_consumed_allocations(key) > 0U) {
+                guard = slot_manager.allocate_slot(data.size());
+            }
+            if (!guard) {
+                return MakeUnexpected<Shared_memory_handle>(guard.error());
+            }
+            std::memcpy(guard->get_memory().data(), data.data(), data.size());
+            shared = make_shared_memory_writable_payload(std::move(*guard));
+        }
+
+        // Counted before the slot is kept, so a concurrent reclaim does not release it
+        auto const handle = shared->get_slot_handle();
+        add_peer_consumer(key, handle);
+        insert_allocation(key, std::move(*shared), 1U);
+        return Shared_memory_handle{handle, data.size()};
+    }
+
+    /// \brief Counts a peer consumer of a slot in shared memory before the slot is sent to it
+    ///
+    /// Does nothing unless the shared memory of key uses
+    /// Consumer_release::shared_memory_consumer_count.
+    void add_peer_consumer(Key_t const& key, Slot_handle handle) noexcept {
+        auto* const slot_manager = find_slot_manager_with_consumer_counts(key);
+        if (slot_manager != nullptr) {
+            auto result = slot_manager->add_peer_consumer(handle);
+            assert(result && "Failed to add peer consumer");
+            (void)result;
+        }
+    }
+
+    /// \brief Undoes add_peer_consumer for a slot that could not be sent to the peer
+    void remove_peer_consumer(Key_t const& key, Slot_handle handle) noexcept {
+        auto* const slot_manager = find_slot_manager_with_consumer_counts(key);
+        if (slot_manager != nullptr) {
+            static_cast<void>(slot_manager->remove_peer_consumer(handle));
+        }
+    }
+
+    /// \brief Releases the share of a peer which was counted as consumer but never got the slot
+    void consumer_lost(Key_t const& key, Slot_handle handle) noexcept {
+        if (find_slot_manager_with_consumer_counts(key) != nullptr) {
+            remove_peer_consumer(key, handle);
             return;
         }
 
-        auto& allocations = allocations_it->second;
-        auto const slot_handle = msg.handle.slot_index;
-        if (slot_handle >= allocations.size()) {
+        Payload_consumed msg{};
+        msg.handle.slot_index = handle;
+        payload_consumed(key, msg);
+    }
+
+    /// \brief Releases the allocations of key whose consumer count in shared memory reached zero
+    /// \return Number of released allocations
+    std::size_t reclaim_consumed_allocations(Key_t const& key) noexcept {
+        auto* const slot_manager = find_slot_manager_with_consumer_counts(key);
+        auto* const state = find_key_state(key);
+        if (slot_manager == nullptr || state == nullptr) {
+            return 0U;
+        }
+
+        // Destroyed after the lock is released, releasing a payload may call back into its owner
+        std::vector<socom::Payload> reclaimed;
+        std::lock_guard<std::mutex> const lock{state->allocations_mutex};
+        auto& allocations = state->allocations;
+        for (Slot_handle handle = 0; handle < allocations.size(); ++handle) {
+            if (allocations.is_kept(handle) &&
+                slot_manager->get_peer_consumer_count(handle) == 0U) {
+                reclaimed.push_back(std::move(*allocations.release(handle)));
+            }
+        }
+        return reclaimed.size();
+    }
+
+    void register_configuration(Shared_memory_configs const& configs) noexcept {
+        // Serialized with the creation of slot managers by the factory
+        std::unique_lock<std::shared_mutex> const lock{m_key_states_mutex};
+        auto result = m_slot_manager_factory->register_configuration(configs);
+        assert(result && "Failed to register shared memory configuration");
+    }
+
+    /// \brief Keeps payload until consumer_count peers consumed it
+    ///
+    /// Has to be called before the payload is sent, so that no release by a peer is missed.
+    void insert_allocation(Key_t const& key, socom::Payload payload, std::size_t consumer_count) {
+        if (consumer_count == 0U) {
             return;
         }
 
-        auto& allocation = allocations[slot_handle];
-        if (allocation.pending_consumers == 0U) {
+        // The payload is located in the shared memory of key, so its slot manager exists
+        auto* const state = find_key_state(key);
+        assert(state != nullptr && "Slot manager should exist for a kept payload");
+        if (state == nullptr) {
             return;
         }
-        if (allocation.pending_consumers > 1U) {
-            --allocation.pending_consumers;
+
+        auto const slot_handle = payload.get_slot_handle();
+        // Destroyed after the lock is released, releasing a payload may call back into its owner
+        std::optional<socom::Payload> replaced;
+        std::lock_guard<std::mutex> const lock{state->allocations_mutex};
+        replaced = state->allocations.keep(slot_handle, std::move(payload), consumer_count);
+    }
+
+    void payload_consumed(Key_t const& key, Payload_consumed const& msg) {
+        auto* const state = find_key_state(key);
+        if (state == nullptr) {
             return;
         }
 
-        allocation = Shared_memory_allocation{};
+        // Destroyed after the lock is released, releasing a payload may call back into its owner
+        std::optional<socom::Payload> released;
+        std::lock_guard<std::mutex> const lock{state->allocations_mutex};
+        released = state->allocations.consume(msg.handle.slot_index);
     }
 };
 
 class Read_only_memory_managers {
     Shared_memory_manager_factory::Sptr m_slot_manager_factory;
+    // Routes of different stripes open their slot managers concurrently
+    std::mutex m_mutex;
     std::unordered_map<Shared_memory_path, Read_only_shared_memory_slot_manager::Uptr,
                        Fixed_size_container_hash>
         m_read_only_slot_managers;
@@ -133,6 +443,7 @@ class Read_only_memory_managers {
 
     Read_only_shared_memory_slot_manager& get_read_only_shared_memory_slot_manager(
         Shared_memory_metadata const& metadata) noexcept {
+        std::lock_guard<std::mutex> const lock{m_mutex};
         auto it = m_read_only_slot_managers.find(metadata.path);
         if (it != m_read_only_slot_managers.end()) {
             return *(it->second);
@@ -13,9 +13,14 @@
 
 #include "score/gateway_ipc_binding/shared_memory_slot_manager.hpp"
 
+#include <algorithm>
+#include <array>
 #include <atomic>
 #include <cassert>
+#include <cstdint>
+#include <limits>
 #include <mutex>
+#include <new>
 #include <optional>
 #include <utility>
 
@@ -26,25 +31,254 @@ namespace score::gateway_ipc_binding {
 
 namespace {
 
+/// \brief Lock-free LIFO stack of free slot indices (Treiber stack)
+///
+/// The head packs the index of the top slot into the lower 32 bits and a modification tag into the
+/// upper 32 bits. The tag is incremented on every successful push and pop, so a head that was
+/// popped and pushed again in between a load and the following CAS is detected (ABA problem).
+/// All storage is allocated at construction time.
+class Free_slot_list {
+   public:
+    /// \brief Marks the end of the list
+    static constexpr std::uint32_t end_of_list = std::numeric_limits<std::uint32_t>::max();
+
+    /// \brief Creates a list holding the slots first to first+slot_count-1, with first on top
+    Free_slot_list(Slot_handle first, std::size_t slot_count)
+        : m_first(first), m_next(std::make_unique<std::atomic<std::uint32_t>[]>(slot_count)) {
+        assert(first + slot_count < end_of_list);
+        for (std::size_t i = 0; i < slot_count; ++i) {
+            auto const next =
+                i + 1 < slot_count ? static_cast<std::uint32_t>(first + i + 1) : end_of_list;
+            m_next[i].store(next, std::memory_order_relaxed);
+        }
+        m_head.store(pack(static_cast<std::uint32_t>(first), 0), std::memory_order_release);
+    }
+
+    /// \brief Removes the top slot from the list
+    /// \return Index of the removed slot, or std::nullopt if the list is empty
+    std::optional<std::uint32_t> pop() noexcept {
+        auto head = m_head.load(std::memory_order_acquire);
+        while (true) {
+            auto const index = index_of(head);
+            if (index == end_of_list) {
+                return std::nullopt;
+            }
+            // m_next[index] may be stale if another thread popped index concurrently, but then the
+            // tag has changed as well and the CAS fails.
+            auto const next = m_next[index - m_first].load(std::memory_order_relaxed);
+            if (m_head.compare_exchange_weak(head, pack(next, tag_of(head) + 1),
+                                             std::memory_order_acquire,
+                                             std::memory_order_acquire)) {
+                return index;
+            }
+        }
+    }
+
+    /// \brief Puts a slot on top of the list
+    void push(std::uint32_t index) noexcept {
+        auto head = m_head.load(std::memory_order_relaxed);
+        do {
+            m_next[index - m_first].store(index_of(head), std::memory_order_relaxed);
+        } while (!m_head.compare_exchange_weak(head, pack(index, tag_of(head) + 1),
+                                               std::memory_order_release,
+                                               std::memory_order_relaxed));
+    }
+
+   private:
+    static constexpr std::uint64_t pack(std::uint32_t index, std::uint32_t tag) noexcept {
+        return (static_cast<std::uint64_t>(tag) << 32U) | index;
+    }
+    static constexpr std::uint32_t index_of(std::uint64_t head) noexcept {
+        return static_cast<std::uint32_t>(head);
+    }
+    static constexpr std::uint32_t tag_of(std::uint64_t head) noexcept {
+        return static_cast<std::uint32_t>(head >> 32U);
+    }
+
+    Slot_handle m_first;
+    std::atomic<std::uint64_t> m_head{pack(end_of_list, 0)};
+    std::unique_ptr<std::atomic<std::uint32_t>[]> m_next;
+};
+
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free);
+
+/// \brief Consumer count of a slot, shared between processes
+using Consumer_count = std::atomic<std::uint32_t>;
+
+// Atomics used across processes must be address-free, which only holds for lock-free atomics
+static_assert(Consumer_count::is_always_lock_free);
+
+constexpr std::size_t align_to_slot_class(std::size_t offset) noexcept {
+    return (offset + kSlot_class_alignment - 1U) / kSlot_class_alignment * kSlot_class_alignment;
+}
+
+/// \brief Position of all slot classes within one shared memory
+///
+/// Computed identically by the writer and the reader from Shared_memory_metadata.
+class Slot_layout {
+   public:
+    /// \brief Slot class together with its first handle and byte offset
+    struct Slot_class_range {
+        std::size_t slot_size;
+        std::size_t slot_count;
+        Slot_handle first_handle;
+        std::size_t offset;
+    };
+
+    /// \brief Validates the slot classes of metadata and computes their layout
+    static Result<Slot_layout> create(Shared_memory_metadata const& metadata) noexcept {
+        if (metadata.slot_classes.size > kMax_slot_classes) {
+            return MakeUnexpected(Shared_memory_manager_error::logic_error_invalid_slot_count);
+        }
+
+        Slot_layout layout;
+        std::size_t end{0U};
+        auto const add_class = [&layout, &end](Slot_class const& slot_class) -> Result<void> {
+            if (slot_class.slot_size == 0) {
+                return MakeUnexpected(Shared_memory_manager_error::logic_error_invalid_slot_size);
+            }
+            if (slot_class.slot_count == 0) {
+                return MakeUnexpected(Shared_memory_manager_error::logic_error_invalid_slot_count);
+            }
+            auto const offset = layout.m_class_count == 0 ? 0U : align_to_slot_class(end);
+            layout.m_classes[layout.m_class_count] = {slot_class.slot_size, slot_class.slot_count,
+                                                      layout.m_slot_count, offset};
+            ++layout.m_class_count;
+            layout.m_slot_count += slot_class.slot_count;
+            end = offset + slot_class.slot_size * slot_class.slot_count;
+            return {};
+        };
+
+        auto result = add_class({metadata.slot_size, metadata.slot_count});
+        for (std::size_t i = 0; result && i < metadata.slot_classes.size; ++i) {
+            result = add_class(metadata.slot_classes.data[i]);
+        }
+        if (!result) {
+            return MakeUnexpected<Slot_layout>(std::move(result).error());
+        }
+
+        if (metadata.consumer_release == Consumer_release::shared_memory_consumer_count) {
+            layout.m_consumer_count_offset = align_to_slot_class(end);
+            end = *layout.m_consumer_count_offset + layout.m_slot_count * sizeof(Consumer_count);
+        }
+
+        layout.m_total_size = end;
+        return layout;
+    }
+
+    std::size_t get_class_count() const noexcept { return m_class_count; }
+
+    Slot_class_range const& get_class(std::size_t index) const noexcept {
+        assert(index < m_class_count);
+        return m_classes[index];
+    }
+
+    std::size_t get_slot_count() const noexcept { return m_slot_count; }
+
+    std::size_t get_total_size() const noexcept { return m_total_size; }
+
+    /// \brief Returns the consumer counts within the shared memory at base_address
+    /// \return Consumer count per slot handle, or nullptr if the layout has no consumer counts
+    Consumer_count* get_consumer_counts(void* base_address) const noexcept {
+        if (!m_consumer_count_offset) {
+            return nullptr;
+        }
+        return reinterpret_cast<Consumer_count*>(static_cast<char*>(base_address) +
+                                                 *m_consumer_count_offset);
+    }
+
+    /// \brief Finds the class containing handle
+    /// \return The class, or nullptr if handle is out of range
+    Slot_class_range const* find_class(Slot_handle handle) const noexcept {
+        for (std::size_t i = 0; i < m_class_count; ++i) {
+            auto const& slot_class = m_classes[i];
+            if (handle < slot_class.first_handle + slot_class.slot_count) {
+                return &slot_class;
+            }
+        }
+        return nullptr;
+    }
+
+   private:
+    Slot_layout() = default;
+
+    std::array<Slot_class_range, kMax_slot_classes + 1> m_classes{};
+    std::size_t m_class_count{0U};
+    std::size_t m_slot_count{0U};
+    std::size_t m_total_size{0U};
+    std::optional<std::size_t> m_consumer_count_offset;
+};
+
+/// \brief Decrements a consumer count without wrapping below zero
+/// \return false if the count already was zero
+bool decrement_consumer_count(Consumer_count& count) noexcept {
+    std::uint32_t current = count.load(std::memory_order_relaxed);
+    do {
+        if (current == 0) {
+            return false;
+        }
+    } while (!count.compare_exchange_weak(current, current - 1, std::memory_order_release,
+                                          std::memory_order_relaxed));
+    return true;
+}
+
 class Shared_memory_slot_manager_impl final : public Shared_memory_slot_manager {
    public:
     Shared_memory_slot_manager_impl(
-        std::size_t slot_size, std::size_t slot_count,
+        Slot_layout const& layout, Shared_memory_metadata const& metadata,
         std::shared_ptr<score::memory::shared::ISharedMemoryResource> shared_memory,
-        void* base_address)
-        : m_slot_size(slot_size),
-          m_slot_count(slot_count),
+        void* base_address, Slot_allocation_strategy strategy)
+        : m_slot_size(metadata.slot_size),
+          m_slot_count(metadata.slot_count),
+          m_slot_classes(metadata.slot_classes),
+          m_event_slot_sizes(metadata.event_slot_sizes),
+          m_consumer_release(metadata.consumer_release),
+          m_conflated_events(metadata.conflated_events),
+          m_total_slot_count(layout.get_slot_count()),
+          m_class_count(layout.get_class_count()),
           m_shared_memory(std::move(shared_memory)),
-          m_base_address(base_address) {
+          m_base_address(base_address),
+          m_lock_free(strategy == Slot_allocation_strategy::lock_free_free_list) {
         assert(m_slot_size > 0);
         assert(m_slot_count > 0);
         assert(m_shared_memory != nullptr);
         assert(m_base_address != nullptr);
 
-        m_slots = std::make_unique<Slot_metadata[]>(m_slot_count);
-        for (std::size_t i = 0; i < m_slot_count; ++i) {
-            m_slots[i].reference_count.store(0, std::memory_order_relaxed);
-            m_slots[i].offset = i * m_slot_size;
+        m_event_slot_sizes.size = std::min(m_event_slot_sizes.size, kMax_event_slot_sizes);
+        m_conflated_events.size = std::min(m_conflated_events.size, kMax_conflated_events);
+
+        m_slots = std::make_unique<Slot_metadata[]>(m_total_slot_count);
+        for (std::size_t c = 0; c < m_class_count; ++c) {
+            auto const& slot_class = layout.get_class(c);
+            m_classes[c] = {slot_class.slot_size, slot_class.first_handle, slot_class.slot_count};
+            for (std::size_t i = 0; i < slot_class.slot_count; ++i) {
+                auto& slot = m_slots[slot_class.first_handle + i];
+                slot.reference_count.store(0, std::memory_order_relaxed);
+                slot.offset = slot_class.offset + i * slot_class.slot_size;
+                slot.size = slot_class.slot_size;
+            }
+        }
+
+        // Allocation tries the classes from the smallest to the largest slot size
+        for (std::size_t c = 0; c < m_class_count; ++c) {
+            m_allocation_order[c] = c;
+        }
+        std::stable_sort(m_allocation_order.begin(), m_allocation_order.begin() + m_class_count,
+                         [this](std::size_t lhs, std::size_t rhs) {
+                             return m_classes[lhs].slot_size < m_classes[rhs].slot_size;
+                         });
+
+        if (m_lock_free) {
+            for (std::size_t c = 0; c < m_class_count; ++c) {
+                m_free_slots[c].emplace(m_classes[c].first_handle, m_classes[c].slot_count);
+            }
+        }
+
+        m_consumer_counts = layout.get_consumer_counts(m_base_address);
+        if (m_consumer_counts != nullptr) {
+            for (std::size_t i = 0; i < m_total_slot_count; ++i) {
+                new (&m_consumer_counts[i]) Consumer_count{0U};
+            }
         }
     }
 
@@ -53,24 +287,48 @@ class Shared_memory_slot_manager_impl final : public Shared_memory_slot_manager
     }
 
     Result<Shared_memory_slot_guard> allocate_slot() noexcept override {
-        std::lock_guard<std::mutex> lock(m_mutex);
+        return allocate_slot_from_class(0);
+    }
 
-        for (std::size_t i = 0; i < m_slot_count; ++i) {
-            std::uint32_t expected = 0;
-            if (m_slots[i].reference_count.compare_exchange_strong(
-                    expected, 1, std::memory_order_acquire, std::memory_order_relaxed)) {
-                return Shared_memory_slot_manager::create_slot_guard(*this, i);
+    Result<Shared_memory_slot_guard> allocate_slot(std::size_t size) noexcept override {
+        bool fitting_class_found{false};
+        for (std::size_t i = 0; i < m_class_count; ++i) {
+            auto const class_index = m_allocation_order[i];
+            if (m_classes[class_index].slot_size < size) {
+                continue;
+            }
+            fitting_class_found = true;
+            auto guard = allocate_slot_from_class(class_index);
+            if (guard) {
+                return guard;
             }
         }
 
+        if (!fitting_class_found) {
+            return MakeUnexpected(
+                Shared_memory_manager_error::logic_error_requested_size_too_large);
+        }
         return MakeUnexpected(Shared_memory_manager_error::runtime_error_no_available_slots);
     }
 
     Result<void> add_consumer(Slot_handle handle) noexcept override {
-        if (handle >= m_slot_count) {
+        if (handle >= m_total_slot_count) {
             return MakeUnexpected(Shared_memory_manager_error::logic_error_invalid_slot_handle);
         }
 
+        if (m_lock_free) {
+            auto& reference_count = m_slots[handle].reference_count;
+            std::uint32_t current = reference_count.load(std::memory_order_relaxed);
+            do {
+                if (current == 0) {
+                    return MakeUnexpected(
+                        Shared_memory_manager_error::runtime_error_slot_not_allocated);
+                }
+            } while (!reference_count.compare_exchange_weak(current, current + 1,
+                                                            std::memory_order_relaxed));
+            return {};
+        }
+
         std::lock_guard<std::mutex> lock(m_mutex);
 
         std::uint32_t current = m_slots[handle].reference_count.load(std::memory_order_acquire);
@@ -83,10 +341,27 @@ class Shared_memory_slot_manager_impl final : public Shared_memory_slot_manager
     }
 
     Result<void> release_slot(Slot_handle handle) noexcept override {
-        if (handle >= m_slot_count) {
+        if (handle >= m_total_slot_count) {
             return MakeUnexpected(Shared_memory_manager_error::logic_error_invalid_slot_handle);
         }
 
+        if (m_lock_free) {
+            auto& reference_count = m_slots[handle].reference_count;
+            std::uint32_t current = reference_count.load(std::memory_order_relaxed);
+            do {
+                if (current == 0) {
+                    return MakeUnexpected(
+                        Shared_memory_manager_error::runtime_error_slot_not_allocated);
+                }
+            } while (!reference_count.compare_exchange_weak(current, current - 1,
+                                                            std::memory_order_acq_rel,
+                                                            std::memory_order_relaxed));
+            if (current == 1) {
+                m_free_slots[find_class(handle)]->push(static_cast<std::uint32_t>(handle));
+            }
+            return {};
+        }
+
         std::lock_guard<std::mutex> lock(m_mutex);
 
         std::uint32_t current = m_slots[handle].reference_count.load(std::memory_order_acquire);
@@ -104,11 +379,57 @@ class Shared_memory_slot_manager_impl final : public Shared_memory_slot_manager
 
     std::size_t get_slot_size() const noexcept override { return m_slot_size; }
 
+    Slot_classes get_slot_classes() const noexcept override { return m_slot_classes; }
+
+    Event_slot_sizes get_event_slot_sizes() const noexcept override { return m_event_slot_sizes; }
+
+    Consumer_release get_consumer_release() const noexcept override { return m_consumer_release; }
+
+    Conflated_events get_conflated_events() const noexcept override { return m_conflated_events; }
+
+    Result<void> add_peer_consumer(Slot_handle handle) noexcept override {
+        if (m_consumer_counts == nullptr) {
+            return MakeUnexpected(Shared_memory_manager_error::logic_error_no_consumer_counts);
+        }
+        if (handle >= m_total_slot_count) {
+            return MakeUnexpected(Shared_memory_manager_error::logic_error_invalid_slot_handle);
+        }
+
+        m_consumer_counts[handle].fetch_add(1, std::memory_order_relaxed);
+        return {};
+    }
+
+    Result<void> remove_peer_consumer(Slot_handle handle) noexcept override {
+        if (m_consumer_counts == nullptr) {
+            return MakeUnexpected(Shared_memory_manager_error::logic_error_no_consumer_counts);
+        }
+        if (handle >= m_total_slot_count) {
+            return MakeUnexpected(Shared_memory_manager_error::logic_error_invalid_slot_handle);
+        }
+
+        if (!decrement_consumer_count(m_consumer_counts[handle])) {
+            return MakeUnexpected(Shared_memory_manager_error::runtime_error_slot_not_allocated);
+        }
+        return {};
+    }
+
+    std::size_t get_peer_consumer_count(Slot_handle handle) const noexcept override {
+        if (m_consumer_counts == nullptr || handle >= m_total_slot_count) {
+            return 0;
+        }
+
+        // Pairs with the release decrement of the consumer, so the slot may be reused afterwards
+        return m_consumer_counts[handle].load(std::memory_order_acquire);
+    }
+
     std::size_t get_allocated_slot_count() const noexcept override {
-        std::lock_guard<std::mutex> lock(m_mutex);
+        std::unique_lock<std::mutex> lock(m_mutex, std::defer_lock);
+        if (!m_lock_free) {
+            lock.lock();
+        }
 
         std::size_t count = 0;
-        for (std::size_t i = 0; i < m_slot_count; ++i) {
+        for (std::size_t i = 0; i < m_total_slot_count; ++i) {
             if (m_slots[i].reference_count.load(std::memory_order_acquire) > 0) {
                 ++count;
             }
@@ -117,7 +438,7 @@ class Shared_memory_slot_manager_impl final : public Shared_memory_slot_manager
     }
 
     std::size_t get_reference_count(Slot_handle handle) const noexcept override {
-        if (handle >= m_slot_count) {
+        if (handle >= m_total_slot_count) {
             return 0;
         }
 
@@ -125,7 +446,7 @@ class Shared_memory_slot_manager_impl final : public Shared_memory_slot_manager
     }
 
     Result<score::cpp::span<Byte>> get_memory(Slot_handle handle) const noexcept override {
-        if (handle >= m_slot_count) {
+        if (handle >= m_total_slot_count) {
             return MakeUnexpected(Shared_memory_manager_error::logic_error_invalid_slot_handle);
         }
 
@@ -135,7 +456,7 @@ class Shared_memory_slot_manager_impl final : public Shared_memory_slot_manager
 
         void* memory =
             static_cast<void*>(static_cast<char*>(m_base_address) + m_slots[handle].offset);
-        return score::cpp::span<Byte>(static_cast<Byte*>(memory), m_slot_size);
+        return score::cpp::span<Byte>(static_cast<Byte*>(memory), m_slots[handle].size);
     }
 
     [[nodiscard]] std::string get_path() const noexcept override {
@@ -147,13 +468,69 @@ class Shared_memory_slot_manager_impl final : public Shared_memory_slot_manager
     struct Slot_metadata {
         std::atomic<std::uint32_t> reference_count{0};
         std::size_t offset{0};
+        std::size_t size{0};
+    };
+
+    struct Class_range {
+        std::size_t slot_size;
+        Slot_handle first_handle;
+        std::size_t slot_count;
     };
 
+    std::size_t find_class(Slot_handle handle) const noexcept {
+        std::size_t class_index = 0;
+        while (handle >= m_classes[class_index].first_handle + m_classes[class_index].slot_count) {
+            ++class_index;
+        }
+        assert(class_index < m_class_count);
+        return class_index;
+    }
+
+    Result<Shared_memory_slot_guard> allocate_slot_from_class(std::size_t class_index) noexcept {
+        if (m_lock_free) {
+            auto const index = m_free_slots[class_index]->pop();
+            if (!index) {
+                return MakeUnexpected(
+                    Shared_memory_manager_error::runtime_error_no_available_slots);
+            }
+            m_slots[*index].reference_count.store(1, std::memory_order_relaxed);
+            return Shared_memory_slot_manager::create_slot_guard(*this, *index);
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto const& slot_class = m_classes[class_index];
+        for (std::size_t i = slot_class.first_handle;
+             i < slot_class.first_handle + slot_class.slot_count; ++i) {
+            std::uint32_t expected = 0;
+            if (m_slots[i].reference_count.compare_exchange_strong(
+                    expected, 1, std::memory_order_acquire, std::memory_order_relaxed)) {
+                return Shared_memory_slot_manager::create_slot_guard(*this, i);
+            }
+        }
+
+        return MakeUnexpected(Shared_memory_manager_error::runtime_error_no_available_slots);
+    }
+
     std::size_t m_slot_size;
     std::size_t m_slot_count;
+    Slot_classes m_slot_classes;
+    Event_slot_sizes m_event_slot_sizes;
+    Consumer_release m_consumer_release;
+    Conflated_events m_conflated_events;
+    std::size_t m_total_slot_count;
+    std::size_t m_class_count;
+    std::array<Class_range, kMax_slot_classes + 1> m_classes{};
+    std::array<std::size_t, kMax_slot_classes + 1> m_allocation_order{};
     std::shared_ptr<score::memory::shared::ISharedMemoryResource> m_shared_memory;
     void* m_base_address;
+    // Consumer count per slot in shared memory, nullptr without
+    // Consumer_release::shared_memory_consumer_count
+    Consumer_count* m_consumer_counts{nullptr};
     std::unique_ptr<Slot_metadata[]> m_slots;
+    bool m_lock_free;
+    // One list per slot class, only set for Slot_allocation_strategy::lock_free_free_list
+    std::array<std::optional<Free_slot_list>, kMax_slot_classes + 1> m_free_slots;
     mutable std::mutex m_mutex;
 };
 
@@ -162,10 +539,11 @@ class Shared_memory_slot_manager_impl final : public Shared_memory_slot_manager
 /// Calls the supplied destruction callback when the Payload is destroyed,
 /// allowing the caller to send a Payload_consumed notification.
 static socom::Payload make_read_only_shared_memory_payload(
-    void const* base, Slot_handle slot_index, std::size_t slot_size, std::size_t used_bytes,
+    void const* base, Slot_handle slot_index, std::size_t offset, std::size_t slot_size,
+    std::size_t used_bytes,
     Read_only_shared_memory_slot_manager::On_payload_destruction_callback callback) noexcept {
     using Byte = socom::Payload::Byte;
-    auto const* data = static_cast<Byte const*>(base) + slot_index * slot_size;
+    auto const* data = static_cast<Byte const*>(base) + offset;
     auto const actual_size = std::min(used_bytes, slot_size);
     // TODO get rid of const_cast
     // const_cast is safe: Payload::data() returns Span (const), so the data is never modified
@@ -180,15 +558,14 @@ class Read_only_shared_memory_slot_manager_impl final
    public:
     Read_only_shared_memory_slot_manager_impl(
         std::shared_ptr<score::memory::shared::ISharedMemoryResource> shared_memory,
-        std::size_t slot_size, std::size_t slot_count) noexcept
+        Slot_layout const& layout) noexcept
         : m_shared_memory(std::move(shared_memory)),
           m_base_address(m_shared_memory->getUsableBaseAddress()),
-          m_slot_size(slot_size),
-          m_slot_count(slot_count) {
+          m_layout(layout),
+          m_consumer_counts(m_layout.get_consumer_counts(m_base_address)) {
         assert(m_shared_memory != nullptr);
         assert(m_base_address != nullptr);
-        assert(m_slot_size > 0);
-        assert(m_slot_count > 0);
+        assert(m_layout.get_slot_count() > 0);
     }
 
     ~Read_only_shared_memory_slot_manager_impl() noexcept override {
@@ -198,33 +575,46 @@ class Read_only_shared_memory_slot_manager_impl final
     std::optional<socom::Payload> get_payload(
         Shared_memory_handle handle,
         On_payload_destruction_callback callback) const noexcept override {
-        if (handle.slot_index >= m_slot_count) {
+        auto const* const slot_class = m_layout.find_class(handle.slot_index);
+        if (slot_class == nullptr) {
             return std::nullopt;
         }
 
-        return make_read_only_shared_memory_payload(m_base_address, handle.slot_index, m_slot_size,
-                                                    handle.used_bytes, std::move(callback));
+        auto const offset = slot_class->offset +
+                            (handle.slot_index - slot_class->first_handle) * slot_class->slot_size;
+        if (m_consumer_counts != nullptr) {
+            callback = [consumer_count = &m_consumer_counts[handle.slot_index]]() {
+                static_cast<void>(decrement_consumer_count(*consumer_count));
+            };
+        }
+        return make_read_only_shared_memory_payload(m_base_address, handle.slot_index, offset,
+                                                    slot_class->slot_size, handle.used_bytes,
+                                                    std::move(callback));
     }
 
    private:
     std::shared_ptr<score::memory::shared::ISharedMemoryResource> m_shared_memory;
-    void const* m_base_address;
-    std::size_t m_slot_size;
-    std::size_t m_slot_count;
+    void* m_base_address;
+    Slot_layout m_layout;
+    Consumer_count* m_consumer_counts;
 };
 
 Result<std::unique_ptr<Shared_memory_slot_manager>> create_shared_memory_slot_manager(
-    std::string const& path, std::size_t slot_count, std::size_t slot_size) noexcept {
+    Shared_memory_metadata const& metadata, Slot_allocation_strategy strategy) noexcept {
     // Validate parameters
-    if (slot_size == 0) {
-        return MakeUnexpected(Shared_memory_manager_error::logic_error_invalid_slot_size);
+    auto layout = Slot_layout::create(metadata);
+    if (!layout) {
+        return MakeUnexpected<std::unique_ptr<Shared_memory_slot_manager>>(
+            std::move(layout).error());
     }
 
-    if (slot_count == 0) {
+    if (strategy == Slot_allocation_strategy::lock_free_free_list &&
+        layout->get_slot_count() >= Free_slot_list::end_of_list) {
         return MakeUnexpected(Shared_memory_manager_error::logic_error_invalid_slot_count);
     }
 
-    auto total_size = slot_count * slot_size;
+    auto const path = fixed_string_to_string(metadata.path);
+    auto const total_size = layout->get_total_size();
 
     // Create shared memory
     score::memory::shared::SharedMemoryFactory factory;
@@ -251,13 +641,14 @@ Result<std::unique_ptr<Shared_memory_slot_manager>> create_shared_memory_slot_ma
     }
 
     return std::make_unique<Shared_memory_slot_manager_impl>(
-        slot_size, slot_count, std::move(shared_memory), base_address);
+        *layout, metadata, std::move(shared_memory), base_address, strategy);
 }
 
 class Shared_memory_manager_factory_impl final : public Shared_memory_manager_factory {
    public:
-    explicit Shared_memory_manager_factory_impl(Shared_memory_configuration configuration) noexcept
-        : m_configuration(std::move(configuration)) {}
+    Shared_memory_manager_factory_impl(Shared_memory_configuration configuration,
+                                       Slot_allocation_strategy strategy) noexcept
+        : m_configuration(std::move(configuration)), m_strategy(strategy) {}
 
     Result<Shared_memory_slot_manager::Uptr> create(
         score::socom::Service_interface_identifier const& interface,
@@ -273,14 +664,11 @@ class Shared_memory_manager_factory_impl final : public Shared_memory_manager_fa
                 Shared_memory_manager_error::logic_error_no_configuration_for_instance);
         }
 
-        return create_shared_memory_slot_manager(fixed_string_to_string(instance_it->second.path),
-                                                 instance_it->second.slot_count,
-                                                 instance_it->second.slot_size);
+        return create_shared_memory_slot_manager(instance_it->second, m_strategy);
     }
 
     Result<void> register_configuration(Shared_memory_configs const& configs) noexcept override {
-        for (std::size_t i = 0; i < configs.size; ++i) {
-            auto const& entry = configs.data[i];
+        for (auto const& entry : configs) {
             auto const interface = entry.service.to_socom_identifier();
             auto const instance =
                 socom::Service_instance{fixed_string_to_string(entry.instance_id)};
@@ -293,18 +681,28 @@ class Shared_memory_manager_factory_impl final : public Shared_memory_manager_fa
 
     Result<Read_only_shared_memory_slot_manager::Uptr> open(
         Shared_memory_metadata const& metadata) noexcept override {
+        auto layout = Slot_layout::create(metadata);
+        if (!layout) {
+            return MakeUnexpected<Read_only_shared_memory_slot_manager::Uptr>(
+                std::move(layout).error());
+        }
+
         std::string const path = fixed_string_to_string(metadata.path);
-        auto shm = score::memory::shared::SharedMemoryFactory::Open(path, /*is_read_write=*/false);
+        // Consumers decrement the consumer counts, which requires write access
+        auto const is_read_write =
+            metadata.consumer_release == Consumer_release::shared_memory_consumer_count;
+        auto shm = score::memory::shared::SharedMemoryFactory::Open(path, is_read_write);
         if (shm == nullptr) {
             return MakeUnexpected(
                 Shared_memory_manager_error::runtime_error_shared_memory_allocation_failed);
         }
-        return std::make_unique<Read_only_shared_memory_slot_manager_impl>(
-            std::move(shm), metadata.slot_size, metadata.slot_count);
+        return std::make_unique<Read_only_shared_memory_slot_manager_impl>(std::move(shm),
+                                                                           *layout);
     }
 
    private:
     Shared_memory_configuration m_configuration;
+    Slot_allocation_strategy m_strategy;
 };
 
 }  // namespace
@@ -394,22 +792,17 @@ Shared_memory_slot_guard Shared_memory_slot_manager::create_slot_guard(
 }
 
 Shared_memory_manager_factory::Uptr Shared_memory_manager_factory::create(
-    Shared_memory_configuration configuration) noexcept {
-    return std::make_unique<Shared_memory_manager_factory_impl>(std::move(configuration));
+    Shared_memory_configuration configuration, Slot_allocation_strategy strategy) noexcept {
+    return std::make_unique<Shared_memory_manager_factory_impl>(std::move(configuration),
+                                                                strategy);
 }
 
 Shared_memory_configs make_shared_memory_configs(
     Shared_memory_manager_factory::Shared_memory_configuration const& config) noexcept {
-    Shared_memory_configs result{};
+    Shared_memory_configs result;
     for (auto const& [interface, instances] : config) {
         for (auto const& [instance, metadata] : instances) {
-            assert(result.size < Shared_memory_configs::max_size &&
-                   "make_shared_memory_configs: too many entries for fixed container");
-            auto& entry = result.data[result.size];
-            entry.service = make_service(interface);
-            entry.instance_id = make_instance_id(instance);
-            entry.metadata = metadata;
-            ++result.size;
+            result.push_back({make_service(interface), make_instance_id(instance), metadata});
         }
     }
     return result;
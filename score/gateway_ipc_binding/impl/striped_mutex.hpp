@@ -0,0 +1,142 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SRC_GATEWAY_IPC_BINDING_SRC_STRIPED_MUTEX
+#define SRC_GATEWAY_IPC_BINDING_SRC_STRIPED_MUTEX
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+
+namespace score::gateway_ipc_binding {
+
+/// \brief Recursive reader/writer mutex split into stripes
+///
+/// lock() and unlock() take all stripes, so the mutex can be used with std::lock_guard and
+/// std::unique_lock like a std::recursive_mutex. A Shared_lock takes only the stripe selected by
+/// its hint, e.g. a key, so shared lockers with different hints do not contend. State written only
+/// under lock() may be read under any Shared_lock, state written under a Shared_lock needs its own
+/// synchronization unless all its writers use the same hint.
+///
+/// A thread holding a Shared_lock must not call lock(), it could deadlock with another thread
+/// calling lock(). A nested Shared_lock reuses the stripe already held by its thread.
+///
+/// A Writer_fence lets work started under a Shared_lock, e.g. sending, finish after the stripe is
+/// released: lock() waits for all fences, shared lockers do not. As lock() holds all stripes
+/// while it waits, a thread holding a fence must not take a stripe.
+class Striped_mutex {
+   public:
+    static constexpr std::size_t stripe_count = 8U;
+
+    class Writer_fence;
+
+    class Shared_lock {
+       public:
+        Shared_lock(Striped_mutex& mutex, std::size_t hint) noexcept
+            : m_mutex(&mutex), m_outer(t_innermost) {
+            m_stripe = &mutex.m_stripes[hint % stripe_count].mutex;
+            for (auto const* outer = m_outer; outer != nullptr; outer = outer->m_outer) {
+                if (outer->m_mutex == m_mutex) {
+                    m_stripe = outer->m_stripe;
+                    break;
+                }
+            }
+            m_stripe->lock();
+            t_innermost = this;
+        }
+
+        ~Shared_lock() {
+            m_stripe->unlock();
+            t_innermost = m_outer;
+        }
+
+        Shared_lock(Shared_lock const&) = delete;
+        Shared_lock(Shared_lock&&) = delete;
+        Shared_lock& operator=(Shared_lock const&) = delete;
+        Shared_lock& operator=(Shared_lock&&) = delete;
+
+       private:
+        // Shared locks of the current thread, innermost first, to find an already held stripe
+        static inline thread_local Shared_lock const* t_innermost{nullptr};
+
+        friend class Striped_mutex::Writer_fence;
+
+        Striped_mutex* m_mutex;
+        Shared_lock const* m_outer;
+        std::recursive_mutex* m_stripe{nullptr};
+    };
+
+    class Writer_fence {
+       public:
+        /// \brief Keeps lock() from returning, lock has to be held while the fence is created
+        explicit Writer_fence(Shared_lock const& lock) noexcept : m_mutex(lock.m_mutex) {
+            m_mutex->m_fence_count.fetch_add(1U, std::memory_order_relaxed);
+        }
+
+        ~Writer_fence() {
+            if (m_mutex->m_fence_count.fetch_sub(1U, std::memory_order_acq_rel) == 1U) {
+                std::lock_guard<std::mutex> const lock{m_mutex->m_fence_mutex};
+                m_mutex->m_fences_released.notify_all();
+            }
+        }
+
+        Writer_fence(Writer_fence const&) = delete;
+        Writer_fence(Writer_fence&&) = delete;
+        Writer_fence& operator=(Writer_fence const&) = delete;
+        Writer_fence& operator=(Writer_fence&&) = delete;
+
+       private:
+        Striped_mutex* m_mutex;
+    };
+
+    void lock() {
+        for (auto& stripe : m_stripes) {
+            stripe.mutex.lock();
+        }
+
+        // Fences are created under a stripe, so only this thread can add one from now on. A
+        // recursive lock() must not wait for those.
+        if (m_lock_depth++ == 0U) {
+            std::unique_lock<std::mutex> lock{m_fence_mutex};
+            m_fences_released.wait(lock, [this]() {
+                return m_fence_count.load(std::memory_order_acquire) == 0U;
+            });
+        }
+    }
+
+    void unlock() {
+        --m_lock_depth;
+        for (auto it = m_stripes.rbegin(); it != m_stripes.rend(); ++it) {
+            it->mutex.unlock();
+        }
+    }
+
+   private:
+    // Separate cache lines, so shared lockers of different stripes do not slow down each other
+    struct alignas(64) Stripe {
+        std::recursive_mutex mutex;
+    };
+
+    std::array<Stripe, stripe_count> m_stripes;
+    // Only modified while all stripes are held
+    std::size_t m_lock_depth{0U};
+    std::atomic<std::size_t> m_fence_count{0U};
+    std::mutex m_fence_mutex;
+    std::condition_variable m_fences_released;
+};
+
+}  // namespace score::gateway_ipc_binding
+
+#endif  // SRC_GATEWAY_IPC_BINDING_SRC_STRIPED_MUTEX
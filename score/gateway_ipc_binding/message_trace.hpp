@@ -0,0 +1,85 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SCORE_GATEWAY_IPC_BINDING_INCLUDE_SCORE_GATEWAY_IPC_BINDING_MESSAGE_TRACE
+#define SCORE_GATEWAY_IPC_BINDING_INCLUDE_SCORE_GATEWAY_IPC_BINDING_MESSAGE_TRACE
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <type_traits>
+#include <vector>
+
+#include "score/gateway_ipc_binding/gateway_ipc_binding.hpp"
+#include "score/result/result.h"
+
+namespace score::gateway_ipc_binding {
+
+/// \brief Whether a traced message was received from or sent to the peer
+enum class Message_direction : std::uint8_t { received, sent };
+
+/// \brief Fixed-size record of one IPC message handled by a binding
+///
+/// Each entry of an Event_update_batch or Payload_consumed_batch gets a record of its own, with the
+/// type of the entry and zero frame_bytes, following the record of the batch.
+struct Message_trace_record {
+    /// \brief std::chrono::steady_clock time in nanoseconds
+    std::uint64_t timestamp_ns;
+    /// \brief required_id or provided_id of the message, zero if it has none
+    Remote_handle handle;
+    std::uint32_t client_id;
+    /// \brief Shared memory slot of the payload, kNo_trace_slot without payload
+    std::uint32_t slot_index;
+    /// \brief Used bytes of the payload in the shared memory
+    std::uint32_t payload_bytes;
+    /// \brief Size of the message including its framing
+    std::uint32_t frame_bytes;
+    /// \brief Event_id or Method_id of the message, zero if it has none
+    std::uint16_t element_id;
+    Message_type type;
+    Message_direction direction;
+    std::uint32_t reserved;
+};
+
+static_assert(std::is_trivially_copyable_v<Message_trace_record>);
+static_assert(sizeof(Message_trace_record) == 40U);
+
+bool operator==(Message_trace_record const& lhs, Message_trace_record const& rhs) noexcept;
+
+/// \brief slot_index of a Message_trace_record without payload
+inline constexpr std::uint32_t kNo_trace_slot = UINT32_MAX;
+
+/// \brief Trace records, ordered by timestamp
+using Message_trace_records = std::vector<Message_trace_record>;
+
+/// \brief Recording of the messages handled by a binding, enabled by default
+///
+/// Each thread receiving or sending messages records into a ring of its own, which keeps the most
+/// recent records_per_thread records. Zero disables the recording.
+struct Message_tracing {
+    std::size_t records_per_thread{4096U};
+};
+
+/// \brief Writes records in the binary trace format: a header with magic and version, followed
+///        by the records in host byte order
+/// \return Error if the stream failed
+Result<void> write_message_trace(std::ostream& stream, Message_trace_records const& records);
+
+/// \brief Reads records written by write_message_trace()
+/// \return The records, or an error if the stream failed or holds no valid trace
+Result<Message_trace_records> read_message_trace(std::istream& stream);
+
+}  // namespace score::gateway_ipc_binding
+
+#endif  // SCORE_GATEWAY_IPC_BINDING_INCLUDE_SCORE_GATEWAY_IPC_BINDING_MESSAGE_TRACE
@@ -15,6 +15,7 @@
 #define SCORE_GATEWAY_IPC_BINDING_INCLUDE_SCORE_GATEWAY_IPC_BINDING_SHARED_MEMORY_SLOT_MANAGER
 
 #include <cstddef>
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <optional>
@@ -44,6 +45,20 @@ using Byte = std::byte;
 
 class Shared_memory_slot_manager;
 
+/// \brief Strategy used by a Shared_memory_slot_manager to find a free slot
+enum class Slot_allocation_strategy : std::uint8_t {
+    /// \brief Scan all slots under a mutex and claim the first free one
+    ///
+    /// Allocation is O(slot_count) in the worst case. Released slots with the lowest handle are
+    /// reused first.
+    linear_scan,
+    /// \brief Pop free slots from a lock-free stack of slot indices
+    ///
+    /// allocate_slot(), add_consumer() and release_slot() are O(1) and never take a lock. The
+    /// most recently released slot is reused first. Requires slot_count < 2^32 - 1.
+    lock_free_free_list,
+};
+
 /// \brief RAII wrapper for automatic slot release
 ///
 /// This class provides automatic slot cleanup using RAII pattern.
@@ -145,14 +160,17 @@ class Shared_memory_slot_guard {
     Slot_handle m_handle;
 };
 
-/// \brief Manages fixed-size slots of shared memory with reference counting
+/// \brief Manages size classes of slots of shared memory with reference counting
 ///
 /// This class allocates a large chunk of shared memory and divides it into
-/// fixed-size slots. Each slot can be allocated and shared among multiple
+/// slot classes of fixed-size slots (see Shared_memory_metadata for the layout).
+/// Each slot can be allocated and shared among multiple
 /// consumers using reference counting. When all consumers release a slot,
 /// it becomes available for reuse.
 ///
-/// Thread-safe: All operations are protected by internal mutex.
+/// Thread-safe: With Slot_allocation_strategy::linear_scan all operations are protected by an
+/// internal mutex. With Slot_allocation_strategy::lock_free_free_list all operations are
+/// lock-free.
 ///
 /// Example usage:
 /// \code
@@ -186,12 +204,23 @@ class Shared_memory_slot_manager {
 
     /// \brief Allocate a slot from the pool
     ///
-    /// Finds the first available slot, marks it as allocated with reference
-    /// count 1, and returns a guard managing the slot.
+    /// Finds an available slot according to the Slot_allocation_strategy, marks it as allocated
+    /// with reference count 1, and returns a guard managing the slot.
     ///
     /// \return Guard managing allocated slot if successful, or an error if no slots available
     [[nodiscard]] virtual Result<Shared_memory_slot_guard> allocate_slot() noexcept = 0;
 
+    /// \brief Allocate a slot of at least the requested size
+    ///
+    /// Picks the smallest slot class, including the default class, whose slots are at least size
+    /// bytes large. If that class is exhausted, the next larger class is used.
+    ///
+    /// \param size Number of bytes the slot must hold
+    /// \return Guard managing allocated slot if successful, or an error if no slot class is large
+    /// enough or no fitting slots are available
+    [[nodiscard]] virtual Result<Shared_memory_slot_guard> allocate_slot(
+        std::size_t size) noexcept = 0;
+
     /// \brief Add a consumer to an allocated slot
     ///
     /// Increments the reference count for the slot. Use this when sharing
@@ -213,19 +242,64 @@ class Shared_memory_slot_manager {
     /// allocated
     [[nodiscard]] virtual Result<void> release_slot(Slot_handle handle) noexcept = 0;
 
-    /// \brief Get the number of slots managed by this instance
+    /// \brief Get the number of slots of the default slot class
     ///
-    /// \return Total number of slots
+    /// \return Number of slots of the default slot class
     [[nodiscard]] virtual std::size_t get_slot_count() const noexcept = 0;
 
-    /// \brief Get the size of each slot in bytes
+    /// \brief Get the size of each slot of the default slot class in bytes
     ///
     /// \return Slot size in bytes
     [[nodiscard]] virtual std::size_t get_slot_size() const noexcept = 0;
 
+    /// \brief Get the additional slot classes placed behind the default slot class
+    ///
+    /// \return Additional slot classes in layout order
+    [[nodiscard]] virtual Slot_classes get_slot_classes() const noexcept = 0;
+
+    /// \brief Get the configured largest payload per event
+    ///
+    /// \return Largest payload size in bytes, indexed by Event_id
+    [[nodiscard]] virtual Event_slot_sizes get_event_slot_sizes() const noexcept = 0;
+
+    /// \brief Get how peer consumers release slots of this shared memory
+    ///
+    /// \return Consumer release mode the shared memory was created with
+    [[nodiscard]] virtual Consumer_release get_consumer_release() const noexcept = 0;
+
+    /// \brief Get the events of which peers only get the latest update
+    ///
+    /// \return Conflated events, indexed by Event_id
+    [[nodiscard]] virtual Conflated_events get_conflated_events() const noexcept = 0;
+
+    /// \brief Add a peer consumer to the consumer count of a slot in shared memory
+    ///
+    /// Must be called before the slot is announced to the peer, which decrements the count once
+    /// it has consumed the payload.
+    ///
+    /// \param handle Slot handle
+    /// \return Result<void> - success, or an error if the handle is invalid or the shared memory
+    /// was not created with Consumer_release::shared_memory_consumer_count
+    [[nodiscard]] virtual Result<void> add_peer_consumer(Slot_handle handle) noexcept = 0;
+
+    /// \brief Undo add_peer_consumer, e.g. because announcing the slot to the peer failed
+    ///
+    /// \param handle Slot handle
+    /// \return Result<void> - success, or an error if the handle is invalid, the consumer count is
+    /// already zero or the shared memory has no consumer counts
+    [[nodiscard]] virtual Result<void> remove_peer_consumer(Slot_handle handle) noexcept = 0;
+
+    /// \brief Get the number of peer consumers which have not yet consumed a slot
+    ///
+    /// \param handle Slot handle
+    /// \return Consumer count in shared memory, 0 if the handle is invalid or the shared memory
+    /// has no consumer counts
+    [[nodiscard]] virtual std::size_t get_peer_consumer_count(
+        Slot_handle handle) const noexcept = 0;
+
     /// \brief Get the number of currently allocated slots
     ///
-    /// \return Number of slots with reference count > 0
+    /// \return Number of slots of all slot classes with reference count > 0
     [[nodiscard]] virtual std::size_t get_allocated_slot_count() const noexcept = 0;
 
     /// \brief Get the reference count for a specific slot
@@ -268,6 +342,8 @@ class Read_only_shared_memory_slot_manager {
     /// associated with the given handle. The payload object will call the provided callback when it
     /// is destroyed, allowing the caller to perform any necessary cleanup or reference count
     /// management.
+    /// With Consumer_release::shared_memory_consumer_count the consumer count of the slot is
+    /// decremented instead and callback is not used.
     /// \param handle Shared memory handle identifying the slot
     /// \param callback Callback to be called when the returned payload is destroyed
     /// \return A Payload object on success, or std::nullopt on failure
@@ -297,8 +373,11 @@ class Shared_memory_manager_factory {
     ///
     /// \param configuration Configuration mapping service interfaces and instances to shared memory
     /// metadata
+    /// \param strategy Allocation strategy of the writable slot managers created by the factory
     /// \return unique_ptr to the concrete factory
-    [[nodiscard]] static Uptr create(Shared_memory_configuration configuration) noexcept;
+    [[nodiscard]] static Uptr create(
+        Shared_memory_configuration configuration,
+        Slot_allocation_strategy strategy = Slot_allocation_strategy::linear_scan) noexcept;
 
     /// \brief Create a Shared_memory_slot_manager with specified parameters
     /// \param interface Service interface for which the slot manager is being created
@@ -0,0 +1,256 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <future>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "score/gateway_ipc_binding/gateway_ipc_binding.hpp"
+#include "test_constants.hpp"
+#include "test_fixtures.hpp"
+#include "util.hpp"
+
+using testing::_;
+using testing::Values;
+using namespace std::chrono_literals;
+
+namespace score::gateway_ipc_binding {
+
+class Gateway_ipc_binding_batching_integration_test
+    : public Gateway_ipc_binding_unconnected_integration_test {
+   protected:
+    explicit Gateway_ipc_binding_batching_integration_test(Message_batching batching) {
+        client.reset();
+        server = create_ipc_server(*runtime_server, batching);
+        client = create_ipc_client(*runtime_client, client_shm_config, {},
+                                   server_shared_memory_configs, {}, batching);
+        start_and_wait_for_client_connection();
+    }
+};
+
+class Gateway_ipc_binding_flushed_batch_integration_test
+    : public Gateway_ipc_binding_batching_integration_test {
+   protected:
+    // The deadline never passes during a test, batches are sent when full or flushed
+    Gateway_ipc_binding_flushed_batch_integration_test()
+        : Gateway_ipc_binding_batching_integration_test({{4U, 1h}, {}}) {}
+};
+
+class Gateway_ipc_binding_deadline_batch_integration_test
+    : public Gateway_ipc_binding_batching_integration_test {
+   protected:
+    Gateway_ipc_binding_deadline_batch_integration_test()
+        : Gateway_ipc_binding_batching_integration_test({{4U, 1ms}, {}}) {}
+};
+
+class Gateway_ipc_binding_acknowledgement_batch_integration_test
+    : public Gateway_ipc_binding_batching_integration_test {
+   protected:
+    // Acknowledgements are only sent once they hold back half of the producer's slots
+    Gateway_ipc_binding_acknowledgement_batch_integration_test()
+        : Gateway_ipc_binding_batching_integration_test(
+              {{}, {kMax_payload_consumed_batch_size, 1h}}) {}
+};
+
+class Gateway_ipc_binding_acknowledgement_deadline_integration_test
+    : public Gateway_ipc_binding_batching_integration_test {
+   protected:
+    Gateway_ipc_binding_acknowledgement_deadline_integration_test()
+        : Gateway_ipc_binding_batching_integration_test(
+              {{}, {kMax_payload_consumed_batch_size, 1ms}}) {}
+};
+
+template <typename BASE>
+class Gateway_ipc_binding_connected_batch_test
+    : public Gateway_ipc_binding_bidirectional_test<BASE> {
+   protected:
+    Server_connector_with_callbacks server{this->get_server_runtime(),
+                                           this->socom_server_config, this->instance};
+    Client_connector_with_callbacks client{this->get_client_runtime(),
+                                           this->socom_server_config, this->instance};
+    std::optional<socom::Payload> m_last_payload;
+
+    void flush_event_updates_of_server_side() {
+        if (this->GetParam() == Direction::Client_to_server) {
+            BASE::server->flush_event_updates();
+        } else {
+            BASE::client->flush_event_updates();
+        }
+    }
+
+    /// \brief Expects count updates and returns the first payload byte of each in receive order
+    std::future<std::vector<std::byte>> expect_event_updates(std::size_t count) {
+        auto promise = std::make_shared<std::promise<std::vector<std::byte>>>();
+        auto received = std::make_shared<std::vector<std::byte>>();
+        EXPECT_CALL(client.mock_event_update_cb, Call(_, this->event_id, _))
+            .Times(count)
+            .WillRepeatedly([this, promise, received, count](auto&, auto, auto payload) {
+                received->push_back(payload.data()[0]);
+                m_last_payload = std::move(payload);
+                if (received->size() == count) {
+                    promise->set_value(*received);
+                }
+            });
+        return promise->get_future();
+    }
+
+    void send_event_updates(std::size_t count) {
+        for (std::size_t i = 0U; i < count; ++i) {
+            auto payload_handle =
+                create_payload(*server.connector, this->event_id, expected_payload);
+            payload_handle.wdata()[0] = std::byte{static_cast<std::uint8_t>(i)};
+            ASSERT_TRUE(server.connector->update_event(this->event_id, std::move(payload_handle)));
+        }
+    }
+
+    /// \brief Sends and receives one update per slot of the producer
+    std::vector<socom::Payload> receive_event_update_per_slot() {
+        std::vector<socom::Payload> result;
+        for (std::size_t i = 0U; i < this->get_server_metadata().slot_count; ++i) {
+            auto received = expect_event_updates(1U);
+            auto payload_handle =
+                create_payload(*server.connector, this->event_id, expected_payload);
+            EXPECT_TRUE(server.connector->update_event(this->event_id, std::move(payload_handle)));
+            EXPECT_EQ(received.wait_for(very_long_timeout), std::future_status::ready);
+            result.push_back(std::move(*m_last_payload));
+        }
+        return result;
+    }
+
+    bool wait_until_payload_can_be_allocated() {
+        auto const deadline = std::chrono::steady_clock::now() + very_long_timeout;
+        while (!server.connector->allocate_event_payload(this->event_id)) {
+            if (std::chrono::steady_clock::now() > deadline) {
+                return false;
+            }
+            std::this_thread::sleep_for(1ms);
+        }
+        return true;
+    }
+
+    static std::vector<std::byte> numbered_payloads(std::size_t count) {
+        std::vector<std::byte> result;
+        for (std::size_t i = 0U; i < count; ++i) {
+            result.push_back(std::byte{static_cast<std::uint8_t>(i)});
+        }
+        return result;
+    }
+};
+
+using Gateway_ipc_binding_connected_flushed_batch_integration_test =
+    Gateway_ipc_binding_connected_batch_test<Gateway_ipc_binding_flushed_batch_integration_test>;
+using Gateway_ipc_binding_connected_deadline_batch_integration_test =
+    Gateway_ipc_binding_connected_batch_test<Gateway_ipc_binding_deadline_batch_integration_test>;
+using Gateway_ipc_binding_connected_acknowledgement_batch_integration_test =
+    Gateway_ipc_binding_connected_batch_test<
+        Gateway_ipc_binding_acknowledgement_batch_integration_test>;
+using Gateway_ipc_binding_connected_acknowledgement_deadline_integration_test =
+    Gateway_ipc_binding_connected_batch_test<
+        Gateway_ipc_binding_acknowledgement_deadline_integration_test>;
+
+INSTANTIATE_TEST_SUITE_P(, Gateway_ipc_binding_connected_flushed_batch_integration_test,
+                         Values(Direction::Client_to_server, Direction::Server_to_client),
+                         readable_test_names);
+INSTANTIATE_TEST_SUITE_P(, Gateway_ipc_binding_connected_deadline_batch_integration_test,
+                         Values(Direction::Client_to_server, Direction::Server_to_client),
+                         readable_test_names);
+INSTANTIATE_TEST_SUITE_P(, Gateway_ipc_binding_connected_acknowledgement_batch_integration_test,
+                         Values(Direction::Client_to_server, Direction::Server_to_client),
+                         readable_test_names);
+INSTANTIATE_TEST_SUITE_P(, Gateway_ipc_binding_connected_acknowledgement_deadline_integration_test,
+                         Values(Direction::Client_to_server, Direction::Server_to_client),
+                         readable_test_names);
+
+TEST_P(Gateway_ipc_binding_connected_flushed_batch_integration_test,
+       full_batch_is_sent_in_order) {
+    client.subscribe_event(server.mock_event_subscription_change_cb, event_id);
+
+    auto received = expect_event_updates(4U);
+    send_event_updates(4U);
+
+    ASSERT_EQ(received.wait_for(very_long_timeout), std::future_status::ready);
+    EXPECT_EQ(received.get(), numbered_payloads(4U));
+}
+
+TEST_P(Gateway_ipc_binding_connected_flushed_batch_integration_test,
+       pending_batch_is_sent_on_flush) {
+    client.subscribe_event(server.mock_event_subscription_change_cb, event_id);
+
+    auto received = expect_event_updates(2U);
+    send_event_updates(2U);
+    EXPECT_EQ(received.wait_for(20ms), std::future_status::timeout);
+
+    flush_event_updates_of_server_side();
+
+    ASSERT_EQ(received.wait_for(very_long_timeout), std::future_status::ready);
+    EXPECT_EQ(received.get(), numbered_payloads(2U));
+}
+
+TEST_P(Gateway_ipc_binding_connected_deadline_batch_integration_test,
+       pending_batch_is_sent_after_deadline) {
+    client.subscribe_event(server.mock_event_subscription_change_cb, event_id);
+
+    auto received = expect_event_updates(3U);
+    send_event_updates(3U);
+
+    ASSERT_EQ(received.wait_for(very_long_timeout), std::future_status::ready);
+    EXPECT_EQ(received.get(), numbered_payloads(3U));
+}
+
+TEST_P(Gateway_ipc_binding_connected_deadline_batch_integration_test,
+       single_update_is_sent_after_deadline) {
+    client.subscribe_event(server.mock_event_subscription_change_cb, event_id);
+
+    auto received = expect_event_updates(1U);
+    send_event_updates(1U);
+
+    ASSERT_EQ(received.wait_for(very_long_timeout), std::future_status::ready);
+    EXPECT_EQ(received.get(), numbered_payloads(1U));
+}
+
+TEST_P(Gateway_ipc_binding_connected_acknowledgement_batch_integration_test,
+       acknowledgements_are_sent_before_they_hold_back_half_of_the_slots) {
+    client.subscribe_event(server.mock_event_subscription_change_cb, event_id);
+
+    auto payloads = receive_event_update_per_slot();
+    ASSERT_EQ(payloads.size(), get_server_metadata().slot_count);
+    EXPECT_FALSE(server.connector->allocate_event_payload(event_id));
+
+    auto const max_pending = get_server_metadata().slot_count / 2U;
+    payloads.erase(payloads.begin(), std::next(payloads.begin(), max_pending - 1U));
+    // Only sent once the batch reaches max_pending, so nothing can have arrived yet
+    EXPECT_FALSE(server.connector->allocate_event_payload(event_id));
+
+    payloads.erase(payloads.begin());
+    EXPECT_TRUE(wait_until_payload_can_be_allocated());
+}
+
+TEST_P(Gateway_ipc_binding_connected_acknowledgement_deadline_integration_test,
+       acknowledgement_is_sent_after_deadline) {
+    client.subscribe_event(server.mock_event_subscription_change_cb, event_id);
+
+    auto payloads = receive_event_update_per_slot();
+    ASSERT_EQ(payloads.size(), get_server_metadata().slot_count);
+    EXPECT_FALSE(server.connector->allocate_event_payload(event_id));
+
+    payloads.erase(payloads.begin());
+    EXPECT_TRUE(wait_until_payload_can_be_allocated());
+}
+
+}  // namespace score::gateway_ipc_binding
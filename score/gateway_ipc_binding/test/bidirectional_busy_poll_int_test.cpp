@@ -0,0 +1,150 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "score/gateway_ipc_binding/gateway_ipc_binding.hpp"
+#include "test_constants.hpp"
+#include "test_fixtures.hpp"
+#include "util.hpp"
+
+using testing::_;
+using testing::Values;
+using namespace std::chrono_literals;
+
+namespace score::gateway_ipc_binding {
+
+namespace {
+
+std::string data_ring_path() { return "/gw_busy_poll_ring_" + std::to_string(getpid()); }
+
+}  // namespace
+
+class Gateway_ipc_binding_busy_poll_integration_test
+    : public Gateway_ipc_binding_unconnected_integration_test {
+   protected:
+    explicit Gateway_ipc_binding_busy_poll_integration_test(
+        Busy_poll busy_poll = {100us, Busy_poll_wait::pause, std::nullopt}) {
+        client.reset();
+        server = create_ipc_server(*runtime_server, {}, {}, {}, {}, {}, busy_poll);
+        client = create_ipc_client(*runtime_client, client_shm_config, {},
+                                   server_shared_memory_configs, {}, {},
+                                   Data_ring_config{data_ring_path()}, {}, {}, {}, {}, busy_poll);
+        start_and_wait_for_client_connection();
+    }
+};
+
+class Gateway_ipc_binding_pinned_busy_poll_integration_test
+    : public Gateway_ipc_binding_busy_poll_integration_test {
+   protected:
+    Gateway_ipc_binding_pinned_busy_poll_integration_test()
+        : Gateway_ipc_binding_busy_poll_integration_test({100us, Busy_poll_wait::yield, 0U}) {}
+};
+
+template <typename BASE>
+class Gateway_ipc_binding_connected_busy_poll_test
+    : public Gateway_ipc_binding_bidirectional_test<BASE> {
+   protected:
+    // Declared first, so they outlive the connectors and their callbacks
+    std::mutex mutex;
+    std::condition_variable received_cv;
+    std::vector<std::byte> received;
+
+    Server_connector_with_callbacks producer{this->get_server_runtime(),
+                                             this->socom_server_config, this->instance};
+    Client_connector_with_callbacks consumer{this->get_client_runtime(),
+                                             this->socom_server_config, this->instance};
+
+    Gateway_ipc_binding_connected_busy_poll_test() {
+        EXPECT_CALL(consumer.mock_event_update_cb, Call(_, this->event_id, _))
+            .WillRepeatedly([this](auto&, auto, auto payload) {
+                {
+                    std::lock_guard<std::mutex> const lock{mutex};
+                    received.push_back(payload.data()[0]);
+                }
+                received_cv.notify_all();
+            });
+        consumer.subscribe_event(producer.mock_event_subscription_change_cb, this->event_id);
+    }
+
+    /// \brief Waits until the consumer released enough payloads for a new allocation
+    std::optional<socom::Writable_payload> allocate_event_payload() {
+        auto const deadline = std::chrono::steady_clock::now() + very_long_timeout;
+        while (std::chrono::steady_clock::now() < deadline) {
+            auto payload = producer.connector->allocate_event_payload(this->event_id);
+            if (payload) {
+                return std::move(*payload);
+            }
+            std::this_thread::yield();
+        }
+        return std::nullopt;
+    }
+
+    /// \brief Sends count updates, each after the previous one was received and pause passed
+    void send_and_receive_event_updates(std::size_t count, std::chrono::microseconds pause) {
+        for (std::size_t i = 0U; i < count; ++i) {
+            auto payload = allocate_event_payload();
+            ASSERT_TRUE(payload);
+            payload->wdata()[0] = std::byte{static_cast<std::uint8_t>(i)};
+            ASSERT_TRUE(producer.connector->update_event(this->event_id, std::move(*payload)));
+
+            std::unique_lock<std::mutex> lock{mutex};
+            ASSERT_TRUE(received_cv.wait_for(lock, very_long_timeout,
+                                             [this, i]() { return received.size() > i; }));
+            EXPECT_EQ(received[i], std::byte{static_cast<std::uint8_t>(i)});
+            lock.unlock();
+            std::this_thread::sleep_for(pause);
+        }
+    }
+};
+
+using Gateway_ipc_binding_connected_busy_poll_integration_test =
+    Gateway_ipc_binding_connected_busy_poll_test<Gateway_ipc_binding_busy_poll_integration_test>;
+using Gateway_ipc_binding_connected_pinned_busy_poll_integration_test =
+    Gateway_ipc_binding_connected_busy_poll_test<
+        Gateway_ipc_binding_pinned_busy_poll_integration_test>;
+
+INSTANTIATE_TEST_SUITE_P(, Gateway_ipc_binding_connected_busy_poll_integration_test,
+                         Values(Direction::Client_to_server, Direction::Server_to_client),
+                         readable_test_names);
+INSTANTIATE_TEST_SUITE_P(, Gateway_ipc_binding_connected_pinned_busy_poll_integration_test,
+                         Values(Direction::Client_to_server, Direction::Server_to_client),
+                         readable_test_names);
+
+TEST_P(Gateway_ipc_binding_connected_busy_poll_integration_test,
+       event_updates_are_received_while_polling) {
+    send_and_receive_event_updates(100U, 0us);
+}
+
+TEST_P(Gateway_ipc_binding_connected_busy_poll_integration_test,
+       event_updates_wake_up_the_idle_poller) {
+    // Each pause exceeds the spin budget, so the poller goes idle before every update
+    send_and_receive_event_updates(10U, 2ms);
+}
+
+TEST_P(Gateway_ipc_binding_connected_pinned_busy_poll_integration_test,
+       event_updates_are_received) {
+    send_and_receive_event_updates(20U, 200us);
+}
+
+}  // namespace score::gateway_ipc_binding
@@ -0,0 +1,227 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include <fcntl.h>
+#include <gtest/gtest.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <condition_variable>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "score/gateway_ipc_binding/gateway_ipc_binding.hpp"
+#include "test_constants.hpp"
+#include "test_fixtures.hpp"
+#include "util.hpp"
+
+using testing::_;
+using testing::Values;
+using namespace std::chrono_literals;
+
+namespace score::gateway_ipc_binding {
+
+namespace {
+
+std::string data_ring_path() { return "/gw_data_ring_" + std::to_string(getpid()); }
+
+bool shared_memory_exists(std::string const& path) {
+    auto const fd = shm_open(path.c_str(), O_RDONLY, 0);
+    if (fd < 0) {
+        return false;
+    }
+    close(fd);
+    return true;
+}
+
+}  // namespace
+
+class Gateway_ipc_binding_data_ring_integration_test
+    : public Gateway_ipc_binding_unconnected_integration_test {
+   protected:
+    explicit Gateway_ipc_binding_data_ring_integration_test(std::size_t capacity = 4096U) {
+        client.reset();
+        client = create_ipc_client(*runtime_client, client_shm_config, {},
+                                   server_shared_memory_configs, {}, {},
+                                   Data_ring_config{data_ring_path(), capacity});
+        start_and_wait_for_client_connection();
+    }
+};
+
+class Gateway_ipc_binding_invalid_data_ring_integration_test
+    : public Gateway_ipc_binding_data_ring_integration_test {
+   protected:
+    // Not a power of two, the client cannot create the ring and only uses the socket
+    Gateway_ipc_binding_invalid_data_ring_integration_test()
+        : Gateway_ipc_binding_data_ring_integration_test(1000U) {}
+};
+
+TEST_F(Gateway_ipc_binding_data_ring_integration_test, ring_exists_while_client_exists) {
+    EXPECT_TRUE(shared_memory_exists(data_ring_path()));
+
+    client.reset();
+    EXPECT_FALSE(shared_memory_exists(data_ring_path()));
+}
+
+TEST_F(Gateway_ipc_binding_invalid_data_ring_integration_test, client_connects_without_ring) {
+    EXPECT_TRUE(client->is_connected());
+    EXPECT_FALSE(shared_memory_exists(data_ring_path()));
+}
+
+template <typename BASE>
+class Gateway_ipc_binding_connected_data_ring_test
+    : public Gateway_ipc_binding_bidirectional_test<BASE> {
+   protected:
+    // Declared first, so they outlive the connectors and their callbacks
+    std::mutex mutex;
+    std::condition_variable received_cv;
+    std::vector<std::byte> received;
+
+    Server_connector_with_callbacks server{this->get_server_runtime(),
+                                           this->socom_server_config, this->instance};
+    Client_connector_with_callbacks client{this->get_client_runtime(),
+                                           this->socom_server_config, this->instance};
+
+    // The payloads are released right away, which sends Payload_consumed messages
+    Gateway_ipc_binding_connected_data_ring_test() {
+        EXPECT_CALL(client.mock_event_update_cb, Call(_, this->event_id, _))
+            .WillRepeatedly([this](auto&, auto, auto payload) {
+                std::lock_guard<std::mutex> const lock{mutex};
+                received.push_back(payload.data()[0]);
+                received_cv.notify_all();
+            });
+    }
+
+    bool wait_for_received(std::size_t count) {
+        std::unique_lock<std::mutex> lock{mutex};
+        return received_cv.wait_for(lock, very_long_timeout,
+                                    [this, count]() { return received.size() >= count; });
+    }
+
+    std::vector<std::byte> received_values() {
+        std::lock_guard<std::mutex> const lock{mutex};
+        return received;
+    }
+
+    /// \brief Waits until the consumer released enough payloads for a new allocation
+    std::optional<socom::Writable_payload> allocate_event_payload() {
+        auto const deadline = std::chrono::steady_clock::now() + very_long_timeout;
+        while (std::chrono::steady_clock::now() < deadline) {
+            auto payload = server.connector->allocate_event_payload(this->event_id);
+            if (payload) {
+                return std::move(*payload);
+            }
+            std::this_thread::sleep_for(1ms);
+        }
+        return std::nullopt;
+    }
+
+    /// \brief Sends count updates one after the other, each released by the consumer before the
+    ///        next one is sent
+    void send_and_receive_event_updates(std::size_t count) {
+        auto const first = received_values().size();
+        for (std::size_t i = 0U; i < count; ++i) {
+            auto payload = allocate_event_payload();
+            ASSERT_TRUE(payload);
+            auto const value = std::byte{static_cast<std::uint8_t>(i)};
+            payload->wdata()[0] = value;
+            ASSERT_TRUE(server.connector->update_event(this->event_id, std::move(*payload)));
+
+            ASSERT_TRUE(wait_for_received(first + i + 1U));
+            EXPECT_EQ(received_values()[first + i], value);
+        }
+    }
+
+    void unsubscribe_event() {
+        std::promise<void> unsubscribed;
+        EXPECT_CALL(server.mock_event_subscription_change_cb,
+                    Call(_, this->event_id, socom::Event_state::unsubscribed))
+            .WillOnce([&unsubscribed](auto&, auto, auto) { unsubscribed.set_value(); });
+
+        ASSERT_TRUE(client.connector->unsubscribe_event(this->event_id));
+        ASSERT_EQ(unsubscribed.get_future().wait_for(very_long_timeout),
+                  std::future_status::ready);
+    }
+};
+
+using Gateway_ipc_binding_connected_data_ring_integration_test =
+    Gateway_ipc_binding_connected_data_ring_test<Gateway_ipc_binding_data_ring_integration_test>;
+using Gateway_ipc_binding_connected_invalid_data_ring_integration_test =
+    Gateway_ipc_binding_connected_data_ring_test<
+        Gateway_ipc_binding_invalid_data_ring_integration_test>;
+
+INSTANTIATE_TEST_SUITE_P(, Gateway_ipc_binding_connected_data_ring_integration_test,
+                         Values(Direction::Client_to_server, Direction::Server_to_client),
+                         readable_test_names);
+INSTANTIATE_TEST_SUITE_P(, Gateway_ipc_binding_connected_invalid_data_ring_integration_test,
+                         Values(Direction::Client_to_server, Direction::Server_to_client),
+                         readable_test_names);
+
+TEST_P(Gateway_ipc_binding_connected_data_ring_integration_test,
+       event_updates_wrap_around_the_ring_in_order) {
+    client.subscribe_event(server.mock_event_subscription_change_cb, event_id);
+
+    // Several times the number of records fitting into a 4 KiB ring
+    send_and_receive_event_updates(300U);
+}
+
+TEST_P(Gateway_ipc_binding_connected_data_ring_integration_test,
+       burst_of_event_updates_is_received_in_order) {
+    client.subscribe_event(server.mock_event_subscription_change_cb, event_id);
+
+    auto const count = get_server_metadata().slot_count;
+    std::vector<std::byte> expected;
+    for (std::size_t i = 0U; i < count; ++i) {
+        auto payload = create_payload(*server.connector, event_id, expected_payload);
+        expected.push_back(std::byte{static_cast<std::uint8_t>(i)});
+        payload.wdata()[0] = expected.back();
+        ASSERT_TRUE(server.connector->update_event(event_id, std::move(payload)));
+    }
+
+    ASSERT_TRUE(wait_for_received(count));
+    EXPECT_EQ(received_values(), expected);
+}
+
+TEST_P(Gateway_ipc_binding_connected_data_ring_integration_test,
+       subscriptions_interleave_with_updates_and_their_consumption) {
+    // Subscribe_event shares the data lane and the dispatch with the Event_update and
+    // Payload_consumed messages, the last consumption of a round is still in flight when the
+    // subscription ends
+    constexpr std::size_t rounds = 20U;
+    constexpr std::size_t updates_per_round = 3U;
+    for (std::size_t round = 0U; round < rounds; ++round) {
+        client.subscribe_event(server.mock_event_subscription_change_cb, event_id);
+        send_and_receive_event_updates(updates_per_round);
+        unsubscribe_event();
+    }
+
+    client.subscribe_event(server.mock_event_subscription_change_cb, event_id);
+    send_and_receive_event_updates(get_server_metadata().slot_count + 1U);
+    EXPECT_EQ(received_values().size(),
+              rounds * updates_per_round + get_server_metadata().slot_count + 1U);
+}
+
+TEST_P(Gateway_ipc_binding_connected_invalid_data_ring_integration_test,
+       event_updates_are_sent_through_the_socket) {
+    client.subscribe_event(server.mock_event_subscription_change_cb, event_id);
+
+    send_and_receive_event_updates(10U);
+}
+
+}  // namespace score::gateway_ipc_binding
@@ -0,0 +1,171 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "score/gateway_ipc_binding/gateway_ipc_binding.hpp"
+#include "test_constants.hpp"
+#include "test_fixtures.hpp"
+#include "util.hpp"
+
+using testing::_;
+using testing::Values;
+using namespace std::chrono_literals;
+
+namespace score::gateway_ipc_binding {
+
+class Gateway_ipc_binding_dispatch_integration_test
+    : public Gateway_ipc_binding_unconnected_integration_test {
+   protected:
+    explicit Gateway_ipc_binding_dispatch_integration_test(Message_batching batching = {}) {
+        client.reset();
+        server = create_ipc_server(*runtime_server, batching, Message_dispatch{4U});
+        client = create_ipc_client(*runtime_client, client_shm_config, {},
+                                   server_shared_memory_configs, {}, batching, {},
+                                   Message_dispatch{4U});
+        start_and_wait_for_client_connection();
+    }
+};
+
+class Gateway_ipc_binding_batched_dispatch_integration_test
+    : public Gateway_ipc_binding_dispatch_integration_test {
+   protected:
+    // Received batches are split up for the workers
+    Gateway_ipc_binding_batched_dispatch_integration_test()
+        : Gateway_ipc_binding_dispatch_integration_test({{4U, 1h}, {4U, 1h}}) {}
+};
+
+template <typename BASE>
+class Gateway_ipc_binding_connected_dispatch_test
+    : public Gateway_ipc_binding_bidirectional_test<BASE> {
+   protected:
+    Server_connector_with_callbacks server{this->get_server_runtime(),
+                                           this->socom_server_config, this->instance};
+    Client_connector_with_callbacks client{this->get_client_runtime(),
+                                           this->socom_server_config, this->instance};
+
+    /// \brief Expects count updates and returns the first payload byte of each in receive order
+    std::future<std::vector<std::byte>> expect_event_updates(std::size_t count) {
+        auto promise = std::make_shared<std::promise<std::vector<std::byte>>>();
+        auto received = std::make_shared<std::vector<std::byte>>();
+        EXPECT_CALL(client.mock_event_update_cb, Call(_, this->event_id, _))
+            .Times(count)
+            .WillRepeatedly([promise, received, count](auto&, auto, auto payload) {
+                received->push_back(payload.data()[0]);
+                if (received->size() == count) {
+                    promise->set_value(*received);
+                }
+            });
+        return promise->get_future();
+    }
+
+    /// \brief Waits until the consumer released enough payloads for a new allocation
+    std::optional<socom::Writable_payload> allocate_event_payload() {
+        auto const deadline = std::chrono::steady_clock::now() + very_long_timeout;
+        while (std::chrono::steady_clock::now() < deadline) {
+            auto payload = server.connector->allocate_event_payload(this->event_id);
+            if (payload) {
+                return std::move(*payload);
+            }
+            std::this_thread::sleep_for(1ms);
+        }
+        return std::nullopt;
+    }
+
+    /// \brief Sends count updates numbered in sending order, reusing released slots
+    std::vector<std::byte> send_event_updates(std::size_t count) {
+        std::vector<std::byte> sent;
+        for (std::size_t i = 0U; i < count; ++i) {
+            auto payload = allocate_event_payload();
+            EXPECT_TRUE(payload);
+            if (!payload) {
+                break;
+            }
+            sent.push_back(std::byte{static_cast<std::uint8_t>(i)});
+            payload->wdata()[0] = sent.back();
+            EXPECT_TRUE(server.connector->update_event(this->event_id, std::move(*payload)));
+        }
+        return sent;
+    }
+};
+
+using Gateway_ipc_binding_connected_dispatch_integration_test =
+    Gateway_ipc_binding_connected_dispatch_test<Gateway_ipc_binding_dispatch_integration_test>;
+using Gateway_ipc_binding_connected_batched_dispatch_integration_test =
+    Gateway_ipc_binding_connected_dispatch_test<
+        Gateway_ipc_binding_batched_dispatch_integration_test>;
+
+INSTANTIATE_TEST_SUITE_P(, Gateway_ipc_binding_connected_dispatch_integration_test,
+                         Values(Direction::Client_to_server, Direction::Server_to_client),
+                         readable_test_names);
+INSTANTIATE_TEST_SUITE_P(, Gateway_ipc_binding_connected_batched_dispatch_integration_test,
+                         Values(Direction::Client_to_server, Direction::Server_to_client),
+                         readable_test_names);
+
+TEST_P(Gateway_ipc_binding_connected_dispatch_integration_test,
+       event_updates_are_received_in_order) {
+    client.subscribe_event(server.mock_event_subscription_change_cb, event_id);
+
+    // More updates than slots, each slot is released by a Payload_consumed handled by a worker
+    auto received = expect_event_updates(100U);
+    auto const sent = send_event_updates(100U);
+
+    ASSERT_EQ(received.wait_for(very_long_timeout), std::future_status::ready);
+    EXPECT_EQ(received.get(), sent);
+}
+
+TEST_P(Gateway_ipc_binding_connected_dispatch_integration_test, method_call_is_replied) {
+    EXPECT_CALL(server.mock_method_call_credentials_cb, Call(_, method_id, _, _, _))
+        .WillOnce([](auto&, auto, auto, auto reply_data, auto const&) {
+            EXPECT_TRUE(reply_data.has_value());
+            reply_data->reply(socom::Application_return{socom::empty_payload()});
+            return socom::Method_invocation::Uptr{};
+        });
+
+    socom::Method_reply_callback_mock mock_method_reply_cb;
+    std::promise<std::size_t> reply_kind;
+    EXPECT_CALL(mock_method_reply_cb, Call(_)).WillOnce([&reply_kind](auto const& result) {
+        reply_kind.set_value(result.index());
+    });
+
+    auto payload = client.connector->allocate_method_call_payload(method_id);
+    ASSERT_TRUE(payload);
+    auto invocation = client.connector->call_method(
+        method_id, std::move(*payload),
+        socom::Method_call_reply_data{mock_method_reply_cb.as_function(), std::nullopt});
+    ASSERT_TRUE(invocation);
+
+    auto result = reply_kind.get_future();
+    ASSERT_EQ(result.wait_for(very_long_timeout), std::future_status::ready);
+    EXPECT_EQ(result.get(), 0U);  // Application_return
+}
+
+TEST_P(Gateway_ipc_binding_connected_batched_dispatch_integration_test,
+       full_batch_is_received_in_order) {
+    client.subscribe_event(server.mock_event_subscription_change_cb, event_id);
+
+    auto received = expect_event_updates(4U);
+    auto const sent = send_event_updates(4U);
+
+    ASSERT_EQ(received.wait_for(very_long_timeout), std::future_status::ready);
+    EXPECT_EQ(received.get(), sent);
+}
+
+}  // namespace score::gateway_ipc_binding
@@ -0,0 +1,256 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "score/gateway_ipc_binding/gateway_ipc_binding.hpp"
+#include "test_constants.hpp"
+#include "test_fixtures.hpp"
+#include "util.hpp"
+
+using testing::_;
+using testing::Values;
+using namespace std::chrono_literals;
+
+namespace score::gateway_ipc_binding {
+
+/// \brief Event updates received by a consumer, which keeps their payloads until released
+class Received_event_updates {
+   public:
+    void add(socom::Payload payload) {
+        // Notified under the lock, the waiting test may destroy this right after it woke up
+        std::lock_guard<std::mutex> const lock{m_mutex};
+        m_values.push_back(payload.data()[0]);
+        m_payloads.push_back(std::move(payload));
+        m_changed.notify_all();
+    }
+
+    bool wait_for_count(std::size_t count, std::chrono::milliseconds timeout = very_long_timeout) {
+        std::unique_lock<std::mutex> lock{m_mutex};
+        return m_changed.wait_for(lock, timeout,
+                                  [this, count]() { return m_values.size() >= count; });
+    }
+
+    /// \brief Consumes all held payloads, which returns their credits to the producer
+    void release() {
+        std::vector<socom::Payload> payloads;
+        {
+            std::lock_guard<std::mutex> const lock{m_mutex};
+            std::swap(payloads, m_payloads);
+        }
+    }
+
+    std::vector<std::byte> values() {
+        std::lock_guard<std::mutex> const lock{m_mutex};
+        return m_values;
+    }
+
+   private:
+    std::mutex m_mutex;
+    std::condition_variable m_changed;
+    std::vector<std::byte> m_values;
+    std::vector<socom::Payload> m_payloads;
+};
+
+class Gateway_ipc_binding_flow_control_integration_test
+    : public Gateway_ipc_binding_unconnected_integration_test {
+   protected:
+    explicit Gateway_ipc_binding_flow_control_integration_test(Flow_control const& flow_control) {
+        client.reset();
+        server = create_ipc_server(*runtime_server, {}, {}, flow_control);
+        client = create_ipc_client(*runtime_client, client_shm_config, {},
+                                   server_shared_memory_configs, {}, {}, {}, {}, flow_control);
+        start_and_wait_for_client_connection();
+    }
+};
+
+class Gateway_ipc_binding_drop_newest_integration_test
+    : public Gateway_ipc_binding_flow_control_integration_test {
+   protected:
+    Gateway_ipc_binding_drop_newest_integration_test()
+        : Gateway_ipc_binding_flow_control_integration_test(
+              {2U, Credit_exhaustion::drop_newest, {}}) {}
+};
+
+class Gateway_ipc_binding_drop_oldest_integration_test
+    : public Gateway_ipc_binding_flow_control_integration_test {
+   protected:
+    // One update in flight and one held back fit into the 4 slots of either side
+    Gateway_ipc_binding_drop_oldest_integration_test()
+        : Gateway_ipc_binding_flow_control_integration_test(
+              {1U, Credit_exhaustion::drop_oldest, {}}) {}
+};
+
+class Gateway_ipc_binding_block_integration_test
+    : public Gateway_ipc_binding_flow_control_integration_test {
+   protected:
+    static constexpr std::chrono::milliseconds block_timeout{200};
+
+    Gateway_ipc_binding_block_integration_test()
+        : Gateway_ipc_binding_flow_control_integration_test(
+              {1U, Credit_exhaustion::block, block_timeout}) {}
+};
+
+/// \brief Leaves a blocked producer waiting long enough for other work with the binding
+class Gateway_ipc_binding_long_block_integration_test
+    : public Gateway_ipc_binding_flow_control_integration_test {
+   protected:
+    static constexpr std::chrono::seconds block_timeout{10};
+
+    Gateway_ipc_binding_long_block_integration_test()
+        : Gateway_ipc_binding_flow_control_integration_test(
+              {1U, Credit_exhaustion::block, block_timeout}) {}
+};
+
+template <typename BASE>
+class Gateway_ipc_binding_connected_flow_control_test
+    : public Gateway_ipc_binding_bidirectional_test<BASE> {
+   protected:
+    /// \brief Not subscribed initially
+    Event_id const other_event_id{1};
+    socom::Server_service_interface_definition const configuration{
+        this->interface, socom::to_num_of_methods(1), socom::to_num_of_events(2)};
+    Server_connector_with_callbacks server{this->get_server_runtime(), configuration,
+                                           this->instance};
+    Client_connector_with_callbacks client{this->get_client_runtime(), configuration,
+                                           this->instance};
+    Received_event_updates received;
+
+    Gateway_ipc_binding_connected_flow_control_test() {
+        EXPECT_CALL(client.mock_event_update_cb, Call(_, this->event_id, _))
+            .WillRepeatedly(
+                [this](auto&, auto, auto payload) { received.add(std::move(payload)); });
+        client.subscribe_event(server.mock_event_subscription_change_cb, this->event_id);
+    }
+
+    void update_event(std::uint8_t value) {
+        auto payload_handle = create_payload(*server.connector, this->event_id, expected_payload);
+        payload_handle.wdata()[0] = std::byte{value};
+        ASSERT_TRUE(server.connector->update_event(this->event_id, std::move(payload_handle)));
+    }
+};
+
+using Gateway_ipc_binding_connected_drop_newest_integration_test =
+    Gateway_ipc_binding_connected_flow_control_test<
+        Gateway_ipc_binding_drop_newest_integration_test>;
+using Gateway_ipc_binding_connected_drop_oldest_integration_test =
+    Gateway_ipc_binding_connected_flow_control_test<
+        Gateway_ipc_binding_drop_oldest_integration_test>;
+using Gateway_ipc_binding_connected_block_integration_test =
+    Gateway_ipc_binding_connected_flow_control_test<Gateway_ipc_binding_block_integration_test>;
+using Gateway_ipc_binding_connected_long_block_integration_test =
+    Gateway_ipc_binding_connected_flow_control_test<
+        Gateway_ipc_binding_long_block_integration_test>;
+
+INSTANTIATE_TEST_SUITE_P(, Gateway_ipc_binding_connected_drop_newest_integration_test,
+                         Values(Direction::Client_to_server, Direction::Server_to_client),
+                         readable_test_names);
+INSTANTIATE_TEST_SUITE_P(, Gateway_ipc_binding_connected_drop_oldest_integration_test,
+                         Values(Direction::Client_to_server, Direction::Server_to_client),
+                         readable_test_names);
+INSTANTIATE_TEST_SUITE_P(, Gateway_ipc_binding_connected_block_integration_test,
+                         Values(Direction::Client_to_server, Direction::Server_to_client),
+                         readable_test_names);
+INSTANTIATE_TEST_SUITE_P(, Gateway_ipc_binding_connected_long_block_integration_test,
+                         Values(Direction::Client_to_server, Direction::Server_to_client),
+                         readable_test_names);
+
+TEST_P(Gateway_ipc_binding_connected_drop_newest_integration_test,
+       updates_without_credit_are_dropped_until_payloads_are_consumed) {
+    update_event(0U);
+    update_event(1U);
+    ASSERT_TRUE(received.wait_for_count(2U));
+
+    update_event(2U);
+    EXPECT_FALSE(received.wait_for_count(3U, 20ms));
+
+    // Credits return asynchronously, updates sent before that are dropped as well
+    received.release();
+    for (std::uint8_t value = 3U; value < 200U && !received.wait_for_count(3U, 1ms); ++value) {
+        update_event(value);
+    }
+    ASSERT_TRUE(received.wait_for_count(3U));
+
+    auto const values = received.values();
+    EXPECT_EQ(values[0], std::byte{0U});
+    EXPECT_EQ(values[1], std::byte{1U});
+    EXPECT_GE(values[2], std::byte{3U});
+}
+
+TEST_P(Gateway_ipc_binding_connected_drop_oldest_integration_test,
+       newest_held_back_update_is_sent_once_payload_is_consumed) {
+    update_event(0U);
+    ASSERT_TRUE(received.wait_for_count(1U));
+
+    // Each update replaces the one held back before it
+    update_event(1U);
+    update_event(2U);
+    update_event(3U);
+    EXPECT_FALSE(received.wait_for_count(2U, 20ms));
+
+    received.release();
+    ASSERT_TRUE(received.wait_for_count(2U));
+    EXPECT_EQ(received.values(), (std::vector<std::byte>{std::byte{0U}, std::byte{3U}}));
+}
+
+TEST_P(Gateway_ipc_binding_connected_block_integration_test,
+       producer_waits_for_credit_until_timeout) {
+    update_event(0U);
+    ASSERT_TRUE(received.wait_for_count(1U));
+
+    auto const start = std::chrono::steady_clock::now();
+    update_event(1U);
+    EXPECT_GE(std::chrono::steady_clock::now() - start, block_timeout);
+    EXPECT_FALSE(received.wait_for_count(2U, 20ms));
+
+    std::thread consumer{[this]() {
+        std::this_thread::sleep_for(10ms);
+        received.release();
+    }};
+    update_event(2U);
+    consumer.join();
+
+    ASSERT_TRUE(received.wait_for_count(2U));
+    EXPECT_EQ(received.values(), (std::vector<std::byte>{std::byte{0U}, std::byte{2U}}));
+}
+
+TEST_P(Gateway_ipc_binding_connected_long_block_integration_test,
+       subscription_is_handled_while_producer_waits_for_credit) {
+    update_event(0U);
+    ASSERT_TRUE(received.wait_for_count(1U));
+
+    // The producer's binding handles the subscription under its exclusive lock, the credit is
+    // returned only after it
+    std::thread subscriber{[this]() {
+        std::this_thread::sleep_for(10ms);
+        client.subscribe_event(server.mock_event_subscription_change_cb, other_event_id);
+        received.release();
+    }};
+    auto const start = std::chrono::steady_clock::now();
+    update_event(1U);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, block_timeout);
+    subscriber.join();
+
+    ASSERT_TRUE(received.wait_for_count(2U, block_timeout));
+    EXPECT_EQ(received.values(), (std::vector<std::byte>{std::byte{0U}, std::byte{1U}}));
+}
+
+}  // namespace score::gateway_ipc_binding
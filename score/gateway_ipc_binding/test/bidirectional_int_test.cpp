@@ -16,6 +16,7 @@
 
 #include <cstddef>
 #include <future>
+#include <optional>
 #include <thread>
 
 #include "score/gateway_ipc_binding/error.hpp"
@@ -349,4 +350,150 @@ TEST_P(Gateway_ipc_binding_connected_bidirectional_integration_test,
         .Times(AtMost(1));
 }
 
+Shared_memory_metadata with_consumer_counts(Shared_memory_metadata metadata) {
+    metadata.consumer_release = Consumer_release::shared_memory_consumer_count;
+    return metadata;
+}
+
+class Gateway_ipc_binding_consumer_count_integration_test
+    : public Gateway_ipc_binding_unconnected_integration_test {
+   protected:
+    Shared_memory_metadata const client_metadata =
+        with_consumer_counts(make_metadata("/gw_client_counted_shm", 256, 8));
+    Shared_memory_metadata const server_metadata =
+        with_consumer_counts(make_metadata("/gw_server_counted_shm", 512, 4));
+
+    Gateway_ipc_binding_consumer_count_integration_test() {
+        client = create_ipc_client(
+            *runtime_client, {{interface, {{instance, client_metadata}}}}, {},
+            make_shared_memory_configs({{interface, {{instance, server_metadata}}}}));
+        start_and_wait_for_client_connection();
+    }
+};
+
+class Gateway_ipc_binding_connected_consumer_count_integration_test
+    : public Gateway_ipc_binding_bidirectional_test<
+          Gateway_ipc_binding_consumer_count_integration_test> {
+   protected:
+    Server_connector_with_callbacks server{get_server_runtime(), socom_server_config, instance};
+    Client_connector_with_callbacks client{get_client_runtime(), socom_server_config, instance};
+};
+
+INSTANTIATE_TEST_SUITE_P(, Gateway_ipc_binding_connected_consumer_count_integration_test,
+                         Values(Direction::Client_to_server, Direction::Server_to_client),
+                         readable_test_names);
+
+TEST_P(Gateway_ipc_binding_connected_consumer_count_integration_test,
+       consumed_event_payload_is_reclaimed_without_ipc) {
+    client.subscribe_event(server.mock_event_subscription_change_cb, event_id);
+
+    std::vector<socom::Payload> payload_handles;
+
+    for (std::size_t i = 0; i < get_server_metadata().slot_count; ++i) {
+        auto payload_handle = create_payload(*server.connector, event_id, expected_payload);
+        payload_handle.wdata()[0] = std::byte{static_cast<std::uint8_t>(i)};
+
+        std::promise<socom::Payload> event_update_received_promise;
+        EXPECT_CALL(client.mock_event_update_cb, Call(_, event_id, _))
+            .Times(1)
+            .WillOnce([&event_update_received_promise](auto&, auto, auto payload) {
+                event_update_received_promise.set_value(std::move(payload));
+            });
+        auto update_result = server.connector->update_event(event_id, std::move(payload_handle));
+        ASSERT_TRUE(update_result);
+
+        auto payload_future = event_update_received_promise.get_future();
+        ASSERT_EQ(payload_future.wait_for(very_long_timeout), std::future_status::ready);
+
+        auto received_payload = payload_future.get();
+        EXPECT_EQ(received_payload.data()[0], std::byte{static_cast<std::uint8_t>(i)});
+        payload_handles.push_back(std::move(received_payload));
+    }
+
+    EXPECT_EQ(
+        server.connector->allocate_event_payload(event_id),
+        MakeUnexpected(
+            gateway_ipc_binding::Shared_memory_manager_error::runtime_error_no_available_slots));
+
+    // The consumer count in shared memory is decremented synchronously, so the slot is available
+    // again without waiting for a Payload_consumed message
+    payload_handles.erase(std::begin(payload_handles));
+    EXPECT_TRUE(server.connector->allocate_event_payload(event_id));
+}
+
+Shared_memory_metadata with_conflated_event(Shared_memory_metadata metadata, Event_id event_id) {
+    metadata.conflated_events.size = event_id + 1U;
+    metadata.conflated_events.data[event_id] = true;
+    return metadata;
+}
+
+class Gateway_ipc_binding_conflation_integration_test
+    : public Gateway_ipc_binding_unconnected_integration_test {
+   protected:
+    Shared_memory_metadata const client_metadata =
+        with_conflated_event(make_metadata("/gw_client_conflated_shm", 256, 8), event_id);
+    Shared_memory_metadata const server_metadata =
+        with_conflated_event(make_metadata("/gw_server_conflated_shm", 512, 4), event_id);
+
+    Gateway_ipc_binding_conflation_integration_test() {
+        client = create_ipc_client(
+            *runtime_client, {{interface, {{instance, client_metadata}}}}, {},
+            make_shared_memory_configs({{interface, {{instance, server_metadata}}}}));
+        start_and_wait_for_client_connection();
+    }
+};
+
+class Gateway_ipc_binding_connected_conflation_integration_test
+    : public Gateway_ipc_binding_bidirectional_test<
+          Gateway_ipc_binding_conflation_integration_test> {
+   protected:
+    Server_connector_with_callbacks server{get_server_runtime(), socom_server_config, instance};
+    Client_connector_with_callbacks client{get_client_runtime(), socom_server_config, instance};
+
+    void update_event(std::uint8_t value) {
+        auto payload_handle = create_payload(*server.connector, event_id, expected_payload);
+        payload_handle.wdata()[0] = std::byte{value};
+        ASSERT_TRUE(server.connector->update_event(event_id, std::move(payload_handle)));
+    }
+};
+
+INSTANTIATE_TEST_SUITE_P(, Gateway_ipc_binding_connected_conflation_integration_test,
+                         Values(Direction::Client_to_server, Direction::Server_to_client),
+                         readable_test_names);
+
+TEST_P(Gateway_ipc_binding_connected_conflation_integration_test,
+       latest_update_is_delivered_once_the_previous_one_is_consumed) {
+    client.subscribe_event(server.mock_event_subscription_change_cb, event_id);
+
+    std::promise<socom::Payload> first_update;
+    std::promise<socom::Payload> latest_update;
+    EXPECT_CALL(client.mock_event_update_cb, Call(_, event_id, _))
+        .Times(2)
+        .WillOnce([&first_update](auto&, auto, auto payload) {
+            first_update.set_value(std::move(payload));
+        })
+        .WillOnce([&latest_update](auto&, auto, auto payload) {
+            latest_update.set_value(std::move(payload));
+        });
+
+    update_event(0U);
+    auto first_future = first_update.get_future();
+    ASSERT_EQ(first_future.wait_for(very_long_timeout), std::future_status::ready);
+    auto first = std::make_optional(first_future.get());
+    EXPECT_EQ(first->data()[0], std::byte{0U});
+
+    // Many more updates than slots, each one replaces the one held back before it
+    auto const update_count = 4U * get_server_metadata().slot_count;
+    for (std::size_t i = 1U; i <= update_count; ++i) {
+        update_event(static_cast<std::uint8_t>(i));
+    }
+
+    auto latest_future = latest_update.get_future();
+    EXPECT_EQ(latest_future.wait_for(20ms), std::future_status::timeout);
+
+    first.reset();
+    ASSERT_EQ(latest_future.wait_for(very_long_timeout), std::future_status::ready);
+    EXPECT_EQ(latest_future.get().data()[0], std::byte{static_cast<std::uint8_t>(update_count)});
+}
+
 }  // namespace score::gateway_ipc_binding
@@ -0,0 +1,252 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "score/gateway_ipc_binding/gateway_ipc_binding.hpp"
+#include "test_constants.hpp"
+#include "test_fixtures.hpp"
+#include "util.hpp"
+
+using testing::_;
+using testing::Values;
+
+namespace score::gateway_ipc_binding {
+
+namespace {
+
+std::vector<std::byte> const expected_reply{std::byte{9}, std::byte{8}, std::byte{7}};
+
+std::vector<std::byte> to_vector(socom::Payload const& payload) {
+    auto const data = payload.data();
+    return {data.begin(), data.end()};
+}
+
+void write(socom::Writable_payload& payload, std::vector<std::byte> const& data) {
+    ASSERT_GE(payload.wdata().size(), data.size());
+    std::copy(data.begin(), data.end(), payload.wdata().data());
+    ASSERT_TRUE(payload.shrink(data.size()));
+}
+
+/// \brief Copy of a socom::Method_result, which cannot be passed on itself
+struct Received_reply {
+    std::size_t kind;
+    socom::Application_error::Code code{0};
+    std::optional<socom::Error> error;
+    std::vector<std::byte> payload;
+};
+
+Received_reply to_received_reply(socom::Method_result const& result) {
+    Received_reply reply{result.index(), 0, std::nullopt, {}};
+    if (auto const* const ret = std::get_if<socom::Application_return>(&result)) {
+        reply.payload = to_vector(ret->payload);
+    } else if (auto const* const error = std::get_if<socom::Application_error>(&result)) {
+        reply.code = error->code;
+        reply.payload = to_vector(error->payload);
+    } else {
+        reply.error = std::get<socom::Error>(result);
+    }
+    return reply;
+}
+
+constexpr std::size_t k_application_return = 0U;
+constexpr std::size_t k_application_error = 1U;
+constexpr std::size_t k_error = 2U;
+
+class Test_method_invocation final : public socom::Method_invocation {
+   public:
+    explicit Test_method_invocation(std::function<void()> on_destruction)
+        : m_on_destruction(std::move(on_destruction)) {}
+
+    ~Test_method_invocation() override { m_on_destruction(); }
+
+    Test_method_invocation(Test_method_invocation const&) = delete;
+    Test_method_invocation(Test_method_invocation&&) = delete;
+    Test_method_invocation& operator=(Test_method_invocation const&) = delete;
+    Test_method_invocation& operator=(Test_method_invocation&&) = delete;
+
+   private:
+    std::function<void()> m_on_destruction;
+};
+
+}  // namespace
+
+class Gateway_ipc_binding_method_call_integration_test
+    : public Gateway_ipc_binding_bidirectional_test<Gateway_ipc_binding_integration_test> {
+   protected:
+    Server_connector_with_callbacks server{get_server_runtime(), socom_server_config, instance};
+    Client_connector_with_callbacks client{get_client_runtime(), socom_server_config, instance};
+    socom::Method_reply_callback_mock mock_method_reply_cb;
+
+    socom::Writable_payload allocate_request(std::vector<std::byte> const& data) {
+        auto payload = client.connector->allocate_method_call_payload(method_id);
+        EXPECT_TRUE(payload);
+        write(*payload, data);
+        return std::move(*payload);
+    }
+
+    std::future<Received_reply> expect_reply() {
+        auto promise = std::make_shared<std::promise<Received_reply>>();
+        EXPECT_CALL(mock_method_reply_cb, Call(_)).WillOnce([promise](auto const& result) {
+            promise->set_value(to_received_reply(result));
+        });
+        return promise->get_future();
+    }
+
+    socom::Method_call_reply_data make_reply_data() {
+        return socom::Method_call_reply_data{mock_method_reply_cb.as_function(), std::nullopt};
+    }
+};
+
+INSTANTIATE_TEST_SUITE_P(, Gateway_ipc_binding_method_call_integration_test,
+                         Values(Direction::Client_to_server, Direction::Server_to_client),
+                         readable_test_names);
+
+TEST_P(Gateway_ipc_binding_method_call_integration_test, request_and_reply_payloads_are_passed) {
+    std::vector<std::byte> received_request;
+    EXPECT_CALL(server.mock_method_call_credentials_cb, Call(_, method_id, _, _, _))
+        .WillOnce([&received_request](auto&, auto, auto payload, auto reply_data, auto const&) {
+            received_request = to_vector(payload);
+            EXPECT_TRUE(reply_data.has_value());
+            auto& reply_payload = reply_data->get_reply_payload();
+            EXPECT_TRUE(reply_payload.has_value());
+            write(*reply_payload, expected_reply);
+            reply_data->reply(socom::Application_return{std::move(*reply_payload)});
+            return socom::Method_invocation::Uptr{};
+        });
+
+    auto reply = expect_reply();
+    auto invocation = client.connector->call_method(method_id, allocate_request(expected_payload),
+                                                    make_reply_data());
+    ASSERT_TRUE(invocation);
+
+    ASSERT_EQ(reply.wait_for(very_long_timeout), std::future_status::ready);
+    auto const result = reply.get();
+    EXPECT_EQ(result.kind, k_application_return);
+    EXPECT_EQ(result.payload, expected_reply);
+    EXPECT_EQ(received_request, expected_payload);
+}
+
+TEST_P(Gateway_ipc_binding_method_call_integration_test, payload_outside_shared_memory_is_copied) {
+    std::vector<std::byte> request = expected_payload;
+    std::vector<std::byte> received_request;
+    EXPECT_CALL(server.mock_method_call_credentials_cb, Call(_, method_id, _, _, _))
+        .WillOnce([&received_request](auto&, auto, auto payload, auto reply_data, auto const&) {
+            received_request = to_vector(payload);
+            reply_data->reply(socom::Application_return{});
+            return socom::Method_invocation::Uptr{};
+        });
+
+    auto reply = expect_reply();
+    auto invocation = client.connector->call_method(
+        method_id,
+        socom::Payload{socom::Payload::Writable_span{request.data(), request.size()},
+                       socom::kNoSlotHandle, []() {}},
+        make_reply_data());
+    ASSERT_TRUE(invocation);
+
+    ASSERT_EQ(reply.wait_for(very_long_timeout), std::future_status::ready);
+    auto const result = reply.get();
+    EXPECT_EQ(result.kind, k_application_return);
+    EXPECT_TRUE(result.payload.empty());
+    EXPECT_EQ(received_request, expected_payload);
+}
+
+TEST_P(Gateway_ipc_binding_method_call_integration_test, application_error_is_passed) {
+    EXPECT_CALL(server.mock_method_call_credentials_cb, Call(_, method_id, _, _, _))
+        .WillOnce([](auto&, auto, auto, auto reply_data, auto const&) {
+            auto& reply_payload = reply_data->get_reply_payload();
+            write(*reply_payload, expected_reply);
+            reply_data->reply(socom::Application_error{42, std::move(*reply_payload)});
+            return socom::Method_invocation::Uptr{};
+        });
+
+    auto reply = expect_reply();
+    auto invocation = client.connector->call_method(method_id, allocate_request(expected_payload),
+                                                    make_reply_data());
+    ASSERT_TRUE(invocation);
+
+    ASSERT_EQ(reply.wait_for(very_long_timeout), std::future_status::ready);
+    auto const result = reply.get();
+    EXPECT_EQ(result.kind, k_application_error);
+    EXPECT_EQ(result.code, 42);
+    EXPECT_EQ(result.payload, expected_reply);
+}
+
+TEST_P(Gateway_ipc_binding_method_call_integration_test, error_is_passed) {
+    EXPECT_CALL(server.mock_method_call_credentials_cb, Call(_, method_id, _, _, _))
+        .WillOnce([](auto&, auto, auto, auto reply_data, auto const&) {
+            reply_data->reply(socom::Error::runtime_error_permission_not_allowed);
+            return socom::Method_invocation::Uptr{};
+        });
+
+    auto reply = expect_reply();
+    auto invocation = client.connector->call_method(method_id, allocate_request(expected_payload),
+                                                    make_reply_data());
+    ASSERT_TRUE(invocation);
+
+    ASSERT_EQ(reply.wait_for(very_long_timeout), std::future_status::ready);
+    auto const result = reply.get();
+    EXPECT_EQ(result.kind, k_error);
+    EXPECT_EQ(result.error, socom::Error::runtime_error_permission_not_allowed);
+}
+
+TEST_P(Gateway_ipc_binding_method_call_integration_test, fire_and_forget_call_is_passed) {
+    std::promise<std::vector<std::byte>> received_request;
+    EXPECT_CALL(server.mock_method_call_credentials_cb, Call(_, method_id, _, _, _))
+        .WillOnce([&received_request](auto&, auto, auto payload, auto reply_data, auto const&) {
+            EXPECT_FALSE(reply_data.has_value());
+            received_request.set_value(to_vector(payload));
+            return socom::Method_invocation::Uptr{};
+        });
+
+    auto invocation = client.connector->call_method(method_id, allocate_request(expected_payload),
+                                                    std::nullopt);
+    ASSERT_TRUE(invocation);
+
+    auto received = received_request.get_future();
+    ASSERT_EQ(received.wait_for(very_long_timeout), std::future_status::ready);
+    EXPECT_EQ(received.get(), expected_payload);
+}
+
+TEST_P(Gateway_ipc_binding_method_call_integration_test, destroying_invocation_cancels_call) {
+    std::promise<void> call_received;
+    std::promise<void> call_cancelled;
+    EXPECT_CALL(server.mock_method_call_credentials_cb, Call(_, method_id, _, _, _))
+        .WillOnce([&call_received, &call_cancelled](auto&, auto, auto, auto, auto const&) {
+            call_received.set_value();
+            return std::make_unique<Test_method_invocation>(
+                [&call_cancelled]() { call_cancelled.set_value(); });
+        });
+    EXPECT_CALL(mock_method_reply_cb, Call(_)).Times(0);
+
+    auto invocation = client.connector->call_method(method_id, allocate_request(expected_payload),
+                                                    make_reply_data());
+    ASSERT_TRUE(invocation);
+    ASSERT_EQ(call_received.get_future().wait_for(very_long_timeout), std::future_status::ready);
+
+    invocation->reset();
+    EXPECT_EQ(call_cancelled.get_future().wait_for(very_long_timeout), std::future_status::ready);
+}
+
+}  // namespace score::gateway_ipc_binding
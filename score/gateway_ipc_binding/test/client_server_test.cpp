@@ -13,8 +13,12 @@
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <poll.h>
+#include <unistd.h>
 
+#include <array>
 #include <cstddef>
+#include <cstdint>
 #include <future>
 #include <string>
 #include <thread>
@@ -100,6 +104,39 @@ TEST_F(Gateway_ipc_binding_unconnected_test, connect) {
     }
 }
 
+TEST_F(Gateway_ipc_binding_unconnected_test, wait_for_state_times_out_without_server) {
+    EXPECT_EQ(client->get_state(), Client_state::connecting);
+    EXPECT_FALSE(client->wait_for_state(Client_state::connected, 10ms));
+    EXPECT_FALSE(client->is_connected());
+}
+
+TEST_F(Gateway_ipc_binding_unconnected_test, state_fd_becomes_readable_on_connection) {
+    auto const state_fd = client->get_state_fd();
+    ASSERT_GE(state_fd, 0);
+    pollfd poll_fd{state_fd, POLLIN, 0};
+    EXPECT_EQ(::poll(&poll_fd, 1U, 0), 0);
+
+    ASSERT_TRUE(server->start());
+
+    ASSERT_EQ(::poll(&poll_fd, 1U, static_cast<int>(very_long_timeout.count() * 1000)), 1);
+    EXPECT_EQ(client->get_state(), Client_state::connected);
+    EXPECT_TRUE(client->is_connected());
+
+    // Reading clears the descriptor until the next state change
+    std::array<std::uint8_t, 16U> buffer{};
+    EXPECT_GT(::read(state_fd, buffer.data(), buffer.size()), 0);
+    EXPECT_EQ(::poll(&poll_fd, 1U, 0), 0);
+}
+
+TEST_F(Gateway_ipc_binding_unconnected_test, state_returns_to_connecting_when_server_is_gone) {
+    ASSERT_TRUE(server->start());
+    ASSERT_TRUE(client->wait_for_state(Client_state::connected, very_long_timeout));
+
+    server.reset();
+    EXPECT_TRUE(client->wait_for_state(Client_state::connecting, very_long_timeout));
+    EXPECT_FALSE(client->is_connected());
+}
+
 class Gateway_ipc_binding_test : public Gateway_ipc_binding_unconnected_test {
    protected:
     socom::Service_state_change_callback_mock mock_service_state_change_cb;
@@ -346,6 +383,33 @@ TEST_P(Gateway_ipc_binding_param_test, server_allocates_event_payload) {
     testing::Mock::VerifyAndClearExpectations(&get_server_slot_manager());
 }
 
+TEST_P(Gateway_ipc_binding_param_test, server_allocates_event_payload_with_configured_size) {
+    auto [client_connector, server_connector] =
+        create_connected_connectors(get_client_runtime(), get_server_runtime());
+
+    subscribe_event(*client_connector);
+
+    constexpr std::uint32_t event_size = 16U;
+    std::vector<std::byte> server_memory(event_size, std::byte{0});
+
+    auto slot_guard = get_server_slot_manager().create_slot_guard(Slot_handle(0), server_memory);
+
+    EXPECT_CALL(get_server_slot_manager(), get_event_slot_sizes())
+        .WillRepeatedly(Return(Event_slot_sizes{event_size}));
+    EXPECT_CALL(get_server_slot_manager(), allocate_slot(std::size_t{event_size}))
+        .WillOnce(Return(Result<Shared_memory_slot_guard>(std::move(slot_guard))));
+
+    {
+        auto payload_handle = server_connector->allocate_event_payload(event_id);
+        ASSERT_TRUE(payload_handle);
+        EXPECT_EQ(payload_handle->data().size(), event_size);
+
+        EXPECT_CALL(get_server_slot_manager(), release_slot(Slot_handle(0)))
+            .WillOnce(Return(Result<void>()));
+    }
+    testing::Mock::VerifyAndClearExpectations(&get_server_slot_manager());
+}
+
 TEST_P(Gateway_ipc_binding_param_test, server_sends_event_update) {
     auto [client_connector, server_connector] =
         create_connected_connectors(get_client_runtime(), get_server_runtime());
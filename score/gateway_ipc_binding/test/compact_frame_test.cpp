@@ -0,0 +1,267 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "../impl/compact_frame.hpp"
+#include "score/gateway_ipc_binding/fixed_size_container.hpp"
+#include "score/gateway_ipc_binding/gateway_ipc_binding.hpp"
+
+namespace score::gateway_ipc_binding {
+namespace {
+
+template <typename Target_type>
+Fixed_string<Target_type::max_size> make_string(std::string const& value) {
+    auto result = fixed_string_from_string<Target_type>(value);
+    EXPECT_TRUE(result);
+    return result ? *result : Fixed_string<Target_type::max_size>{};
+}
+
+Service make_test_service(std::string const& name) {
+    return Service{make_string<Service_id>(name), {1U, 2U}};
+}
+
+Shared_memory_metadata make_metadata() {
+    Shared_memory_metadata metadata{};
+    metadata.path = make_string<Shared_memory_path>("/compact_frame_test");
+    metadata.slot_size = 4096U;
+    metadata.slot_count = 300U;
+    metadata.slot_classes = {Slot_class{64U, 16U}, Slot_class{1U << 20U, 2U}};
+    metadata.event_slot_sizes = {0U, 64U, 1U << 20U};
+    metadata.consumer_release = Consumer_release::shared_memory_consumer_count;
+    metadata.conflated_events = {false, true};
+    return metadata;
+}
+
+template <typename Msg_type>
+std::optional<Msg_type> decode(Compact_frame const& frame) {
+    return decode_compact_frame<Msg_type>({frame.data(), frame.size()});
+}
+
+/// \brief Frame of type with payload, without any check of the payload
+Compact_frame make_frame(Message_type type, std::vector<std::uint8_t> const& payload) {
+    Compact_frame frame(sizeof(Message_frame_header), std::uint8_t{0U});
+    frame[offsetof(Message_frame_header, type)] = static_cast<std::uint8_t>(type);
+    auto const size = static_cast<std::uint16_t>(payload.size());
+    std::memcpy(&frame[offsetof(Message_frame_header, payload_size)], &size, sizeof(size));
+    frame.insert(frame.end(), payload.begin(), payload.end());
+    return frame;
+}
+
+std::vector<std::uint8_t> payload_of(Compact_frame const& frame) {
+    return {frame.begin() + sizeof(Message_frame_header), frame.end()};
+}
+
+TEST(Compact_frame_test, connect_round_trip) {
+    Connect msg{};
+    msg.find_service_elements = {Service_instance{make_test_service("a/Service"),
+                                                  make_string<Instance_id>("1")},
+                                 Service_instance{make_test_service("b/Service"),
+                                                  make_string<Instance_id>("22")}};
+    msg.shared_memory_configs = {Service_shared_memory_config{
+        make_test_service("a/Service"), make_string<Instance_id>("1"), make_metadata()}};
+    msg.identifier = make_string<Client_identifier>("compact_frame_test");
+    msg.data_ring_path = make_string<Shared_memory_path>("/data_ring");
+    msg.data_ring_capacity = 1U << 16U;
+    msg.complete = true;
+
+    auto const decoded = decode<Connect>(encode_compact_frame(msg));
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(decoded->find_service_elements, msg.find_service_elements);
+    EXPECT_EQ(decoded->shared_memory_configs, msg.shared_memory_configs);
+    EXPECT_EQ(decoded->identifier, msg.identifier);
+    EXPECT_EQ(decoded->data_ring_path, msg.data_ring_path);
+    EXPECT_EQ(decoded->data_ring_capacity, msg.data_ring_capacity);
+    EXPECT_TRUE(decoded->complete);
+}
+
+TEST(Compact_frame_test, connect_continuation_round_trip) {
+    Connect_continuation msg{};
+    msg.find_service_elements = {Service_instance{make_test_service("c/Service"),
+                                                  make_string<Instance_id>("3")}};
+    msg.complete = false;
+
+    auto const decoded = decode<Connect_continuation>(encode_compact_frame(msg));
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(decoded->find_service_elements, msg.find_service_elements);
+    EXPECT_TRUE(decoded->shared_memory_configs.empty());
+    EXPECT_FALSE(decoded->complete);
+}
+
+TEST(Compact_frame_test, declare_service_round_trip) {
+    Declare_service const msg{0xFFFF'FFFFU, make_test_service("d/Service"),
+                              make_string<Instance_id>("4")};
+
+    auto const decoded = decode<Declare_service>(encode_compact_frame(msg));
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(decoded->service_key, msg.service_key);
+    EXPECT_EQ(decoded->service_id, msg.service_id);
+    EXPECT_EQ(decoded->instance_id, msg.instance_id);
+}
+
+TEST(Compact_frame_test, service_snapshot_round_trip) {
+    Service_snapshot msg{};
+    msg.services = {
+        Service_snapshot_entry{7U, make_test_service("e/Service"), make_string<Instance_id>("5"),
+                               true, false},
+        Service_snapshot_entry{8U, make_test_service("f/Service"), make_string<Instance_id>("6"),
+                               false, true}};
+    msg.complete = true;
+
+    auto const decoded = decode<Service_snapshot>(encode_compact_frame(msg));
+    ASSERT_TRUE(decoded.has_value());
+    ASSERT_EQ(decoded->services.size, 2U);
+    for (std::size_t i = 0U; i < msg.services.size; ++i) {
+        auto const& expected = msg.services.data[i];
+        auto const& entry = decoded->services.data[i];
+        EXPECT_EQ(entry.service_key, expected.service_key);
+        EXPECT_EQ(entry.service_id, expected.service_id);
+        EXPECT_EQ(entry.instance_id, expected.instance_id);
+        EXPECT_EQ(entry.requested, expected.requested);
+        EXPECT_EQ(entry.offered, expected.offered);
+    }
+    EXPECT_TRUE(decoded->complete);
+}
+
+TEST(Compact_frame_test, connect_service_round_trip) {
+    Connect_service const msg{9U, 0x1234'5678'9ABC'DEF0U, make_metadata(), true};
+
+    auto const decoded = decode<Connect_service>(encode_compact_frame(msg));
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(decoded->service_key, msg.service_key);
+    EXPECT_EQ(decoded->required_id, msg.required_id);
+    EXPECT_EQ(decoded->metadata, msg.metadata);
+    EXPECT_TRUE(decoded->in_use);
+}
+
+TEST(Compact_frame_test, connect_service_reply_round_trip) {
+    Connect_service_reply const msg{1U, 2U, make_metadata(), 3U, 0xFFFFU};
+
+    auto const decoded = decode<Connect_service_reply>(encode_compact_frame(msg));
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(decoded->required_id, msg.required_id);
+    EXPECT_EQ(decoded->provided_id, msg.provided_id);
+    EXPECT_EQ(decoded->metadata, msg.metadata);
+    EXPECT_EQ(decoded->num_methods, msg.num_methods);
+    EXPECT_EQ(decoded->num_events, msg.num_events);
+}
+
+TEST(Compact_frame_test, frame_of_other_type_is_rejected) {
+    auto const frame = encode_compact_frame(Declare_service{1U, make_test_service("g/Service"),
+                                                            make_string<Instance_id>("7")});
+    EXPECT_FALSE(decode<Service_snapshot>(frame).has_value());
+    EXPECT_FALSE(decode<Connect_service>(frame).has_value());
+}
+
+TEST(Compact_frame_test, frame_shorter_than_its_header_or_payload_size_is_rejected) {
+    auto frame = encode_compact_frame(Declare_service{1U, make_test_service("h/Service"),
+                                                      make_string<Instance_id>("8")});
+    EXPECT_FALSE(decode<Declare_service>(Compact_frame(frame.begin(), frame.begin() + 1))
+                     .has_value());
+
+    frame.pop_back();
+    EXPECT_FALSE(decode<Declare_service>(frame).has_value());
+}
+
+TEST(Compact_frame_test, truncated_varint_is_rejected) {
+    // 300 takes two bytes, the second one is missing
+    EXPECT_FALSE(decode<Declare_service>(make_frame(Message_type::Declare_service, {0xACU}))
+                     .has_value());
+}
+
+TEST(Compact_frame_test, varint_longer_than_64_bits_is_rejected) {
+    std::vector<std::uint8_t> payload(11U, 0xFFU);
+    payload.push_back(0x01U);
+    EXPECT_FALSE(decode<Declare_service>(make_frame(Message_type::Declare_service, payload))
+                     .has_value());
+}
+
+TEST(Compact_frame_test, varint_exceeding_its_field_is_rejected) {
+    Connect_service_reply msg{1U, 2U, Shared_memory_metadata{}, 0U, 0U};
+    auto payload = payload_of(encode_compact_frame(msg));
+    // num_methods is a std::uint16_t, replace its encoding of 0 by 2^16
+    auto const num_methods = payload.end() - 2;
+    *num_methods = 0x80U;
+    payload.insert(num_methods + 1, {0x80U, 0x04U});
+
+    EXPECT_FALSE(decode<Connect_service_reply>(
+                     make_frame(Message_type::Connect_service_reply, payload))
+                     .has_value());
+}
+
+TEST(Compact_frame_test, oversize_string_is_rejected) {
+    std::vector<std::uint8_t> payload{1U, static_cast<std::uint8_t>(kMax_service_id_size + 1U)};
+    payload.insert(payload.end(), kMax_service_id_size + 1U, 'x');
+    payload.insert(payload.end(), {1U, 0U, 1U, '1'});
+
+    EXPECT_FALSE(decode<Declare_service>(make_frame(Message_type::Declare_service, payload))
+                     .has_value());
+}
+
+TEST(Compact_frame_test, string_longer_than_the_remaining_payload_is_rejected) {
+    std::vector<std::uint8_t> payload{1U, 10U, 'x', 'y'};
+    EXPECT_FALSE(decode<Declare_service>(make_frame(Message_type::Declare_service, payload))
+                     .has_value());
+}
+
+TEST(Compact_frame_test, oversize_container_is_rejected) {
+    Service_snapshot msg{};
+    msg.complete = true;
+    auto payload = payload_of(encode_compact_frame(msg));
+    payload.front() = static_cast<std::uint8_t>(kMax_connect_page_size + 1U);
+
+    EXPECT_FALSE(decode<Service_snapshot>(make_frame(Message_type::Service_snapshot, payload))
+                     .has_value());
+}
+
+TEST(Compact_frame_test, trailing_bytes_are_rejected) {
+    auto payload = payload_of(encode_compact_frame(
+        Declare_service{1U, make_test_service("i/Service"), make_string<Instance_id>("9")}));
+    payload.push_back(0U);
+
+    EXPECT_FALSE(decode<Declare_service>(make_frame(Message_type::Declare_service, payload))
+                     .has_value());
+}
+
+TEST(Compact_frame_test, invalid_bool_is_rejected) {
+    Service_snapshot msg{};
+    msg.complete = true;
+    auto payload = payload_of(encode_compact_frame(msg));
+    payload.back() = 2U;
+
+    EXPECT_FALSE(decode<Service_snapshot>(make_frame(Message_type::Service_snapshot, payload))
+                     .has_value());
+}
+
+TEST(Compact_frame_test, consumer_release_out_of_range_is_rejected) {
+    Connect_service msg{1U, 2U, Shared_memory_metadata{}, true};
+    auto payload = payload_of(encode_compact_frame(msg));
+    // consumer_release is followed by the empty conflated_events and in_use
+    auto const consumer_release = payload.end() - 3;
+    ASSERT_EQ(*consumer_release,
+              static_cast<std::uint8_t>(Consumer_release::payload_consumed_message));
+    *consumer_release =
+        static_cast<std::uint8_t>(Consumer_release::shared_memory_consumer_count) + 1U;
+
+    EXPECT_FALSE(decode<Connect_service>(make_frame(Message_type::Connect_service, payload))
+                     .has_value());
+}
+
+}  // namespace
+}  // namespace score::gateway_ipc_binding
@@ -0,0 +1,135 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "../impl/data_ring.hpp"
+
+namespace score::gateway_ipc_binding {
+namespace {
+
+constexpr std::size_t capacity = 4096U;
+
+/// \brief Data lane message whose first payload byte identifies it
+std::vector<std::uint8_t> make_message(std::uint8_t id, std::size_t size = 64U) {
+    std::vector<std::uint8_t> message(size, std::uint8_t{0U});
+    message[0] = static_cast<std::uint8_t>(Message_type::Event_update);
+    message[1] = id;
+    return message;
+}
+
+/// \brief Writer and reader endpoint of one direction of a ring, the socket is a queue
+class Data_ring_endpoint_test : public ::testing::Test {
+   protected:
+    std::string const path{"/gw_data_ring_test_" + std::to_string(getpid())};
+    Data_ring_endpoint writer;
+    Data_ring_endpoint reader{std::chrono::microseconds{1000}};
+    std::vector<std::vector<std::uint8_t>> socket;
+    std::vector<std::uint8_t> received;
+
+    explicit Data_ring_endpoint_test(
+        std::chrono::microseconds full_ring_timeout = std::chrono::microseconds{1000})
+        : writer(full_ring_timeout) {
+        auto created = Data_ring::create(path, capacity);
+        EXPECT_TRUE(created);
+        auto opened = Data_ring::open(path, capacity);
+        EXPECT_TRUE(opened);
+        writer.attach(std::move(*created));
+        reader.attach(std::move(*opened));
+        writer.activate();
+    }
+
+    Result<void> send(std::vector<std::uint8_t> const& message) {
+        return writer.send({message.data(), message.size()},
+                           [this](score::cpp::span<std::uint8_t const> data) -> Result<void> {
+                               socket.emplace_back(data.begin(), data.end());
+                               return {};
+                           });
+    }
+
+    /// \brief Handles the queued socket messages like the receiver of a connection
+    /// \return Number of socket messages which were no doorbell
+    std::size_t receive_socket_messages() {
+        auto const on_message = [this](score::cpp::span<std::uint8_t const> data, auto) {
+            received.push_back(data[1]);
+        };
+
+        std::size_t detours = 0U;
+        for (auto const& data : socket) {
+            score::cpp::span<std::uint8_t const> const message{data.data(), data.size()};
+            if (auto const doorbell = check_and_cast<Data_ring_doorbell>(message)) {
+                reader.drain(**doorbell, on_message);
+                continue;
+            }
+            EXPECT_TRUE(reader.receive_detour(message, on_message));
+            ++detours;
+        }
+        socket.clear();
+        return detours;
+    }
+};
+
+class Data_ring_endpoint_without_wait_test : public Data_ring_endpoint_test {
+   protected:
+    Data_ring_endpoint_without_wait_test()
+        : Data_ring_endpoint_test(std::chrono::microseconds::zero()) {}
+};
+
+TEST_F(Data_ring_endpoint_test, too_large_message_is_sent_through_socket_in_order) {
+    ASSERT_TRUE(send(make_message(0U)));
+    ASSERT_TRUE(send(make_message(1U, capacity)));
+    ASSERT_TRUE(send(make_message(2U)));
+
+    EXPECT_EQ(receive_socket_messages(), 1U);
+    EXPECT_EQ(received, (std::vector<std::uint8_t>{0U, 1U, 2U}));
+
+    // The ring is used again afterwards
+    ASSERT_TRUE(send(make_message(3U)));
+    EXPECT_EQ(receive_socket_messages(), 0U);
+    EXPECT_EQ(received, (std::vector<std::uint8_t>{0U, 1U, 2U, 3U}));
+}
+
+TEST_F(Data_ring_endpoint_without_wait_test, full_lane_is_detoured_until_it_drains) {
+    // Seven records of 584 bytes and the room kept for a detour marker fill the lane exactly
+    constexpr std::size_t size = 576U;
+    std::vector<std::uint8_t> expected;
+    for (std::uint8_t id = 0U; id < 8U; ++id) {
+        ASSERT_TRUE(send(make_message(id, size)));
+        expected.push_back(id);
+    }
+    // The doorbell of the first message, the one of the detour and the eighth message
+    ASSERT_EQ(socket.size(), 3U);
+
+    // The detour marker took the last room of the lane
+    auto const blocked = send(make_message(100U, size));
+    ASSERT_FALSE(blocked);
+    EXPECT_EQ(blocked.error(), Bidirectional_channel_error::runtime_error_send_failed);
+
+    EXPECT_EQ(receive_socket_messages(), 1U);
+    EXPECT_EQ(received, expected);
+
+    ASSERT_TRUE(send(make_message(101U, size)));
+    expected.push_back(101U);
+    EXPECT_EQ(receive_socket_messages(), 0U);
+    EXPECT_EQ(received, expected);
+}
+
+}  // namespace
+}  // namespace score::gateway_ipc_binding
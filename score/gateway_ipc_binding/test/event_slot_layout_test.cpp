@@ -0,0 +1,132 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "score/gateway_ipc_binding/gateway_ipc_binding.hpp"
+
+namespace score::gateway_ipc_binding {
+namespace {
+
+constexpr std::size_t sample_count = 10U;
+constexpr std::size_t largest_size = 1500U;
+
+Shared_memory_path test_path() {
+    auto const path = fixed_string_from_string<Shared_memory_path>("/event_slot_layout_test");
+    EXPECT_TRUE(path);
+    return path ? *path : Shared_memory_path{};
+}
+
+std::size_t total_slots(Shared_memory_metadata const& metadata) {
+    auto slots = metadata.slot_count;
+    for (std::size_t i = 0U; i < metadata.slot_classes.size; ++i) {
+        slots += metadata.slot_classes.data[i].slot_count;
+    }
+    return slots;
+}
+
+std::size_t total_bytes(Shared_memory_metadata const& metadata) {
+    auto bytes = metadata.slot_size * metadata.slot_count;
+    for (std::size_t i = 0U; i < metadata.slot_classes.size; ++i) {
+        auto const& slot_class = metadata.slot_classes.data[i];
+        bytes += slot_class.slot_size * slot_class.slot_count;
+    }
+    return bytes;
+}
+
+/// \brief Bytes of the layout with all slots sized for the largest event
+std::size_t baseline_bytes(std::vector<std::size_t> const& sizes, std::size_t slots) {
+    return *std::max_element(sizes.begin(), sizes.end()) * slots;
+}
+
+TEST(Event_slot_layout_test, equally_sized_events_get_the_baseline_layout) {
+    std::vector<std::size_t> const sizes{largest_size, largest_size, largest_size};
+    auto const metadata = make_event_slot_layout(test_path(), sizes, sample_count);
+
+    EXPECT_EQ(metadata.path, test_path());
+    EXPECT_EQ(metadata.slot_size, largest_size);
+    EXPECT_EQ(metadata.slot_count, sample_count);
+    EXPECT_TRUE(metadata.slot_classes.empty());
+    EXPECT_EQ(metadata.event_slot_sizes, (Event_slot_sizes{largest_size, largest_size,
+                                                           largest_size}));
+    EXPECT_EQ(total_bytes(metadata), baseline_bytes(sizes, sample_count));
+}
+
+TEST(Event_slot_layout_test, small_events_share_the_slots_of_the_baseline) {
+    std::vector<std::size_t> const sizes{largest_size, 100U, 100U, 40U};
+    auto const metadata = make_event_slot_layout(test_path(), sizes, sample_count);
+
+    // 3 slots, one per class, and 7 split by 1, 2 and 1 of the 4 events
+    EXPECT_EQ(metadata.slot_classes, (Slot_classes{Slot_class{64U, 2U}, Slot_class{128U, 4U}}));
+    EXPECT_EQ(metadata.slot_size, largest_size);
+    EXPECT_EQ(metadata.slot_count, 4U);
+    EXPECT_EQ(total_slots(metadata), sample_count);
+    EXPECT_EQ(total_bytes(metadata), 4U * largest_size + 2U * 64U + 4U * 128U);
+    EXPECT_LT(total_bytes(metadata), baseline_bytes(sizes, sample_count));
+}
+
+TEST(Event_slot_layout_test, layout_never_needs_more_bytes_than_the_baseline) {
+    std::vector<std::vector<std::size_t>> const configurations{
+        {largest_size},
+        {1U, largest_size},
+        {largest_size, 1000U, 1000U, 1000U, 1000U, 1000U, 1000U, 1000U, 1000U, 1000U, 1000U},
+        {largest_size, 30U, 70U, 130U, 250U, 500U, 1000U},
+        {largest_size, 10U, 100U, 200U, 300U, 600U, 1100U, 40U, 2U, 90U, 180U, 1400U},
+        std::vector<std::size_t>(kMax_event_slot_sizes, 64U),
+    };
+
+    for (auto const& sizes : configurations) {
+        for (std::size_t slots = 0U; slots <= 2U * sample_count; ++slots) {
+            auto const metadata = make_event_slot_layout(test_path(), sizes, slots);
+            EXPECT_EQ(total_slots(metadata), slots);
+            EXPECT_LE(total_bytes(metadata), baseline_bytes(sizes, slots));
+            EXPECT_LE(metadata.slot_classes.size, kMax_slot_classes);
+            if (slots > 0U) {
+                EXPECT_GE(metadata.slot_count, 1U);
+            }
+            for (std::size_t i = 0U; i < metadata.slot_classes.size; ++i) {
+                EXPECT_GE(metadata.slot_classes.data[i].slot_count, 1U);
+            }
+        }
+    }
+}
+
+TEST(Event_slot_layout_test, classes_beyond_the_slots_are_merged_into_larger_ones) {
+    std::vector<std::size_t> const sizes{largest_size, 40U, 100U, 200U};
+    auto const metadata = make_event_slot_layout(test_path(), sizes, 2U);
+
+    EXPECT_EQ(metadata.slot_classes, (Slot_classes{Slot_class{256U, 1U}}));
+    EXPECT_EQ(metadata.slot_count, 1U);
+
+    auto const single_slot = make_event_slot_layout(test_path(), sizes, 1U);
+    EXPECT_TRUE(single_slot.slot_classes.empty());
+    EXPECT_EQ(single_slot.slot_count, 1U);
+}
+
+TEST(Event_slot_layout_test, too_many_events_get_a_single_slot_class) {
+    std::vector<std::size_t> sizes(kMax_event_slot_sizes + 1U, 64U);
+    sizes.back() = largest_size;
+    auto const metadata = make_event_slot_layout(test_path(), sizes, sample_count);
+
+    EXPECT_EQ(metadata.slot_size, largest_size);
+    EXPECT_EQ(metadata.slot_count, sample_count);
+    EXPECT_TRUE(metadata.slot_classes.empty());
+    EXPECT_TRUE(metadata.event_slot_sizes.empty());
+}
+
+}  // namespace
+}  // namespace score::gateway_ipc_binding
@@ -0,0 +1,209 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <optional>
+#include <thread>
+
+#include "score/gateway_ipc_binding/gateway_ipc_binding.hpp"
+#include "test_constants.hpp"
+#include "test_fixtures.hpp"
+#include "util.hpp"
+
+using testing::_;
+using testing::Values;
+using namespace std::chrono_literals;
+
+namespace score::gateway_ipc_binding {
+
+namespace {
+
+std::optional<Latency_histogram_summary> find_stage(Latency_histogram_summaries const& summaries,
+                                                    Latency_stage stage) {
+    auto const summary =
+        std::find_if(summaries.begin(), summaries.end(),
+                     [stage](auto const& candidate) { return candidate.stage == stage; });
+    if (summary == summaries.end()) {
+        return std::nullopt;
+    }
+    return *summary;
+}
+
+void expect_summary(Latency_histogram_summary const& summary, std::uint64_t count) {
+    EXPECT_EQ(summary.event_id, Event_id{0});
+    EXPECT_EQ(summary.count, count);
+    EXPECT_LE(summary.p50, summary.p99);
+    EXPECT_LE(summary.p99, summary.p999);
+    EXPECT_LE(summary.p999, summary.max);
+}
+
+}  // namespace
+
+class Gateway_ipc_binding_latency_tracing_integration_test
+    : public Gateway_ipc_binding_unconnected_integration_test {
+   protected:
+    explicit Gateway_ipc_binding_latency_tracing_integration_test(
+        Latency_tracing latency_tracing = {true}, Message_batching batching = {},
+        Message_dispatch dispatch = {}) {
+        client.reset();
+        server = create_ipc_server(*runtime_server, batching, dispatch, {}, latency_tracing);
+        client = create_ipc_client(*runtime_client, client_shm_config, {},
+                                   server_shared_memory_configs, {}, batching, {}, dispatch, {},
+                                   latency_tracing);
+        start_and_wait_for_client_connection();
+    }
+};
+
+class Gateway_ipc_binding_latency_tracing_disabled_integration_test
+    : public Gateway_ipc_binding_latency_tracing_integration_test {
+   protected:
+    Gateway_ipc_binding_latency_tracing_disabled_integration_test()
+        : Gateway_ipc_binding_latency_tracing_integration_test({false}) {}
+};
+
+/// \brief Traced updates in batches, handled by dispatch workers
+class Gateway_ipc_binding_latency_tracing_batched_integration_test
+    : public Gateway_ipc_binding_latency_tracing_integration_test {
+   protected:
+    Gateway_ipc_binding_latency_tracing_batched_integration_test()
+        : Gateway_ipc_binding_latency_tracing_integration_test({true}, {{4U, 1ms}, {}}, {2U}) {}
+};
+
+template <typename BASE>
+class Gateway_ipc_binding_connected_latency_tracing_test
+    : public Gateway_ipc_binding_bidirectional_test<BASE> {
+   protected:
+    Server_connector_with_callbacks producer{this->get_server_runtime(),
+                                             this->socom_server_config, this->instance};
+    Client_connector_with_callbacks consumer{this->get_client_runtime(),
+                                             this->socom_server_config, this->instance};
+
+    Gateway_ipc_binding_connected_latency_tracing_test() {
+        // The payload is consumed as soon as the callback returns
+        EXPECT_CALL(consumer.mock_event_update_cb, Call(_, this->event_id, _))
+            .WillRepeatedly([](auto&, auto, auto) {});
+        consumer.subscribe_event(producer.mock_event_subscription_change_cb, this->event_id);
+    }
+
+    void update_event() {
+        auto payload_handle = create_payload(*producer.connector, this->event_id, expected_payload);
+        ASSERT_TRUE(producer.connector->update_event(this->event_id, std::move(payload_handle)));
+    }
+
+    Latency_histogram_summaries get_producer_latencies() {
+        return this->GetParam() == Direction::Client_to_server
+                   ? this->server->get_latency_histograms()
+                   : this->client->get_latency_histograms();
+    }
+
+    Latency_histogram_summaries get_consumer_latencies() {
+        return this->GetParam() == Direction::Client_to_server
+                   ? this->client->get_latency_histograms()
+                   : this->server->get_latency_histograms();
+    }
+
+    /// \return Summary of stage on the consumer side once it counts count updates
+    std::optional<Latency_histogram_summary> wait_for_consumer_stage(Latency_stage stage,
+                                                                     std::uint64_t count) {
+        auto const deadline = std::chrono::steady_clock::now() + very_long_timeout;
+        while (std::chrono::steady_clock::now() < deadline) {
+            auto summary = find_stage(get_consumer_latencies(), stage);
+            if (summary && summary->count >= count) {
+                return summary;
+            }
+            std::this_thread::sleep_for(1ms);
+        }
+        return std::nullopt;
+    }
+};
+
+using Gateway_ipc_binding_connected_latency_tracing_integration_test =
+    Gateway_ipc_binding_connected_latency_tracing_test<
+        Gateway_ipc_binding_latency_tracing_integration_test>;
+using Gateway_ipc_binding_connected_latency_tracing_disabled_integration_test =
+    Gateway_ipc_binding_connected_latency_tracing_test<
+        Gateway_ipc_binding_latency_tracing_disabled_integration_test>;
+
+using Gateway_ipc_binding_connected_latency_tracing_batched_integration_test =
+    Gateway_ipc_binding_connected_latency_tracing_test<
+        Gateway_ipc_binding_latency_tracing_batched_integration_test>;
+
+INSTANTIATE_TEST_SUITE_P(, Gateway_ipc_binding_connected_latency_tracing_integration_test,
+                         Values(Direction::Client_to_server, Direction::Server_to_client),
+                         readable_test_names);
+INSTANTIATE_TEST_SUITE_P(, Gateway_ipc_binding_connected_latency_tracing_disabled_integration_test,
+                         Values(Direction::Client_to_server, Direction::Server_to_client),
+                         readable_test_names);
+INSTANTIATE_TEST_SUITE_P(, Gateway_ipc_binding_connected_latency_tracing_batched_integration_test,
+                         Values(Direction::Client_to_server, Direction::Server_to_client),
+                         readable_test_names);
+
+TEST_P(Gateway_ipc_binding_connected_latency_tracing_integration_test,
+       each_stage_of_consumed_updates_is_recorded) {
+    static constexpr std::uint64_t update_count{10U};
+    std::optional<Latency_histogram_summary> allocate_to_consume;
+    // Waiting for each consumption keeps the few shared memory slots available
+    for (std::uint64_t update = 1U; update <= update_count; ++update) {
+        update_event();
+        allocate_to_consume = wait_for_consumer_stage(Latency_stage::allocate_to_consume, update);
+        ASSERT_TRUE(allocate_to_consume);
+    }
+    expect_summary(*allocate_to_consume, update_count);
+
+    auto const consumer_latencies = get_consumer_latencies();
+    for (auto const stage : {Latency_stage::send_to_receive, Latency_stage::receive_to_consume}) {
+        auto const summary = find_stage(consumer_latencies, stage);
+        ASSERT_TRUE(summary);
+        expect_summary(*summary, update_count);
+        EXPECT_LE(summary->max, allocate_to_consume->max);
+    }
+    EXPECT_FALSE(find_stage(consumer_latencies, Latency_stage::allocate_to_send));
+
+    auto const producer_latencies = get_producer_latencies();
+    ASSERT_EQ(producer_latencies.size(), 1U);
+    EXPECT_EQ(producer_latencies[0].stage, Latency_stage::allocate_to_send);
+    expect_summary(producer_latencies[0], update_count);
+}
+
+TEST_P(Gateway_ipc_binding_connected_latency_tracing_disabled_integration_test,
+       nothing_is_recorded) {
+    std::promise<void> received;
+    EXPECT_CALL(consumer.mock_event_update_cb, Call(_, event_id, _))
+        .WillOnce([&received](auto&, auto, auto) { received.set_value(); });
+
+    update_event();
+    ASSERT_EQ(received.get_future().wait_for(very_long_timeout), std::future_status::ready);
+    EXPECT_TRUE(get_producer_latencies().empty());
+    EXPECT_TRUE(get_consumer_latencies().empty());
+}
+
+TEST_P(Gateway_ipc_binding_connected_latency_tracing_batched_integration_test,
+       timestamps_of_batched_updates_are_received) {
+    static constexpr std::uint64_t update_count{3U};
+    for (std::uint64_t update = 0U; update < update_count; ++update) {
+        update_event();
+    }
+
+    // send_to_receive is only recorded for updates carrying the time they were sent
+    auto const send_to_receive =
+        wait_for_consumer_stage(Latency_stage::send_to_receive, update_count);
+    ASSERT_TRUE(send_to_receive);
+    expect_summary(*send_to_receive, update_count);
+}
+
+}  // namespace score::gateway_ipc_binding
@@ -13,10 +13,16 @@
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <unistd.h>
 
+#include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <future>
+#include <memory>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "score/gateway_ipc_binding/gateway_ipc_binding.hpp"
 #include "score/gateway_ipc_binding/gateway_ipc_binding_client.hpp"
@@ -34,6 +40,7 @@
 
 using testing::_;
 using testing::Values;
+using namespace std::chrono_literals;
 
 namespace score::gateway_ipc_binding {
 
@@ -93,6 +100,21 @@ void send_event_update(Server_connector_with_callbacks& server, Service_variant
               std::future_status::ready);
 }
 
+/// \brief Sends count updates, waiting for the consumer to release slots when all are in use
+void send_event_updates(Server_connector_with_callbacks& server, Event_id const& event_id,
+                        std::size_t count) {
+    for (std::size_t i = 0U; i < count; ++i) {
+        auto const deadline = std::chrono::steady_clock::now() + very_long_timeout;
+        auto payload = server.connector->allocate_event_payload(event_id);
+        while (!payload && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(1ms);
+            payload = server.connector->allocate_event_payload(event_id);
+        }
+        ASSERT_TRUE(payload);
+        ASSERT_TRUE(server.connector->update_event(event_id, std::move(*payload)));
+    }
+}
+
 class Gateway_ipc_binding_many_services_integration_test
     : public Gateway_ipc_binding_unconnected_integration_test {
    protected:
@@ -230,4 +252,199 @@ TEST_P(Gateway_ipc_binding_many_services_param_integration_test,
                       gamma_observer);
 }
 
+TEST_F(Gateway_ipc_binding_many_services_integration_test,
+       event_updates_of_services_sent_concurrently_are_received) {
+    constexpr std::size_t update_count = 200U;
+    Server_connector_with_callbacks alpha_server_connector(*runtime_server, server_config_alpha,
+                                                           instance);
+    Server_connector_with_callbacks beta_server_connector(*runtime_server, server_config_beta,
+                                                          instance);
+    Server_connector_with_callbacks gamma_server_connector(*runtime_server, server_config_gamma,
+                                                           instance);
+
+    Client_connector_with_callbacks alpha_observer(*runtime_client, server_config_alpha, instance);
+    Client_connector_with_callbacks beta_observer(*runtime_client, server_config_beta, instance);
+    Client_connector_with_callbacks gamma_observer(*runtime_client, server_config_gamma, instance);
+
+    std::atomic<std::size_t> received_count{0U};
+    std::promise<void> all_received;
+    for (auto* observer : {&alpha_observer, &beta_observer, &gamma_observer}) {
+        EXPECT_CALL(observer->mock_event_update_cb, Call(_, event_id, _))
+            .Times(update_count)
+            .WillRepeatedly([&received_count, &all_received](auto&, auto, auto) {
+                if (++received_count == 3U * update_count) {
+                    all_received.set_value();
+                }
+            });
+    }
+
+    alpha_observer.subscribe_event(alpha_server_connector.mock_event_subscription_change_cb,
+                                   event_id);
+    beta_observer.subscribe_event(beta_server_connector.mock_event_subscription_change_cb,
+                                  event_id);
+    gamma_observer.subscribe_event(gamma_server_connector.mock_event_subscription_change_cb,
+                                   event_id);
+
+    std::vector<std::thread> producers;
+    for (auto* server :
+         {&alpha_server_connector, &beta_server_connector, &gamma_server_connector}) {
+        producers.emplace_back(
+            [server, this]() { send_event_updates(*server, event_id, update_count); });
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+
+    EXPECT_EQ(all_received.get_future().wait_for(very_long_timeout), std::future_status::ready);
+}
+
+class Gateway_ipc_binding_many_services_data_ring_integration_test
+    : public Gateway_ipc_binding_many_services_integration_test {
+   protected:
+    // A single worker, which a blocked event update callback keeps busy
+    Gateway_ipc_binding_many_services_data_ring_integration_test() {
+        client = nullptr;
+        server = nullptr;
+        client = create_ipc_client(
+            *runtime_client, client_shm_config, {}, make_shared_memory_configs(server_shm_config),
+            {}, {}, Data_ring_config{"/gw_data_ring_many_services_" + std::to_string(getpid())},
+            Message_dispatch{1U});
+        server = create_ipc_server(*runtime_server, {}, Message_dispatch{1U});
+
+        start_and_wait_for_client_connection();
+    }
+};
+
+TEST_F(Gateway_ipc_binding_many_services_data_ring_integration_test,
+       service_withdrawal_is_handled_while_event_update_blocks_the_worker) {
+    Server_connector_with_callbacks alpha_server_connector(*runtime_server, server_config_alpha,
+                                                           instance);
+    auto beta_server_connector =
+        std::make_unique<Server_connector_with_callbacks>(*runtime_server, server_config_beta,
+                                                          instance);
+
+    Client_connector_with_callbacks alpha_observer(*runtime_client, server_config_alpha, instance);
+    Client_connector_with_callbacks beta_observer(*runtime_client, server_config_beta, instance);
+    alpha_observer.subscribe_event(alpha_server_connector.mock_event_subscription_change_cb,
+                                   event_id);
+
+    std::promise<void> update_received;
+    std::promise<void> unblock_update;
+    std::atomic<bool> update_returned{false};
+    EXPECT_CALL(alpha_observer.mock_event_update_cb, Call(_, event_id, _))
+        .WillOnce([&update_received, unblocked = unblock_update.get_future().share(),
+                   &update_returned](auto&, auto, auto) {
+            update_received.set_value();
+            unblocked.wait();
+            update_returned = true;
+        });
+
+    auto payload = create_payload(*alpha_server_connector.connector, event_id, expected_payload);
+    ASSERT_TRUE(alpha_server_connector.connector->update_event(event_id, std::move(payload)));
+    ASSERT_EQ(update_received.get_future().wait_for(very_long_timeout),
+              std::future_status::ready);
+
+    // Offer_service takes the control lane and does not wait for the busy worker
+    beta_server_connector.reset();
+    EXPECT_EQ(beta_observer.client_disconnected_promise.get_future().wait_for(very_long_timeout),
+              std::future_status::ready);
+    EXPECT_FALSE(update_returned);
+
+    unblock_update.set_value();
+}
+
+/// \brief More service instances than shared memory configurations fit into a single page of
+///        the Connect handshake
+class Gateway_ipc_binding_many_instances_integration_test
+    : public Gateway_ipc_binding_unconnected_integration_test {
+   protected:
+    static constexpr std::size_t instance_count = 2U * kMax_connect_page_size + 1U;
+
+    socom::Service_interface_identifier const service_interface{
+        std::string{"com.test.service.instances"}, {1, 0}};
+    socom::Server_service_interface_definition const server_config{
+        service_interface, socom::to_num_of_methods(1), socom::to_num_of_events(1)};
+
+    std::vector<socom::Service_instance> const instances = create_instances();
+    Shared_memory_manager_factory::Shared_memory_configuration instances_server_shm_config;
+    Shared_memory_manager_factory::Shared_memory_configuration instances_client_shm_config;
+
+    Gateway_ipc_binding_many_instances_integration_test() {
+        for (std::size_t i = 0U; i < instances.size(); ++i) {
+            auto const suffix = std::to_string(i);
+            instances_server_shm_config[service_interface].emplace(
+                instances[i], make_metadata("/gw_server_shm_many_instances_" + suffix, 256, 4));
+            instances_client_shm_config[service_interface].emplace(
+                instances[i], make_metadata("/gw_client_shm_many_instances_" + suffix, 256, 4));
+        }
+
+        client = nullptr;
+        server = nullptr;
+        client = create_instances_client();
+        server = create_ipc_server(*runtime_server);
+
+        start_and_wait_for_client_connection();
+    }
+
+    std::unique_ptr<Gateway_ipc_binding_client> create_instances_client() {
+        return create_ipc_client(*runtime_client, instances_client_shm_config, {},
+                                 make_shared_memory_configs(instances_server_shm_config));
+    }
+
+    static std::vector<socom::Service_instance> create_instances() {
+        std::vector<socom::Service_instance> result;
+        for (std::size_t i = 0U; i < instance_count; ++i) {
+            result.emplace_back(std::string_view{"instance" + std::to_string(i)});
+        }
+        return result;
+    }
+};
+
+TEST_F(Gateway_ipc_binding_many_instances_integration_test,
+       server_sends_event_updates_of_all_configured_instances) {
+    for (auto const& service_instance : instances) {
+        Server_connector_with_callbacks server_connector(*runtime_server, server_config,
+                                                         service_instance);
+        Client_connector_with_callbacks observer(*runtime_client, server_config, service_instance);
+
+        observer.subscribe_event(server_connector.mock_event_subscription_change_cb, event_id);
+        send_event_update(server_connector, Service_variant::alpha, Service_variant::alpha,
+                          event_id, observer);
+    }
+}
+
+TEST_F(Gateway_ipc_binding_many_instances_integration_test,
+       all_instances_are_available_again_after_client_reconnect) {
+    // The requests of the client and the offers of the server span several Service_snapshot
+    // messages
+    std::vector<std::unique_ptr<Server_connector_with_callbacks>> server_connectors;
+    std::vector<std::unique_ptr<Client_connector_with_callbacks>> observers;
+    for (auto const& service_instance : instances) {
+        server_connectors.push_back(std::make_unique<Server_connector_with_callbacks>(
+            *runtime_server, server_config, service_instance));
+        observers.push_back(std::make_unique<Client_connector_with_callbacks>(
+            *runtime_client, server_config, service_instance));
+    }
+
+    client.reset();
+    for (auto const& observer : observers) {
+        EXPECT_EQ(observer->client_disconnected_promise.get_future().wait_for(very_long_timeout),
+                  std::future_status::ready);
+        observer->expect_client_connected(server_config);
+    }
+
+    client = create_instances_client();
+    for (auto const& observer : observers) {
+        EXPECT_EQ(observer->client_connected_promise.get_future().wait_for(very_long_timeout),
+                  std::future_status::ready);
+    }
+
+    // Service connections are established again, not only announced
+    auto& server_connector = *server_connectors.back();
+    auto& observer = *observers.back();
+    observer.subscribe_event(server_connector.mock_event_subscription_change_cb, event_id);
+    send_event_update(server_connector, Service_variant::alpha, Service_variant::alpha, event_id,
+                      observer);
+}
+
 }  // namespace score::gateway_ipc_binding
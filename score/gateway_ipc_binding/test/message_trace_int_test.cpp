@@ -0,0 +1,189 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <future>
+#include <optional>
+#include <sstream>
+
+#include "score/gateway_ipc_binding/error.hpp"
+#include "score/gateway_ipc_binding/message_trace.hpp"
+#include "test_constants.hpp"
+#include "test_fixtures.hpp"
+#include "util.hpp"
+
+using testing::_;
+using testing::Values;
+
+namespace score::gateway_ipc_binding {
+
+namespace {
+
+std::optional<Message_trace_record> find_record(Message_trace_records const& records,
+                                                Message_type type, Message_direction direction) {
+    auto const record =
+        std::find_if(records.begin(), records.end(), [type, direction](auto const& candidate) {
+            return candidate.type == type && candidate.direction == direction;
+        });
+    if (record == records.end()) {
+        return std::nullopt;
+    }
+    return *record;
+}
+
+}  // namespace
+
+TEST(Message_trace_file_test, written_records_are_read_back) {
+    Message_trace_records const records{
+        {100U, 7U, 1U, 3U, 64U, 48U, 2U, Message_type::Event_update, Message_direction::sent, 0U},
+        {200U, 7U, 1U, kNo_trace_slot, 0U, 24U, 0U, Message_type::Payload_consumed,
+         Message_direction::received, 0U}};
+
+    std::stringstream stream;
+    ASSERT_TRUE(write_message_trace(stream, records));
+
+    auto const read = read_message_trace(stream);
+    ASSERT_TRUE(read);
+    EXPECT_EQ(*read, records);
+}
+
+TEST(Message_trace_file_test, other_data_is_rejected) {
+    std::stringstream stream{"no message trace, but long enough for its header"};
+    EXPECT_EQ(read_message_trace(stream),
+              MakeUnexpected(Gateway_ipc_binding_error::runtime_error_invalid_message_trace));
+}
+
+TEST(Message_trace_file_test, truncated_trace_is_rejected) {
+    std::stringstream written;
+    ASSERT_TRUE(write_message_trace(
+        written, {{100U, 7U, 1U, 3U, 64U, 48U, 2U, Message_type::Event_update,
+                   Message_direction::sent, 0U}}));
+    auto const bytes = written.str();
+
+    std::stringstream truncated{bytes.substr(0U, bytes.size() - 1U)};
+    EXPECT_EQ(read_message_trace(truncated),
+              MakeUnexpected(Gateway_ipc_binding_error::runtime_error_message_trace_io_failed));
+}
+
+class Gateway_ipc_binding_message_trace_integration_test
+    : public Gateway_ipc_binding_unconnected_integration_test {
+   protected:
+    explicit Gateway_ipc_binding_message_trace_integration_test(
+        Message_tracing message_tracing = {}) {
+        client.reset();
+        server = create_ipc_server(*runtime_server, {}, {}, {}, {}, message_tracing);
+        client = create_ipc_client(*runtime_client, client_shm_config, {},
+                                   server_shared_memory_configs, {}, {}, {}, {}, {}, {},
+                                   message_tracing);
+        start_and_wait_for_client_connection();
+    }
+};
+
+class Gateway_ipc_binding_message_trace_disabled_integration_test
+    : public Gateway_ipc_binding_message_trace_integration_test {
+   protected:
+    Gateway_ipc_binding_message_trace_disabled_integration_test()
+        : Gateway_ipc_binding_message_trace_integration_test({0U}) {}
+};
+
+template <typename BASE>
+class Gateway_ipc_binding_connected_message_trace_test
+    : public Gateway_ipc_binding_bidirectional_test<BASE> {
+   protected:
+    Server_connector_with_callbacks producer{this->get_server_runtime(),
+                                             this->socom_server_config, this->instance};
+    Client_connector_with_callbacks consumer{this->get_client_runtime(),
+                                             this->socom_server_config, this->instance};
+
+    std::promise<void> received;
+
+    Gateway_ipc_binding_connected_message_trace_test() {
+        EXPECT_CALL(consumer.mock_event_update_cb, Call(_, this->event_id, _))
+            .WillOnce([this](auto&, auto, auto) { received.set_value(); });
+        consumer.subscribe_event(producer.mock_event_subscription_change_cb, this->event_id);
+    }
+
+    void update_event_and_wait() {
+        auto payload_handle =
+            create_payload(*producer.connector, this->event_id, expected_payload);
+        ASSERT_TRUE(producer.connector->update_event(this->event_id, std::move(payload_handle)));
+        ASSERT_EQ(received.get_future().wait_for(very_long_timeout), std::future_status::ready);
+    }
+
+    Message_trace_records get_producer_trace() {
+        return this->GetParam() == Direction::Client_to_server ? this->server->get_message_trace()
+                                                               : this->client->get_message_trace();
+    }
+
+    Message_trace_records get_consumer_trace() {
+        return this->GetParam() == Direction::Client_to_server ? this->client->get_message_trace()
+                                                               : this->server->get_message_trace();
+    }
+};
+
+using Gateway_ipc_binding_connected_message_trace_integration_test =
+    Gateway_ipc_binding_connected_message_trace_test<
+        Gateway_ipc_binding_message_trace_integration_test>;
+using Gateway_ipc_binding_connected_message_trace_disabled_integration_test =
+    Gateway_ipc_binding_connected_message_trace_test<
+        Gateway_ipc_binding_message_trace_disabled_integration_test>;
+
+INSTANTIATE_TEST_SUITE_P(, Gateway_ipc_binding_connected_message_trace_integration_test,
+                         Values(Direction::Client_to_server, Direction::Server_to_client),
+                         readable_test_names);
+INSTANTIATE_TEST_SUITE_P(, Gateway_ipc_binding_connected_message_trace_disabled_integration_test,
+                         Values(Direction::Client_to_server, Direction::Server_to_client),
+                         readable_test_names);
+
+TEST_P(Gateway_ipc_binding_connected_message_trace_integration_test,
+       event_update_is_recorded_by_producer_and_consumer) {
+    update_event_and_wait();
+
+    auto const producer_trace = get_producer_trace();
+    auto const consumer_trace = get_consumer_trace();
+    EXPECT_TRUE(std::is_sorted(
+        consumer_trace.begin(), consumer_trace.end(),
+        [](auto const& lhs, auto const& rhs) { return lhs.timestamp_ns < rhs.timestamp_ns; }));
+
+    auto const sent =
+        find_record(producer_trace, Message_type::Event_update, Message_direction::sent);
+    auto const received =
+        find_record(consumer_trace, Message_type::Event_update, Message_direction::received);
+    ASSERT_TRUE(sent);
+    ASSERT_TRUE(received);
+    EXPECT_EQ(sent->handle, received->handle);
+    EXPECT_EQ(sent->element_id, event_id);
+    EXPECT_EQ(received->element_id, event_id);
+    EXPECT_NE(sent->slot_index, kNo_trace_slot);
+    EXPECT_EQ(sent->slot_index, received->slot_index);
+    EXPECT_GE(received->payload_bytes, expected_payload.size());
+    EXPECT_EQ(sent->payload_bytes, received->payload_bytes);
+    EXPECT_LE(sent->timestamp_ns, received->timestamp_ns);
+
+    // The handshake is part of the trace, both directions of each side
+    EXPECT_TRUE(find_record(producer_trace, Message_type::Subscribe_event,
+                            Message_direction::received));
+    EXPECT_TRUE(
+        find_record(consumer_trace, Message_type::Subscribe_event, Message_direction::sent));
+}
+
+TEST_P(Gateway_ipc_binding_connected_message_trace_disabled_integration_test,
+       nothing_is_recorded) {
+    update_event_and_wait();
+    EXPECT_TRUE(get_producer_trace().empty());
+    EXPECT_TRUE(get_consumer_trace().empty());
+}
+
+}  // namespace score::gateway_ipc_binding
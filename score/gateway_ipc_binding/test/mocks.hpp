@@ -40,6 +40,9 @@ class Shared_memory_slot_manager_mock : public Shared_memory_slot_manager {
    public:
     MOCK_METHOD(Result<Shared_memory_slot_guard>, allocate_slot, (), (noexcept, override));
 
+    MOCK_METHOD(Result<Shared_memory_slot_guard>, allocate_slot, (std::size_t size),
+                (noexcept, override));
+
     MOCK_METHOD(Result<void>, add_consumer, (Slot_handle handle), (noexcept, override));
 
     MOCK_METHOD(Result<void>, release_slot, (Slot_handle handle), (noexcept, override));
@@ -48,6 +51,21 @@ class Shared_memory_slot_manager_mock : public Shared_memory_slot_manager {
 
     MOCK_METHOD(std::size_t, get_slot_size, (), (const, noexcept, override));
 
+    MOCK_METHOD(Slot_classes, get_slot_classes, (), (const, noexcept, override));
+
+    MOCK_METHOD(Event_slot_sizes, get_event_slot_sizes, (), (const, noexcept, override));
+
+    MOCK_METHOD(Consumer_release, get_consumer_release, (), (const, noexcept, override));
+
+    MOCK_METHOD(Conflated_events, get_conflated_events, (), (const, noexcept, override));
+
+    MOCK_METHOD(Result<void>, add_peer_consumer, (Slot_handle handle), (noexcept, override));
+
+    MOCK_METHOD(Result<void>, remove_peer_consumer, (Slot_handle handle), (noexcept, override));
+
+    MOCK_METHOD(std::size_t, get_peer_consumer_count, (Slot_handle handle),
+                (const, noexcept, override));
+
     MOCK_METHOD(std::size_t, get_allocated_slot_count, (), (const, noexcept, override));
 
     MOCK_METHOD(std::size_t, get_reference_count, (Slot_handle handle),
@@ -16,6 +16,8 @@
 #include <gtest/gtest.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <atomic>
 #include <cstring>
 #include <string>
 #include <thread>
@@ -47,27 +49,36 @@ class Shared_memory_slot_manager_test : public ::testing::Test {
                std::to_string(++counter);
     }
 
+    /// \brief Metadata of a shared memory at a unique path with the default slot class only
+    Shared_memory_metadata make_shared_memory_metadata(std::size_t slot_size,
+                                                       std::size_t slot_count) {
+        Shared_memory_metadata metadata{};
+        metadata.path = fixed_string_from_string_asserted<Shared_memory_path>(get_unique_path());
+        metadata.slot_size = slot_size;
+        metadata.slot_count = slot_count;
+        return metadata;
+    }
+
     socom::Service_interface_identifier const interface{
         "com.test.interface", socom::Literal_tag{}, {1, 0}};
 
     socom::Service_instance const instance{"instance1", socom::Literal_tag{}};
-    Shared_memory_metadata const shared_memory_metadata{
-        fixed_string_from_string_asserted<Shared_memory_path>(get_unique_path()), DEFAULT_SLOT_SIZE,
-        DEFAULT_NUMBER_OF_SLOTS};
+    Shared_memory_metadata const shared_memory_metadata =
+        make_shared_memory_metadata(DEFAULT_SLOT_SIZE, DEFAULT_NUMBER_OF_SLOTS);
 
     socom::Service_instance const instance_other_size{"instance_other_size", socom::Literal_tag{}};
-    Shared_memory_metadata const shared_memory_metadata_other_size{
-        fixed_string_from_string_asserted<Shared_memory_path>(get_unique_path()), 100, 4};
+    Shared_memory_metadata const shared_memory_metadata_other_size =
+        make_shared_memory_metadata(100, 4);
 
     socom::Service_instance const instance_zero_slot_size{"instance_zero_slot_size",
                                                           socom::Literal_tag{}};
-    Shared_memory_metadata const shared_memory_metadata_zero_slot_size{
-        fixed_string_from_string_asserted<Shared_memory_path>(get_unique_path()), 0, 100};
+    Shared_memory_metadata const shared_memory_metadata_zero_slot_size =
+        make_shared_memory_metadata(0, 100);
 
     socom::Service_instance const instance_zero_slot_count{"instance_zero_slot_count",
                                                            socom::Literal_tag{}};
-    Shared_memory_metadata const shared_memory_metadata_zero_slot_count{
-        fixed_string_from_string_asserted<Shared_memory_path>(get_unique_path()), 100, 0};
+    Shared_memory_metadata const shared_memory_metadata_zero_slot_count =
+        make_shared_memory_metadata(100, 0);
 
     Shared_memory_manager_factory::Shared_memory_configuration const config{
         {interface,
@@ -781,4 +792,387 @@ TEST_F(Shared_memory_slot_manager_test, release_with_multi_consumer_slot) {
     EXPECT_EQ(manager.get_allocated_slot_count(), 0);
 }
 
+class Lock_free_shared_memory_slot_manager_test : public Shared_memory_slot_manager_test {
+   protected:
+    Shared_memory_manager_factory::Uptr lock_free_factory = Shared_memory_manager_factory::create(
+        {{interface,
+          {{instance, make_shared_memory_metadata(DEFAULT_SLOT_SIZE, DEFAULT_NUMBER_OF_SLOTS)},
+           {instance_other_size, make_shared_memory_metadata(100, 4)}}}},
+        Slot_allocation_strategy::lock_free_free_list);
+
+    Result<std::unique_ptr<Shared_memory_slot_manager>> lock_free_manager_result =
+        lock_free_factory->create(interface, instance);
+
+    Shared_memory_slot_manager& lock_free_manager = **lock_free_manager_result;
+
+    void SetUp() override {
+        Shared_memory_slot_manager_test::SetUp();
+        ASSERT_TRUE(lock_free_manager_result);
+    }
+};
+
+// Test: Lock-free allocation hands out slot 0 first and reuses the last released slot
+TEST_F(Lock_free_shared_memory_slot_manager_test, allocation_order_and_reuse) {
+    auto guard0 = lock_free_manager.allocate_slot();
+    auto guard1 = lock_free_manager.allocate_slot();
+    ASSERT_TRUE(guard0);
+    ASSERT_TRUE(guard1);
+    EXPECT_EQ(*guard0->get_handle(), 0);
+    EXPECT_EQ(*guard1->get_handle(), 1);
+    EXPECT_EQ(lock_free_manager.get_allocated_slot_count(), 2);
+
+    guard0->reset();
+    EXPECT_EQ(lock_free_manager.get_reference_count(0), 0);
+
+    auto guard2 = lock_free_manager.allocate_slot();
+    ASSERT_TRUE(guard2);
+    EXPECT_EQ(*guard2->get_handle(), 0);
+    EXPECT_EQ(guard2->get_memory().size(), DEFAULT_SLOT_SIZE);
+}
+
+// Test: Lock-free allocation fails when exhausted and recovers after release
+TEST_F(Lock_free_shared_memory_slot_manager_test, allocate_all_slots) {
+    auto manager_result = lock_free_factory->create(interface, instance_other_size);
+    ASSERT_TRUE(manager_result);
+    auto& manager = **manager_result;
+
+    std::vector<Shared_memory_slot_guard> guards;
+    for (std::size_t i = 0; i < manager.get_slot_count(); ++i) {
+        auto guard_opt = manager.allocate_slot();
+        ASSERT_TRUE(guard_opt);
+        guards.push_back(std::move(*guard_opt));
+    }
+
+    EXPECT_EQ(manager.allocate_slot(),
+              MakeUnexpected(Shared_memory_manager_error::runtime_error_no_available_slots));
+
+    guards.pop_back();
+    EXPECT_TRUE(manager.allocate_slot());
+
+    guards.clear();
+    EXPECT_EQ(manager.get_allocated_slot_count(), 0);
+}
+
+// Test: Lock-free reference counting returns the slot only after the last release
+TEST_F(Lock_free_shared_memory_slot_manager_test, multi_consumer_reference_counting) {
+    auto guard_opt = lock_free_manager.allocate_slot();
+    ASSERT_TRUE(guard_opt);
+    auto handle = *guard_opt->release();
+
+    EXPECT_TRUE(lock_free_manager.add_consumer(handle));
+    EXPECT_EQ(lock_free_manager.get_reference_count(handle), 2);
+
+    EXPECT_TRUE(lock_free_manager.release_slot(handle));
+    EXPECT_EQ(lock_free_manager.get_allocated_slot_count(), 1);
+    EXPECT_TRUE(lock_free_manager.release_slot(handle));
+    EXPECT_EQ(lock_free_manager.get_allocated_slot_count(), 0);
+
+    // A double release must neither succeed nor push the slot twice onto the free list
+    EXPECT_EQ(lock_free_manager.release_slot(handle),
+              MakeUnexpected(Shared_memory_manager_error::runtime_error_slot_not_allocated));
+    EXPECT_EQ(lock_free_manager.add_consumer(handle),
+              MakeUnexpected(Shared_memory_manager_error::runtime_error_slot_not_allocated));
+
+    auto first = lock_free_manager.allocate_slot();
+    auto second = lock_free_manager.allocate_slot();
+    ASSERT_TRUE(first);
+    ASSERT_TRUE(second);
+    EXPECT_NE(*first->get_handle(), *second->get_handle());
+}
+
+// Test: Concurrent allocate/release never hands out a slot twice
+TEST_F(Lock_free_shared_memory_slot_manager_test, thread_safety_exclusive_ownership) {
+    auto manager_result = lock_free_factory->create(interface, instance_other_size);
+    ASSERT_TRUE(manager_result);
+    auto& manager = **manager_result;
+
+    constexpr int num_threads = 8;
+    constexpr int iterations = 10000;
+    std::atomic<int> ownership_violations{0};
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < num_threads; ++i) {
+        threads.emplace_back([&manager, &ownership_violations, i]() {
+            auto const marker = static_cast<Byte>(i + 1);
+            for (int j = 0; j < iterations; ++j) {
+                auto guard_opt = manager.allocate_slot();
+                if (!guard_opt) {
+                    continue;
+                }
+                auto memory = guard_opt->get_memory();
+                std::memset(memory.data(), static_cast<int>(marker), memory.size());
+                auto shared = guard_opt->share();
+                for (auto const byte : memory) {
+                    if (byte != marker) {
+                        ++ownership_violations;
+                        break;
+                    }
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(ownership_violations, 0);
+    EXPECT_EQ(manager.get_allocated_slot_count(), 0);
+    for (std::size_t i = 0; i < manager.get_slot_count(); ++i) {
+        EXPECT_TRUE(manager.allocate_slot().and_then([](auto guard) { return guard.release(); }));
+    }
+}
+
+class Shared_memory_slot_class_test
+    : public Shared_memory_slot_manager_test,
+      public ::testing::WithParamInterface<Slot_allocation_strategy> {
+   protected:
+    static constexpr std::size_t kDefault_slot_size = 1024;
+    static constexpr std::size_t kDefault_slot_count = 2;
+    static constexpr Slot_handle kSmall_first_handle = kDefault_slot_count;
+    static constexpr std::size_t kSmall_slot_size = 64;
+    static constexpr std::size_t kSmall_slot_count = 4;
+    static constexpr Slot_handle kMedium_first_handle = kSmall_first_handle + kSmall_slot_count;
+    static constexpr std::size_t kMedium_slot_size = 200;
+    static constexpr std::size_t kMedium_slot_count = 2;
+    static constexpr std::size_t kTotal_slot_count =
+        kDefault_slot_count + kSmall_slot_count + kMedium_slot_count;
+
+    Shared_memory_metadata const classes_metadata = [this]() {
+        auto metadata = make_shared_memory_metadata(kDefault_slot_size, kDefault_slot_count);
+        metadata.slot_classes = {Slot_class{kSmall_slot_size, kSmall_slot_count},
+                                 Slot_class{kMedium_slot_size, kMedium_slot_count}};
+        return metadata;
+    }();
+
+    Shared_memory_manager_factory::Uptr classes_factory = Shared_memory_manager_factory::create(
+        {{interface, {{instance, classes_metadata}}}}, GetParam());
+
+    Result<std::unique_ptr<Shared_memory_slot_manager>> classes_manager_result =
+        classes_factory->create(interface, instance);
+
+    Shared_memory_slot_manager& classes_manager = **classes_manager_result;
+
+    void SetUp() override {
+        Shared_memory_slot_manager_test::SetUp();
+        ASSERT_TRUE(classes_manager_result);
+    }
+};
+
+INSTANTIATE_TEST_SUITE_P(, Shared_memory_slot_class_test,
+                         ::testing::Values(Slot_allocation_strategy::linear_scan,
+                                           Slot_allocation_strategy::lock_free_free_list));
+
+// Test: Sized allocation picks the smallest slot class that fits
+TEST_P(Shared_memory_slot_class_test, allocation_picks_smallest_fitting_class) {
+    auto small = classes_manager.allocate_slot(8);
+    ASSERT_TRUE(small);
+    EXPECT_EQ(*small->get_handle(), kSmall_first_handle);
+    EXPECT_EQ(small->get_memory().size(), kSmall_slot_size);
+
+    auto medium = classes_manager.allocate_slot(kSmall_slot_size + 1);
+    ASSERT_TRUE(medium);
+    EXPECT_EQ(*medium->get_handle(), kMedium_first_handle);
+    EXPECT_EQ(medium->get_memory().size(), kMedium_slot_size);
+
+    auto large = classes_manager.allocate_slot(kDefault_slot_size);
+    ASSERT_TRUE(large);
+    EXPECT_EQ(*large->get_handle(), 0);
+    EXPECT_EQ(large->get_memory().size(), kDefault_slot_size);
+
+    // Unsized allocation always uses the default class
+    auto unsized = classes_manager.allocate_slot();
+    ASSERT_TRUE(unsized);
+    EXPECT_EQ(*unsized->get_handle(), 1);
+
+    EXPECT_EQ(classes_manager.allocate_slot(kDefault_slot_size + 1),
+              MakeUnexpected(Shared_memory_manager_error::logic_error_requested_size_too_large));
+    EXPECT_EQ(classes_manager.get_allocated_slot_count(), 4);
+}
+
+// Test: Sized allocation falls back to larger classes when the fitting class is exhausted
+TEST_P(Shared_memory_slot_class_test, allocation_falls_back_to_larger_class) {
+    std::vector<Shared_memory_slot_guard> guards;
+    for (std::size_t i = 0; i < kTotal_slot_count; ++i) {
+        auto guard = classes_manager.allocate_slot(1);
+        ASSERT_TRUE(guard);
+        guards.push_back(std::move(*guard));
+    }
+
+    EXPECT_EQ(guards[kSmall_slot_count].get_memory().size(), kMedium_slot_size);
+    EXPECT_EQ(guards.back().get_memory().size(), kDefault_slot_size);
+    EXPECT_EQ(classes_manager.allocate_slot(1),
+              MakeUnexpected(Shared_memory_manager_error::runtime_error_no_available_slots));
+
+    // A released small slot is preferred again
+    guards.front().reset();
+    auto small = classes_manager.allocate_slot(1);
+    ASSERT_TRUE(small);
+    EXPECT_EQ(small->get_memory().size(), kSmall_slot_size);
+}
+
+// Test: Slots of all classes are disjoint and each class starts aligned
+TEST_P(Shared_memory_slot_class_test, class_memory_is_disjoint_and_aligned) {
+    std::vector<Shared_memory_slot_guard> guards;
+    for (std::size_t i = 0; i < kTotal_slot_count; ++i) {
+        auto guard = classes_manager.allocate_slot(1);
+        ASSERT_TRUE(guard);
+        guards.push_back(std::move(*guard));
+    }
+
+    auto const* const base = guards.back().get_memory().data() - kDefault_slot_size;
+    for (auto const& guard : guards) {
+        auto const handle = *guard.get_handle();
+        if (handle == kSmall_first_handle || handle == kMedium_first_handle) {
+            EXPECT_EQ((guard.get_memory().data() - base) % kSlot_class_alignment, 0);
+        }
+        for (auto const& other : guards) {
+            if (&guard == &other) {
+                continue;
+            }
+            auto const memory = guard.get_memory();
+            auto const other_memory = other.get_memory();
+            EXPECT_TRUE(memory.data() + memory.size() <= other_memory.data() ||
+                        other_memory.data() + other_memory.size() <= memory.data());
+        }
+    }
+}
+
+// Test: The reader resolves handles of all classes to the memory written by the writer
+TEST_P(Shared_memory_slot_class_test, reader_sees_slots_of_all_classes) {
+    auto reader = classes_factory->open(classes_metadata);
+    ASSERT_TRUE(reader);
+
+    for (std::size_t const size : {kSmall_slot_size, kMedium_slot_size, kDefault_slot_size}) {
+        auto guard = classes_manager.allocate_slot(size);
+        ASSERT_TRUE(guard);
+        auto memory = guard->get_memory();
+        std::memset(memory.data(), static_cast<int>(size % 256), memory.size());
+
+        // used_bytes beyond the slot size are clamped to the slot size
+        auto payload = (*reader)->get_payload({*guard->get_handle(), size + 1}, [] {});
+        ASSERT_TRUE(payload);
+        ASSERT_EQ(payload->data().size(), size);
+        auto const expected = static_cast<Byte>(size % 256);
+        EXPECT_TRUE(std::all_of(payload->data().begin(), payload->data().end(),
+                                [expected](auto byte) { return byte == expected; }));
+    }
+
+    EXPECT_FALSE((*reader)->get_payload({kTotal_slot_count, 1}, [] {}));
+}
+
+// Test: Slot classes with zero size or count are rejected
+TEST_P(Shared_memory_slot_class_test, invalid_slot_class_is_rejected) {
+    auto metadata = classes_metadata;
+    metadata.slot_classes.data[1].slot_size = 0;
+    EXPECT_EQ(classes_factory->open(metadata),
+              MakeUnexpected(Shared_memory_manager_error::logic_error_invalid_slot_size));
+
+    metadata = classes_metadata;
+    metadata.slot_classes.data[0].slot_count = 0;
+    EXPECT_EQ(classes_factory->open(metadata),
+              MakeUnexpected(Shared_memory_manager_error::logic_error_invalid_slot_count));
+}
+
+class Shared_memory_consumer_count_test : public Shared_memory_slot_class_test {
+   protected:
+    Shared_memory_metadata const counted_metadata = [this] {
+        auto metadata = classes_metadata;
+        metadata.path = fixed_string_from_string_asserted<Shared_memory_path>(get_unique_path());
+        metadata.consumer_release = Consumer_release::shared_memory_consumer_count;
+        return metadata;
+    }();
+
+    Shared_memory_manager_factory::Uptr counted_factory = Shared_memory_manager_factory::create(
+        {{interface, {{instance, counted_metadata}}}}, GetParam());
+
+    Result<std::unique_ptr<Shared_memory_slot_manager>> counted_manager_result =
+        counted_factory->create(interface, instance);
+
+    Shared_memory_slot_manager& counted_manager = **counted_manager_result;
+
+    void SetUp() override {
+        Shared_memory_slot_class_test::SetUp();
+        ASSERT_TRUE(counted_manager_result);
+    }
+};
+
+INSTANTIATE_TEST_SUITE_P(, Shared_memory_consumer_count_test,
+                         ::testing::Values(Slot_allocation_strategy::linear_scan,
+                                           Slot_allocation_strategy::lock_free_free_list));
+
+// Test: Without consumer counts in shared memory, peer consumers cannot be counted
+TEST_P(Shared_memory_consumer_count_test, consumer_counts_are_disabled_by_default) {
+    EXPECT_EQ(classes_manager.get_consumer_release(), Consumer_release::payload_consumed_message);
+    auto guard = classes_manager.allocate_slot();
+    ASSERT_TRUE(guard);
+    EXPECT_EQ(classes_manager.add_peer_consumer(*guard->get_handle()),
+              MakeUnexpected(Shared_memory_manager_error::logic_error_no_consumer_counts));
+    EXPECT_EQ(classes_manager.get_peer_consumer_count(*guard->get_handle()), 0U);
+}
+
+// Test: Destroying a payload of the reader decrements the consumer count instead of calling back
+TEST_P(Shared_memory_consumer_count_test, reader_decrements_consumer_count_on_payload_destruction) {
+    EXPECT_EQ(counted_manager.get_consumer_release(),
+              Consumer_release::shared_memory_consumer_count);
+    auto reader = counted_factory->open(counted_metadata);
+    ASSERT_TRUE(reader);
+
+    auto guard = counted_manager.allocate_slot(kSmall_slot_size);
+    ASSERT_TRUE(guard);
+    auto const handle = *guard->get_handle();
+    ASSERT_TRUE(counted_manager.add_peer_consumer(handle));
+    ASSERT_TRUE(counted_manager.add_peer_consumer(handle));
+    EXPECT_EQ(counted_manager.get_peer_consumer_count(handle), 2U);
+
+    bool callback_called{false};
+    auto const callback = [&callback_called] { callback_called = true; };
+    auto first = (*reader)->get_payload({handle, 1}, callback);
+    auto second = (*reader)->get_payload({handle, 1}, callback);
+    ASSERT_TRUE(first);
+    ASSERT_TRUE(second);
+
+    first.reset();
+    EXPECT_EQ(counted_manager.get_peer_consumer_count(handle), 1U);
+    second.reset();
+    EXPECT_EQ(counted_manager.get_peer_consumer_count(handle), 0U);
+    EXPECT_FALSE(callback_called);
+    // The consumer count is independent of the local reference count
+    EXPECT_EQ(counted_manager.get_reference_count(handle), 1U);
+}
+
+// Test: Removing a peer consumer never wraps the consumer count below zero
+TEST_P(Shared_memory_consumer_count_test, remove_peer_consumer_stops_at_zero) {
+    ASSERT_TRUE(counted_manager.add_peer_consumer(0));
+    EXPECT_TRUE(counted_manager.remove_peer_consumer(0));
+    EXPECT_EQ(counted_manager.remove_peer_consumer(0),
+              MakeUnexpected(Shared_memory_manager_error::runtime_error_slot_not_allocated));
+    EXPECT_EQ(counted_manager.get_peer_consumer_count(0), 0U);
+    EXPECT_EQ(counted_manager.add_peer_consumer(kTotal_slot_count),
+              MakeUnexpected(Shared_memory_manager_error::logic_error_invalid_slot_handle));
+}
+
+// Test: Consumer counts are placed behind the memory of all slots
+TEST_P(Shared_memory_consumer_count_test, consumer_counts_do_not_overlap_slot_memory) {
+    std::vector<Shared_memory_slot_guard> guards;
+    for (std::size_t i = 0; i < kTotal_slot_count; ++i) {
+        auto guard = counted_manager.allocate_slot(kSmall_slot_size);
+        ASSERT_TRUE(guard);
+        auto memory = guard->get_memory();
+        std::memset(memory.data(), 0xFF, memory.size());
+        guards.push_back(std::move(*guard));
+    }
+
+    for (Slot_handle handle = 0; handle < kTotal_slot_count; ++handle) {
+        EXPECT_EQ(counted_manager.get_peer_consumer_count(handle), 0U);
+        ASSERT_TRUE(counted_manager.add_peer_consumer(handle));
+    }
+
+    for (auto const& guard : guards) {
+        auto const memory = guard.get_memory();
+        EXPECT_TRUE(std::all_of(memory.begin(), memory.end(),
+                                [](auto byte) { return byte == Byte{0xFF}; }));
+    }
+}
+
 }  // namespace score::gateway_ipc_binding
@@ -0,0 +1,127 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <optional>
+
+#include "../impl/shared_memory_managers.hpp"
+#include "score/socom/payload.hpp"
+
+namespace score::gateway_ipc_binding {
+namespace {
+
+class Slot_allocations_test : public ::testing::Test {
+   protected:
+    static constexpr std::size_t slot_count = 4U;
+
+    void SetUp() override { allocations.create(slot_count); }
+
+    /// \brief Payload of handle, counts its destruction in destroyed[handle]
+    socom::Payload make_payload(Slot_handle handle) {
+        return socom::Payload{socom::Payload::Writable_span{data.data(), data.size()}, handle,
+                              [this, handle]() { ++destroyed[handle]; }};
+    }
+
+    std::array<socom::Payload::Byte, 8U> data{};
+    std::array<std::size_t, slot_count> destroyed{};
+    Slot_allocations allocations;
+};
+
+TEST_F(Slot_allocations_test, kept_payload_is_released_by_its_last_consumer) {
+    EXPECT_FALSE(allocations.keep(1U, make_payload(1U), 2U).has_value());
+    EXPECT_TRUE(allocations.is_kept(1U));
+    EXPECT_FALSE(allocations.is_kept(0U));
+
+    EXPECT_FALSE(allocations.consume(1U).has_value());
+    EXPECT_TRUE(allocations.is_kept(1U));
+
+    auto released = allocations.consume(1U);
+    ASSERT_TRUE(released.has_value());
+    EXPECT_EQ(released->get_slot_handle(), 1U);
+    EXPECT_FALSE(allocations.is_kept(1U));
+    EXPECT_EQ(destroyed[1U], 0U);
+
+    released.reset();
+    EXPECT_EQ(destroyed[1U], 1U);
+}
+
+TEST_F(Slot_allocations_test, payload_without_consumers_is_not_kept) {
+    EXPECT_FALSE(allocations.keep(2U, make_payload(2U), 0U).has_value());
+    EXPECT_FALSE(allocations.is_kept(2U));
+    EXPECT_EQ(destroyed[2U], 1U);
+}
+
+TEST_F(Slot_allocations_test, consuming_a_slot_which_is_not_kept_does_nothing) {
+    EXPECT_FALSE(allocations.consume(0U).has_value());
+    EXPECT_FALSE(allocations.consume(slot_count).has_value());
+    EXPECT_FALSE(allocations.release(slot_count).has_value());
+}
+
+TEST_F(Slot_allocations_test, lost_consumers_release_the_payload_regardless_of_pending_ones) {
+    (void)allocations.keep(0U, make_payload(0U), 3U);
+    EXPECT_FALSE(allocations.consume(0U).has_value());
+
+    EXPECT_TRUE(allocations.release(0U).has_value());
+    EXPECT_FALSE(allocations.is_kept(0U));
+    EXPECT_EQ(destroyed[0U], 1U);
+
+    // Consumers which were still pending find nothing to release
+    EXPECT_FALSE(allocations.consume(0U).has_value());
+}
+
+TEST_F(Slot_allocations_test, full_table_keeps_all_slots) {
+    for (Slot_handle handle = 0U; handle < slot_count; ++handle) {
+        EXPECT_FALSE(allocations.keep(handle, make_payload(handle), 1U).has_value());
+    }
+    for (Slot_handle handle = 0U; handle < slot_count; ++handle) {
+        EXPECT_TRUE(allocations.is_kept(handle));
+    }
+
+    EXPECT_TRUE(allocations.consume(2U).has_value());
+    EXPECT_FALSE(allocations.is_kept(2U));
+    EXPECT_FALSE(allocations.keep(2U, make_payload(2U), 1U).has_value());
+    EXPECT_TRUE(allocations.is_kept(2U));
+}
+
+TEST_F(Slot_allocations_test, remaining_payloads_are_destroyed_with_the_table) {
+    {
+        Slot_allocations table;
+        table.create(slot_count);
+        (void)table.keep(0U, make_payload(0U), 1U);
+        (void)table.keep(3U, make_payload(3U), 2U);
+    }
+    EXPECT_EQ(destroyed[0U], 1U);
+    EXPECT_EQ(destroyed[3U], 1U);
+}
+
+TEST_F(Slot_allocations_test, duplicate_slot_replaces_the_kept_payload) {
+    (void)allocations.keep(1U, make_payload(1U), 1U);
+
+    auto replaced = allocations.keep(1U, make_payload(1U), 2U);
+    ASSERT_TRUE(replaced.has_value());
+    EXPECT_EQ(destroyed[1U], 0U);
+    replaced.reset();
+    EXPECT_EQ(destroyed[1U], 1U);
+
+    // The consumers of both payloads stay pending
+    EXPECT_FALSE(allocations.consume(1U).has_value());
+    EXPECT_FALSE(allocations.consume(1U).has_value());
+    EXPECT_TRUE(allocations.consume(1U).has_value());
+    EXPECT_EQ(destroyed[1U], 2U);
+}
+
+}  // namespace
+}  // namespace score::gateway_ipc_binding
@@ -62,6 +62,19 @@ Find_service_elements const find_service_elements1{{service1, instance_id}};
 Find_service_elements const find_service_elements2{{service0, instance_id},
                                                    {service1, instance_id}};
 
+/// \brief More find service elements than fit into the Connect message, sent in several pages
+Find_service_elements make_many_find_service_elements() {
+    Find_service_elements result;
+    for (std::size_t i = 0; i < 2U * kMax_connect_page_size + 3U; ++i) {
+        auto const id = fixed_string_from_string<Instance_id>("instance_" + std::to_string(i));
+        EXPECT_TRUE(id.has_value());
+        result.push_back({service0, id.value()});
+    }
+    return result;
+}
+
+Find_service_elements const find_service_elements_many = make_many_find_service_elements();
+
 INSTANTIATE_TEST_SUITE_P(
     , Gateway_ipc_binding_subscribe_find_service_integration_test,
     Values(std::vector<Find_service_elements>{find_service_elements0},
@@ -71,6 +84,9 @@ INSTANTIATE_TEST_SUITE_P(
            std::vector<Find_service_elements>{find_service_elements0, find_service_elements2},
            std::vector<Find_service_elements>{find_service_elements1, find_service_elements2},
            std::vector<Find_service_elements>{find_service_elements0, find_service_elements1,
+                                              find_service_elements2},
+           std::vector<Find_service_elements>{find_service_elements_many},
+           std::vector<Find_service_elements>{find_service_elements_many,
                                               find_service_elements2}));
 
 TEST_P(Gateway_ipc_binding_subscribe_find_service_integration_test,
@@ -70,14 +70,18 @@ class Gateway_ipc_binding_unconnected_integration_test : public ::testing::Test,
         server.reset();
     }
 
-    std::unique_ptr<Gateway_ipc_binding_server> create_ipc_server(socom::Runtime& runtime) {
+    std::unique_ptr<Gateway_ipc_binding_server> create_ipc_server(
+        socom::Runtime& runtime, Message_batching batching = {}, Message_dispatch dispatch = {},
+        Flow_control flow_control = {}, Latency_tracing latency_tracing = {},
+        Message_tracing message_tracing = {}, Busy_poll busy_poll = {}) {
         score::message_passing::ServerFactory server_factory;
         auto ipc_server = server_factory.Create(protocol_config, server_config);
 
         // Create gateway IPC binding server with pre-created IPC server
         auto server = Gateway_ipc_binding_server::create(
             runtime, std::move(ipc_server), Shared_memory_manager_factory::create({}),
-            mock_on_find_service_change_cb.as_function());
+            mock_on_find_service_change_cb.as_function(), batching, dispatch, flow_control,
+            latency_tracing, message_tracing, busy_poll);
 
         assert(server && "Server creation failed");
         return server;
@@ -87,12 +91,18 @@ class Gateway_ipc_binding_unconnected_integration_test : public ::testing::Test,
         socom::Runtime& runtime,
         Shared_memory_manager_factory::Shared_memory_configuration shm_config,
         Find_service_elements find_service_elements = {},
-        Shared_memory_configs server_shared_memory_configs = {}, std::string_view identifier = {}) {
+        Shared_memory_configs server_shared_memory_configs = {}, std::string_view identifier = {},
+        Message_batching batching = {}, Data_ring_config data_ring = {},
+        Message_dispatch dispatch = {}, Flow_control flow_control = {},
+        Latency_tracing latency_tracing = {}, Message_tracing message_tracing = {},
+        Busy_poll busy_poll = {}) {
         score::message_passing::ClientFactory client_factory;
         auto connection = client_factory.Create(protocol_config, client_config);
         auto client = Gateway_ipc_binding_client::create(
             runtime, std::move(connection), Shared_memory_manager_factory::create(shm_config),
-            std::move(find_service_elements), std::move(server_shared_memory_configs), identifier);
+            std::move(find_service_elements), std::move(server_shared_memory_configs), identifier,
+            batching, std::move(data_ring), dispatch, flow_control, latency_tracing,
+            message_tracing, busy_poll);
 
         assert(client && "Client creation failed");
         return client;
@@ -104,9 +114,9 @@ class Gateway_ipc_binding_unconnected_integration_test : public ::testing::Test,
         assert(start_result);
 
         // Wait for the client to connect and receive the reply
-        while (!client->is_connected()) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(1));
-        }
+        auto const connected = client->wait_for_state(Client_state::connected, very_long_timeout);
+        assert(connected);
+        static_cast<void>(connected);
     }
 };
 
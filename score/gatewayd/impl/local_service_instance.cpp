@@ -33,16 +33,19 @@ namespace score::someip_gateway::gatewayd {
 LocalServiceInstance::LocalServiceInstance(
     std::shared_ptr<const mw_someip_config::ServiceInstance> service_instance_config,
     std::shared_ptr<const mw_someip_config::ServiceType> service_type_config,
-    GenericProxy&& ipc_proxy, socom::Enabled_server_connector::Uptr server_connector)
+    GenericProxy&& ipc_proxy, socom::Enabled_server_connector::Uptr server_connector,
+    OnSamplesForwarded on_samples_forwarded)
     : service_instance_config_(std::move(service_instance_config)),
       service_type_config_(std::move(service_type_config)),
       ipc_proxy_(std::move(ipc_proxy)),
-      server_connector_(std::move(server_connector)) {}
+      server_connector_(std::move(server_connector)),
+      on_samples_forwarded_(std::move(on_samples_forwarded)) {}
 
 Result<std::unique_ptr<LocalServiceInstance>> LocalServiceInstance::Create(
     std::shared_ptr<const mw_someip_config::ServiceInstance> service_instance_config,
     std::shared_ptr<const mw_someip_config::ServiceType> service_type_config,
-    GenericProxy&& ipc_proxy, socom::Runtime& socom_runtime) {
+    GenericProxy&& ipc_proxy, socom::Runtime& socom_runtime,
+    OnSamplesForwarded on_samples_forwarded) {
     socom::Service_interface_identifier const iface{
         service_type_config->service_type_name()->string_view(),
         {service_type_config->service_version_major(),
@@ -84,9 +87,9 @@ Result<std::unique_ptr<LocalServiceInstance>> LocalServiceInstance::Create(
         socom::Disabled_server_connector::enable(std::move(disabled_server_connector).value());
 
     // Create the instance
-    auto instance = std::unique_ptr<LocalServiceInstance>(
-        new LocalServiceInstance(std::move(service_instance_config), std::move(service_type_config),
-                                 std::move(ipc_proxy), std::move(server_connector)));
+    auto instance = std::unique_ptr<LocalServiceInstance>(new LocalServiceInstance(
+        std::move(service_instance_config), std::move(service_type_config), std::move(ipc_proxy),
+        std::move(server_connector), std::move(on_samples_forwarded)));
 
     // Set up IPC event handlers (must be done after instance creation since handlers capture this)
     auto events = instance->ipc_proxy_.GetEvents();
@@ -193,6 +196,10 @@ Result<std::unique_ptr<LocalServiceInstance>> LocalServiceInstance::Create(
                                                                   std::move(payload));
                 },
                 someip::kMaxSampleCount);
+
+            if (instance_ptr->on_samples_forwarded_) {
+                instance_ptr->on_samples_forwarded_();
+            }
         });
 
         ipc_event.Subscribe(someip::kMaxSampleCount);
@@ -208,15 +215,18 @@ struct FindServiceContext {
     std::shared_ptr<const mw_someip_config::ServiceType> service_config;
     socom::Runtime* socom_runtime;
     std::vector<std::unique_ptr<LocalServiceInstance>>& instances;
+    LocalServiceInstance::OnSamplesForwarded on_samples_forwarded;
 
     FindServiceContext(std::shared_ptr<const mw_someip_config::ServiceInstance> config_,
                        std::shared_ptr<const mw_someip_config::ServiceType> service_config_,
                        socom::Runtime& socom_runtime_,
-                       std::vector<std::unique_ptr<LocalServiceInstance>>& instances_)
+                       std::vector<std::unique_ptr<LocalServiceInstance>>& instances_,
+                       LocalServiceInstance::OnSamplesForwarded on_samples_forwarded_)
         : config(std::move(config_)),
           service_config(std::move(service_config_)),
           socom_runtime(&socom_runtime_),
-          instances(instances_) {}
+          instances(instances_),
+          on_samples_forwarded(std::move(on_samples_forwarded_)) {}
 };
 
 }  // namespace
@@ -224,7 +234,8 @@ struct FindServiceContext {
 Result<mw::com::FindServiceHandle> LocalServiceInstance::CreateAsyncLocalServices(
     std::shared_ptr<const mw_someip_config::ServiceInstance> service_instance_config,
     std::shared_ptr<const mw_someip_config::ServiceType> service_type_config,
-    socom::Runtime& socom_runtime, std::vector<std::unique_ptr<LocalServiceInstance>>& instances) {
+    socom::Runtime& socom_runtime, std::vector<std::unique_ptr<LocalServiceInstance>>& instances,
+    OnSamplesForwarded on_samples_forwarded) {
     if (service_instance_config == nullptr) {
         score::mw::log::LogError() << "[gatewayd] ERROR: Service instance config is nullptr!";
         return MakeUnexpected(score::mw::com::ComErrc::kInvalidConfiguration);
@@ -237,8 +248,9 @@ Result<mw::com::FindServiceHandle> LocalServiceInstance::CreateAsyncLocalService
 
     // TODO: StartFindService should be modified to handle arbitrarily large lambdas
     // or we need to check whether it is OK to stick with dynamic allocation here.
-    auto context = std::make_unique<FindServiceContext>(
-        service_instance_config, service_type_config, socom_runtime, instances);
+    auto context = std::make_unique<FindServiceContext>(service_instance_config,
+                                                        service_type_config, socom_runtime,
+                                                        instances, std::move(on_samples_forwarded));
 
     return GenericProxy::StartFindService(
         [context = std::move(context)](auto handles, auto find_handle) {
@@ -256,7 +268,8 @@ Result<mw::com::FindServiceHandle> LocalServiceInstance::CreateAsyncLocalService
 
             auto create_result = LocalServiceInstance::Create(instance_config, service_config,
                                                               std::move(proxy_result).value(),
-                                                              *context->socom_runtime);
+                                                              *context->socom_runtime,
+                                                              context->on_samples_forwarded);
             if (!create_result.has_value()) {
                 score::mw::log::LogError()
                     << "[gatewayd] Failed to create LocalServiceInstance for '"
@@ -14,6 +14,7 @@
 #ifndef IMPL_GATEWAYD_LOCAL_SERVICE_INSTANCE
 #define IMPL_GATEWAYD_LOCAL_SERVICE_INSTANCE
 
+#include <functional>
 #include <map>
 #include <memory>
 #include <string_view>
@@ -40,11 +41,16 @@ namespace score::someip_gateway::gatewayd {
 ///          the someipd daemon, ultimately making the local service accessible to remote ECUs.
 class LocalServiceInstance {
    public:
+    /// \brief Called after all samples available on an IPC event have been forwarded, e.g. to
+    ///        flush batched event updates to someipd
+    using OnSamplesForwarded = std::function<void()>;
+
     /// \brief Creates a LocalServiceInstance
     /// \param service_instance_config Configuration for this service instance
     /// \param service_type_config Configuration for the service type of this instance
     /// \param ipc_proxy Generic proxy for IPC communication with the local service
     /// \param socom_runtime SOCom runtime used to create the server connector
+    /// \param on_samples_forwarded Called after each batch of received samples was forwarded
     /// \return Result containing the created instance on success, or an error on failure
     /// \details This factory method creates a local service instance with the necessary
     ///          components to forward local service messages to the someipd daemon, which
@@ -52,13 +58,15 @@ class LocalServiceInstance {
     static Result<std::unique_ptr<LocalServiceInstance>> Create(
         std::shared_ptr<const mw_someip_config::ServiceInstance> service_instance_config,
         std::shared_ptr<const mw_someip_config::ServiceType> service_type_config,
-        score::mw::com::GenericProxy&& ipc_proxy, socom::Runtime& socom_runtime);
+        score::mw::com::GenericProxy&& ipc_proxy, socom::Runtime& socom_runtime,
+        OnSamplesForwarded on_samples_forwarded = {});
 
     /// \brief Asynchronously creates a local service instance
     /// \param service_instance_config Configuration for the service instance to create
     /// \param service_type_config Configuration for the service type of the instance to create
     /// \param socom_runtime SOCom runtime used to create the server connector
     /// \param instances Reference to the vector to store the created local service instance
+    /// \param on_samples_forwarded Called after each batch of received samples was forwarded
     /// \return Result containing a FindServiceHandle on success, or an error on failure
     /// \details This static factory method asynchronously searches for and creates a local
     ///          service instance. It performs service discovery on the local ECU and, when
@@ -69,7 +77,8 @@ class LocalServiceInstance {
         std::shared_ptr<const mw_someip_config::ServiceInstance> service_instance_config,
         std::shared_ptr<const mw_someip_config::ServiceType> service_type_config,
         socom::Runtime& socom_runtime,
-        std::vector<std::unique_ptr<LocalServiceInstance>>& instances);
+        std::vector<std::unique_ptr<LocalServiceInstance>>& instances,
+        OnSamplesForwarded on_samples_forwarded = {});
 
     LocalServiceInstance(const LocalServiceInstance&) = delete;
     LocalServiceInstance& operator=(const LocalServiceInstance&) = delete;
@@ -82,7 +91,8 @@ class LocalServiceInstance {
         std::shared_ptr<const mw_someip_config::ServiceInstance> service_instance_config,
         std::shared_ptr<const mw_someip_config::ServiceType> service_type_config,
         score::mw::com::GenericProxy&& ipc_proxy,
-        score::socom::Enabled_server_connector::Uptr server_connector);
+        score::socom::Enabled_server_connector::Uptr server_connector,
+        OnSamplesForwarded on_samples_forwarded);
 
     /// Configuration for this service instance
     std::shared_ptr<const mw_someip_config::ServiceInstance> service_instance_config_;
@@ -92,6 +102,8 @@ class LocalServiceInstance {
     score::mw::com::GenericProxy ipc_proxy_;
     /// SOCom server connector for handling communication with the someipd daemon
     score::socom::Enabled_server_connector::Uptr server_connector_;
+    /// Called after the samples received by an IPC event receive handler have been forwarded
+    OnSamplesForwarded on_samples_forwarded_;
 
     struct EventContext {
         const mw_someip_config::Event* config;
@@ -12,21 +12,30 @@
  ********************************************************************************/
 
 #include <getopt.h>
+#include <poll.h>
+#include <sys/signalfd.h>
+#include <unistd.h>
 
 #include <algorithm>
-#include <atomic>
+#include <array>
+#include <cerrno>
+#include <chrono>
 #include <csignal>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include <memory>
-#include <thread>
+#include <string_view>
+#include <vector>
 
 #include "impl/local_service_instance.h"
 #include "impl/remote_service_instance.h"
 #include "score/config/mw_someip_config_generated.h"
 #include "score/filesystem/path.h"
 #include "score/gateway_ipc_binding/gateway_ipc_binding_client.hpp"
+#include "score/gateway_ipc_binding/message_trace.hpp"
 #include "score/message_passing/client_factory.h"
 #include "score/message_passing/service_protocol_config.h"
 #include "score/mw/com/runtime.h"
@@ -40,54 +49,165 @@
 using namespace score;
 using namespace score::someip_gateway::gatewayd;
 
-// Global flag to control application shutdown
-static std::atomic<bool> shutdown_requested{false};
+/// Upper bound of the latency added by batching event updates sent to someipd. Samples received
+/// together are flushed right away, the deadline only covers updates sent from other contexts.
+static constexpr std::chrono::microseconds kMaxEventUpdateBatchDelay{200};
 
-/// Calculates the required shared memory slot size for a service
-/// (Largest serialized event payload + SOME/IP header).
+/// Shared memory rings replacing the socket to someipd for all messages after the handshake
+static constexpr char const* kDataRingPath = "/gatewayd_data_ring";
+
+/// File receiving the message trace of the IPC binding on SIGUSR1, see message_trace.hpp
+static constexpr char const* kMessageTracePath = "/tmp/gatewayd_message_trace.bin";
+
+/// Calculates the required shared memory slot size of a single event or method payload
+/// (Largest serialized payload + SOME/IP header).
 ///
 /// Since encoding affects the payload size, we query the serializer plugin
-/// directly. If any event size is unknown or the serializer is missing, we safely
-/// fall back to the max transport limit. We must know the exact max size of *all*
-/// events to safely shrink the slot.
-static std::size_t event_slot_size(const mw_someip_config::ServiceType& service_type) {
-    const auto* const events = service_type.events();
-    if (events == nullptr || events->size() == 0) {
+/// directly. If the payload size is unknown or the serializer is missing, we safely
+/// fall back to the max transport limit.
+static std::size_t element_slot_size(std::string_view service_type_name,
+                                     score_com_serializer_element_type element_type,
+                                     std::string_view element_name) {
+    const score_com_serializer* serializer = nullptr;
+    if (score_com_serializer_get(service_type_name.data(), service_type_name.size(),
+                                 element_type, element_name.data(), element_name.size(),
+                                 &serializer) != score_com_serializer_result_ok) {
+        score::mw::log::LogWarn() << "[gatewayd] No serializer for " << service_type_name
+                                  << "::" << element_name << ", using maximum slot size";
         return someip::kMaxMessageSize;
     }
 
-    auto const service_type_name = service_type.service_type_name()->string_view();
+    auto const max_serialized_size = score_com_serializer_get_max_serialized_size(serializer);
+    if (max_serialized_size == 0) {
+        score::mw::log::LogWarn() << "[gatewayd] Serializer reports no maximum size for "
+                                  << service_type_name << "::" << element_name
+                                  << ", using maximum slot size";
+        return someip::kMaxMessageSize;
+    }
+    return max_serialized_size + someip::kSomeipFullHeaderSize;
+}
 
-    std::size_t largest = 0;
-    for (const auto* const event : *events) {
-        auto const event_name = event->event_name()->string_view();
-        const score_com_serializer* serializer = nullptr;
-        if (score_com_serializer_get(service_type_name.data(), service_type_name.size(),
-                                     score_com_serializer_element_type_event, event_name.data(),
-                                     event_name.size(),
-                                     &serializer) != score_com_serializer_result_ok) {
-            score::mw::log::LogWarn() << "[gatewayd] No serializer for " << service_type_name
-                                      << "::" << event_name << ", using maximum slot size";
-            return someip::kMaxMessageSize;
+/// Calculates the shared memory metadata of the events of a service.
+///
+/// The kMaxSampleCount slots of the service are sized for the events allocating from them, see
+/// gateway_ipc_binding::make_event_slot_layout.
+static gateway_ipc_binding::Shared_memory_metadata event_shared_memory_metadata(
+    gateway_ipc_binding::Shared_memory_path const& path,
+    const mw_someip_config::ServiceType& service_type) {
+    auto const service_type_name = service_type.service_type_name()->string_view();
+    std::vector<std::size_t> sizes;
+    if (const auto* const events = service_type.events(); events != nullptr) {
+        sizes.reserve(events->size());
+        for (const auto* const event : *events) {
+            sizes.push_back(element_slot_size(service_type_name,
+                                              score_com_serializer_element_type_event,
+                                              event->event_name()->string_view()));
         }
+    }
+    if (sizes.size() > gateway_ipc_binding::Event_slot_sizes::max_size) {
+        score::mw::log::LogWarn() << "[gatewayd] Too many events in " << service_type_name
+                                  << " for per-event slot sizes, using a single slot class";
+    }
 
-        auto const max_serialized_size = score_com_serializer_get_max_serialized_size(serializer);
-        if (max_serialized_size == 0) {
-            score::mw::log::LogWarn()
-                << "[gatewayd] Serializer reports no maximum size for " << service_type_name
-                << "::" << event_name << ", using maximum slot size";
-            return someip::kMaxMessageSize;
-        }
-        largest = std::max(largest, max_serialized_size);
+    auto metadata =
+        gateway_ipc_binding::make_event_slot_layout(path, sizes, someip::kMaxSampleCount);
+    if (sizes.empty()) {
+        metadata.slot_size = someip::kMaxMessageSize;
     }
+    metadata.consumer_release = gateway_ipc_binding::Consumer_release::shared_memory_consumer_count;
+    return metadata;
+}
 
-    return largest + someip::kSomeipFullHeaderSize;
+/// Calculates the shared memory metadata of the method payloads sent to the peer of a service.
+///
+/// The shared memory holds the requests of calls to the service as well as the replies of the
+/// service, up to kMaxSampleCount of them in flight, each in a slot sized for the largest method
+/// payload. A service without methods sends no payloads and gets a single minimal slot.
+static gateway_ipc_binding::Shared_memory_metadata method_shared_memory_metadata(
+    gateway_ipc_binding::Shared_memory_path const& path,
+    const mw_someip_config::ServiceType& service_type) {
+    gateway_ipc_binding::Shared_memory_metadata metadata{};
+    metadata.path = path;
+    metadata.slot_size = 1U;
+    metadata.slot_count = 1U;
+
+    const auto* const methods = service_type.methods();
+    if (methods == nullptr || methods->size() == 0) {
+        return metadata;
+    }
+
+    auto const service_type_name = service_type.service_type_name()->string_view();
+    for (const auto* const method : *methods) {
+        auto const method_name = method->method_name()->string_view();
+        metadata.slot_size = std::max(
+            {metadata.slot_size,
+             element_slot_size(service_type_name, score_com_serializer_element_type_method_call,
+                               method_name),
+             element_slot_size(service_type_name,
+                               score_com_serializer_element_type_method_response, method_name)});
+    }
+    metadata.slot_count = someip::kMaxSampleCount;
+    return metadata;
 }
 
-// Signal handler for graceful shutdown
-void termination_handler(int /*signal*/) {
-    std::cout << "Received termination signal. Initiating graceful shutdown..." << std::endl;
-    shutdown_requested.store(true);
+// Blocks SIGTERM, SIGINT and SIGUSR1 in all threads created afterwards and returns a descriptor
+// receiving them instead, -1 on failure
+static int create_signal_fd() {
+    sigset_t signals;
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGTERM);
+    sigaddset(&signals, SIGINT);
+    sigaddset(&signals, SIGUSR1);
+    if (pthread_sigmask(SIG_BLOCK, &signals, nullptr) != 0) {
+        return -1;
+    }
+    return signalfd(-1, &signals, SFD_CLOEXEC);
+}
+
+// Blocks until a signal arrives or the state of the IPC binding client changes
+// Returns the signal number, or 0 for a state change
+static int wait_for_signal_or_state_change(
+    int signal_fd, gateway_ipc_binding::Gateway_ipc_binding_client const& binding_client) {
+    auto const state_fd = binding_client.get_state_fd();
+    while (true) {
+        std::array<pollfd, 2> fds{{{signal_fd, POLLIN, 0}, {state_fd, POLLIN, 0}}};
+        auto const ready = poll(fds.data(), fds.size(), -1);
+        if (ready < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            score::mw::log::LogError()
+                << "[gatewayd] Waiting for signals failed: " << std::strerror(errno);
+            return SIGTERM;
+        }
+        if ((fds[0].revents & POLLIN) != 0) {
+            signalfd_siginfo info{};
+            if (read(signal_fd, &info, sizeof(info)) == static_cast<ssize_t>(sizeof(info))) {
+                return static_cast<int>(info.ssi_signo);
+            }
+        }
+        if ((fds[1].revents & POLLIN) != 0) {
+            std::array<std::uint8_t, 64> buffer{};
+            while (read(state_fd, buffer.data(), buffer.size()) > 0) {
+            }
+            return 0;
+        }
+    }
+}
+
+// Writes the message trace of the IPC binding to kMessageTracePath
+static void dump_message_trace(
+    gateway_ipc_binding::Gateway_ipc_binding_client const& binding_client) {
+    auto const records = binding_client.get_message_trace();
+    std::ofstream trace_file{kMessageTracePath, std::ios::binary | std::ios::trunc};
+    auto const written = gateway_ipc_binding::write_message_trace(trace_file, records);
+    if (!written) {
+        score::mw::log::LogError() << "[gatewayd] Writing the message trace to "
+                                   << kMessageTracePath << " failed: " << written.error().Message();
+        return;
+    }
+    std::cout << "[gatewayd] Wrote " << records.size() << " message trace records to "
+              << kMessageTracePath << std::endl;
 }
 
 // Help text, showing usage syntax and available options
@@ -101,13 +221,20 @@ void print_help() {
               << " -h/--help Displays this help\n"
               << " -c/--configuration Specifies the configuration file\n"
               << " -s/--service_instance_manifest Specifies the service instance manifest file\n"
+              << "\n"
+              << "Sending SIGUSR1 writes the IPC message trace to " << kMessageTracePath << "\n"
               << "\n";
 }
 
 int main(int argc, char* argv[]) {
-    // Register signal handlers for graceful shutdown
-    std::signal(SIGTERM, termination_handler);
-    std::signal(SIGINT, termination_handler);
+    // Receive the signals for graceful shutdown and for dumping the message trace through a
+    // descriptor, before any thread is started that would otherwise inherit an unblocked mask
+    int const signal_fd = create_signal_fd();
+    if (signal_fd < 0) {
+        std::cerr << "Failed to set up signal handling: " << std::strerror(errno) << std::endl;
+        return 1;
+    }
+    score::socom::Final_action const close_signal_fd{[signal_fd]() { close(signal_fd); }};
 
     const char* const short_opts = "hc:s:";
     const option long_opts[] = {{"help", no_argument, nullptr, 'h'},
@@ -202,6 +329,9 @@ int main(int argc, char* argv[]) {
     // "Connect" is the largest IPC message due to the embedded SHM metadata
     static_assert(sizeof(gateway_ipc_binding::Connect{}) <= score::someip::kMaxIpcMessageSize,
                   "Connect message exceeds max_send_size");
+    static_assert(
+        sizeof(gateway_ipc_binding::Event_update_batch{}) <= score::someip::kMaxIpcMessageSize,
+        "Event_update_batch message exceeds max_send_size");
 
     message_passing::ServiceProtocolConfig proto_config{
         "someipd_gatewayd_ipc", score::someip::kMaxIpcMessageSize,
@@ -244,17 +374,17 @@ int main(int argc, char* argv[]) {
             continue;
         }
 
-        const std::size_t slot_size = event_slot_size(*service_type_config);
+        auto const event_metadata =
+            event_shared_memory_metadata(*shm_path_result, *service_type_config);
+        // Holds the method call payloads sent by the ipc binding
+        auto const method_metadata =
+            method_shared_memory_metadata(*counterpart_shm_path_result, *service_type_config);
         if (service_type_config->local_service_instances()) {
-            shm_config[iface][inst] = {*shm_path_result, slot_size, someip::kMaxSampleCount};
-            // TODO: Needed by the ipc binding for future use of method calls. Set to the smallest
-            // possible size for now.
-            server_shm_config[iface][inst] = {*counterpart_shm_path_result, 1, 1};
+            shm_config[iface][inst] = event_metadata;
+            server_shm_config[iface][inst] = method_metadata;
         } else if (service_type_config->remote_service_instances()) {
-            server_shm_config[iface][inst] = {*shm_path_result, slot_size, someip::kMaxSampleCount};
-            // TODO: Needed by the ipc binding for future use of method calls. Set to the smallest
-            // possible size for now.
-            shm_config[iface][inst] = {*counterpart_shm_path_result, 1, 1};
+            server_shm_config[iface][inst] = event_metadata;
+            shm_config[iface][inst] = method_metadata;
         } else {
             score::mw::log::LogError()
                 << "[gatewayd] Service " << service_type_config->service_type_name()->string_view()
@@ -265,18 +395,31 @@ int main(int argc, char* argv[]) {
     // Create the binding client (auto-sends Connect when the socket is ready).
     auto binding_client = gateway_ipc_binding::Gateway_ipc_binding_client::create(
         *socom_runtime, std::move(ipc_connection),
-        gateway_ipc_binding::Shared_memory_manager_factory::create(shm_config),
+        gateway_ipc_binding::Shared_memory_manager_factory::create(
+            shm_config, gateway_ipc_binding::Slot_allocation_strategy::lock_free_free_list),
         {},  // find_service_elements
-        score::gateway_ipc_binding::make_shared_memory_configs(server_shm_config), "gatewayd");
+        score::gateway_ipc_binding::make_shared_memory_configs(server_shm_config), "gatewayd",
+        gateway_ipc_binding::Message_batching{
+            {score::someip::kMaxSampleCount, kMaxEventUpdateBatchDelay},
+            // No Payload_consumed is sent, the event shared memory keeps consumer counts
+            {}},
+        gateway_ipc_binding::Data_ring_config{kDataRingPath});
+    if (binding_client->get_state_fd() < 0) {
+        std::cerr << "Failed to set up connection state notification of the IPC binding"
+                  << std::endl;
+        return 1;
+    }
 
     // Wait for the IPC handshake to complete (requires someipd to be running).
-    while (!binding_client->is_connected() && !shutdown_requested.load()) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
-    }
-    if (shutdown_requested.load()) {
-        score::mw::log::LogInfo()
-            << "[gatewayd] Shutdown requested during IPC handshake with someipd, exiting...";
-        return 0;
+    while (!binding_client->is_connected()) {
+        auto const signal = wait_for_signal_or_state_change(signal_fd, *binding_client);
+        if (signal == SIGUSR1) {
+            dump_message_trace(*binding_client);
+        } else if (signal != 0) {
+            score::mw::log::LogInfo()
+                << "[gatewayd] Shutdown requested during IPC handshake with someipd, exiting...";
+            return 0;
+        }
     }
     std::cout << "[gatewayd] IPC connection to someipd established" << std::endl;
 
@@ -299,7 +442,8 @@ int main(int argc, char* argv[]) {
                         config, service_instance_config),
                     std::shared_ptr<const score::mw_someip_config::ServiceType>(
                         config, service_type_config),
-                    *socom_runtime, local_service_instances);
+                    *socom_runtime, local_service_instances,
+                    [&binding_client]() { binding_client->flush_event_updates(); });
             }
         }
     }
@@ -330,8 +474,20 @@ int main(int argc, char* argv[]) {
     std::cout << "Gateway started, waiting for shutdown signal..." << std::endl;
 
     // Main loop - run until shutdown is requested
-    while (!shutdown_requested.load()) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    bool connected = true;
+    while (true) {
+        auto const signal = wait_for_signal_or_state_change(signal_fd, *binding_client);
+        if (signal == SIGUSR1) {
+            dump_message_trace(*binding_client);
+        } else if (signal != 0) {
+            std::cout << "Received termination signal. Initiating graceful shutdown..."
+                      << std::endl;
+            break;
+        } else if (binding_client->is_connected() != connected) {
+            connected = !connected;
+            std::cout << "[gatewayd] IPC connection to someipd "
+                      << (connected ? "re-established" : "lost") << std::endl;
+        }
     }
 
     std::cout << "Shutting down gateway..." << std::endl;
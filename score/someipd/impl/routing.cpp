@@ -13,8 +13,11 @@
 
 #include "routing.h"
 
+#include <sys/signalfd.h>
+#include <unistd.h>
+
 #include <cassert>
-#include <chrono>
+#include <cerrno>
 #include <functional>
 #include <thread>
 
@@ -98,15 +101,22 @@ InstanceId Routing::LookupInstanceId(ServiceId service_id) const {
     return kAnyInstance;
 }
 
-void Routing::ProcessMessages(std::atomic<bool>& shutdown_requested) {
-    // TODO: Replace sleep loop with SOCom client_connector callbacks
-    while (!shutdown_requested.load()) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+void Routing::ProcessMessages(int signal_fd) {
+    // Messages are handled by vsomeip and SOCom threads, this thread only waits for shutdown
+    signalfd_siginfo info{};
+    ssize_t result{0};
+    do {
+        result = read(signal_fd, &info, sizeof(info));
+    } while (result < 0 && errno == EINTR);
+    if (result == static_cast<ssize_t>(sizeof(info))) {
+        score::mw::log::LogWarn() << "Received termination signal. Initiating graceful shutdown...";
+    } else {
+        score::mw::log::LogError() << "[someipd] Waiting for signals failed, shutting down...";
     }
     score::mw::log::LogInfo() << "[someipd] Message loop exited, shutting down...";
 }
 
-void Routing::Run(std::atomic<bool>& shutdown_requested, std::function<void()> on_registered) {
+void Routing::Run(int signal_fd, std::function<void()> on_registered) {
     application_->register_state_handler([this, on_registered = std::move(on_registered)](
                                              vsomeip::state_type_e state) {
         if (state == vsomeip::state_type_e::ST_REGISTERED) {
@@ -121,7 +131,7 @@ void Routing::Run(std::atomic<bool>& shutdown_requested, std::function<void()> o
     score::mw::log::LogInfo() << "[someipd] Starting network stack processing...";
     processing_thread_ = std::thread([this]() { application_->start(); });
     score::mw::log::LogInfo() << "[someipd] Network stack started, entering message loop.";
-    ProcessMessages(shutdown_requested);
+    ProcessMessages(signal_fd);
     score::mw::log::LogInfo() << "[someipd] Stopping network stack processing...";
     if (application_) {
         application_->stop();
@@ -14,7 +14,6 @@
 #ifndef IMPL_SOMEIPD_ROUTING
 #define IMPL_SOMEIPD_ROUTING
 
-#include <atomic>
 #include <functional>
 #include <memory>
 #include <thread>
@@ -60,15 +59,16 @@ class Routing {
     /// Returns the vsomeip application instance.
     std::shared_ptr<vsomeip::application> get_application() const noexcept { return application_; }
 
-    /// Runs the routing loop, blocking until @p shutdown_requested is set to true.
+    /// Runs the routing loop, blocking until a signal can be read from @p signal_fd.
+    /// \param signal_fd signalfd receiving the termination signals, which the caller has blocked
     /// \param on_registered Optional callback invoked once vsomeip reaches ST_REGISTERED.
     ///        Use this to call setup_vsomeip() on RemoteNetworkService instances.
-    void Run(std::atomic<bool>& shutdown_requested, std::function<void()> on_registered = {});
+    void Run(int signal_fd, std::function<void()> on_registered = {});
 
    private:
     explicit Routing(std::shared_ptr<const score::mw_someip_config::Root> config);
     void SetupOfferings();
-    void ProcessMessages(std::atomic<bool>& shutdown_requested);
+    void ProcessMessages(int signal_fd);
     InstanceId LookupInstanceId(ServiceId service_id) const;
 
     std::shared_ptr<const score::mw_someip_config::Root> config_;
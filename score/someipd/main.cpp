@@ -12,10 +12,13 @@
  ********************************************************************************/
 
 #include <getopt.h>
+#include <sys/signalfd.h>
+#include <unistd.h>
 
-#include <atomic>
+#include <cerrno>
 #include <csignal>
 #include <cstdlib>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include <memory>
@@ -29,18 +32,24 @@
 #include "score/message_passing/server_factory.h"
 #include "score/message_passing/service_protocol_config.h"
 #include "score/mw/log/logging.h"
+#include "score/socom/final_action.hpp"
 #include "score/socom/runtime.hpp"
 #include "score/someip/constants.h"
 
 using namespace score;
 using namespace score::someipd;
 
-// Global flag to control application shutdown
-static std::atomic<bool> shutdown_requested{false};
-
-void termination_handler(int /*signal*/) {
-    score::mw::log::LogWarn() << "Received termination signal. Initiating graceful shutdown...";
-    shutdown_requested.store(true);
+// Blocks SIGTERM and SIGINT in all threads created afterwards and returns a descriptor receiving
+// them instead, -1 on failure
+static int create_signal_fd() {
+    sigset_t signals;
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGTERM);
+    sigaddset(&signals, SIGINT);
+    if (pthread_sigmask(SIG_BLOCK, &signals, nullptr) != 0) {
+        return -1;
+    }
+    return signalfd(-1, &signals, SFD_CLOEXEC);
 }
 
 // Help text, showing usage syntax and available options
@@ -56,9 +65,14 @@ void print_help() {
 }
 
 int main(int argc, char* argv[]) {
-    // Register signal handlers for graceful shutdown
-    std::signal(SIGTERM, termination_handler);
-    std::signal(SIGINT, termination_handler);
+    // Receive the signals for graceful shutdown through a descriptor, before any thread is
+    // started that would otherwise inherit an unblocked mask
+    int const signal_fd = create_signal_fd();
+    if (signal_fd < 0) {
+        std::cerr << "Failed to set up signal handling: " << std::strerror(errno) << std::endl;
+        return EXIT_FAILURE;
+    }
+    score::socom::Final_action const close_signal_fd{[signal_fd]() { close(signal_fd); }};
 
     const char* const short_opts = "hc:";
     const option long_opts[] = {{"help", no_argument, nullptr, 'h'},
@@ -136,7 +150,8 @@ int main(int argc, char* argv[]) {
     // Create the IPC binding server.
     auto binding_server = gateway_ipc_binding::Gateway_ipc_binding_server::create(
         *socom_runtime, std::move(ipc_server),
-        gateway_ipc_binding::Shared_memory_manager_factory::create({}),
+        gateway_ipc_binding::Shared_memory_manager_factory::create(
+            {}, gateway_ipc_binding::Slot_allocation_strategy::lock_free_free_list),
         [](gateway_ipc_binding::Client_id, gateway_ipc_binding::Find_service_elements const&,
            bool) {});
 
@@ -215,7 +230,7 @@ int main(int argc, char* argv[]) {
     }
 
     score::mw::log::LogInfo() << "[someipd] Starting routing loop...";
-    routing.value().Run(shutdown_requested, [&remote_network_services]() {
+    routing.value().Run(signal_fd, [&remote_network_services]() {
         for (auto& svc : remote_network_services) {
             svc->setup_vsomeip();
         }